@@ -0,0 +1,42 @@
+/*!
+    \file memory_concurrent_arena.cpp
+    \brief Concurrent arena memory allocator example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_concurrent_arena.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::ConcurrentArenaMemoryManager<CppCommon::DefaultMemoryManager> manger(auxiliary);
+    CppCommon::ConcurrentArenaAllocator<int, CppCommon::DefaultMemoryManager> alloc(manger);
+
+    // Fan-out parallel stage sharing the same arena
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&manger, &alloc, thread]()
+        {
+            CppCommon::ConcurrentArenaScope<CppCommon::DefaultMemoryManager> scope(manger);
+
+            int* a = alloc.CreateArray(3, thread);
+            alloc.ReleaseArray(a);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::cout << "Arena pages: " << manger.pages() << std::endl;
+
+    manger.reset();
+    std::cout << "Arena epoch: " << manger.epoch() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+/*!
+    \file memory_heap_profiler.cpp
+    \brief Sampling heap profiler example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/heap_profiler_new.h"
+
+#include <iostream>
+#include <vector>
+
+std::vector<int*> Allocate(size_t count)
+{
+    std::vector<int*> result;
+    for (size_t i = 0; i < count; ++i)
+        result.push_back(new int[256]);
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    // Sample about one allocation per 64 kilobytes
+    CppCommon::HeapProfiler::Start(64 * 1024);
+
+    std::vector<int*> blocks = Allocate(10000);
+
+    // Dump top allocation sites
+    CppCommon::HeapProfiler::Dump(std::cout, 3);
+
+    for (auto block : blocks)
+        delete[] block;
+
+    CppCommon::HeapProfiler::Stop();
+
+    return 0;
+}
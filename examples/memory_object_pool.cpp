@@ -0,0 +1,47 @@
+/*!
+    \file memory_object_pool.cpp
+    \brief Object pool with generational handles example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/object_pool.h"
+
+#include <iostream>
+#include <string>
+
+struct Order
+{
+    int id;
+    std::string symbol;
+
+    Order(int i, const std::string& s) : id(i), symbol(s) {}
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> manger(auxiliary);
+    CppCommon::ObjectPool<Order> pool(manger);
+
+    auto order1 = pool.create(1, "EURUSD");
+    auto order2 = pool.create(2, "GBPUSD");
+    auto order3 = pool.create(3, "USDJPY");
+
+    // Destroy the second order
+    pool.destroy(order2);
+
+    // Stale handle does not resolve to any object
+    std::cout << "order2 is valid: " << (pool.valid(order2) ? "true" : "false") << std::endl;
+    std::cout << "order1 = " << pool.get(order1)->symbol << std::endl;
+
+    // Iterate through all live orders
+    for (auto it = pool.begin(); it != pool.end(); ++it)
+        std::cout << "Order " << it->id << ": " << it->symbol << std::endl;
+
+    pool.destroy(order1);
+    pool.destroy(order3);
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+/*!
+    \file memory_page.cpp
+    \brief Page memory allocator example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_arena.h"
+#include "memory/allocator_page.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Map huge pages prefaulted on the first NUMA node
+    CppCommon::PageMemoryManager auxiliary(CppCommon::PageFlags::HUGEPAGES | CppCommon::PageFlags::POPULATE, 0);
+    CppCommon::ArenaMemoryManager<CppCommon::PageMemoryManager> manger(auxiliary, 2 * 1024 * 1024 - 1024);
+    CppCommon::ArenaAllocator<int, CppCommon::PageMemoryManager> alloc(manger);
+
+    std::cout << "Page granularity: " << auxiliary.granularity() << std::endl;
+    std::cout << "Huge pages fallbacks: " << auxiliary.fallbacks() << std::endl;
+
+    int* v = alloc.Create(123);
+    std::cout << "v = " << *v << std::endl;
+    alloc.Release(v);
+
+    int* a = alloc.CreateArray(3, 123);
+    std::cout << "a[0] = " << a[0] << std::endl;
+    std::cout << "a[1] = " << a[1] << std::endl;
+    std::cout << "a[2] = " << a[2] << std::endl;
+    alloc.ReleaseArray(a);
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+/*!
+    \file memory_pmr.cpp
+    \brief Polymorphic memory resource adapters example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_arena.h"
+#include "memory/allocator_pmr.h"
+
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::ArenaMemoryManager<CppCommon::DefaultMemoryManager> manger(auxiliary);
+    CppCommon::MemoryManagerResource<CppCommon::ArenaMemoryManager<CppCommon::DefaultMemoryManager>> resource(manger);
+
+    {
+        std::pmr::vector<int> v(&resource);
+        v.push_back(1);
+        v.push_back(2);
+        v.push_back(3);
+        std::cout << "v = [" << v[0] << ", " << v[1] << ", " << v[2] << "]" << std::endl;
+        std::cout << "Arena allocated: " << manger.allocated() << std::endl;
+    }
+
+    return 0;
+}
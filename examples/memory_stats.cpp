@@ -0,0 +1,36 @@
+/*!
+    \file memory_stats.cpp
+    \brief Statistics memory allocator example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_stats.h"
+
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::StatsMemoryManager<CppCommon::DefaultMemoryManager> manger(auxiliary);
+    CppCommon::StatsAllocator<int, CppCommon::DefaultMemoryManager> alloc(manger);
+
+    {
+        std::vector<int, decltype(alloc)> v(alloc);
+        for (int i = 0; i < 1000; ++i)
+            v.push_back(i);
+    }
+
+    CppCommon::MemoryStats stats = manger.stats();
+    std::cout << "Allocated: " << stats.allocated << std::endl;
+    std::cout << "Peak: " << stats.peak << std::endl;
+    std::cout << "Total allocated: " << stats.total_allocated << std::endl;
+    std::cout << "Total allocations: " << stats.total_allocations << std::endl;
+    for (size_t i = 0; i < CppCommon::MemoryStats::Buckets; ++i)
+        if (stats.histogram[i] > 0)
+            std::cout << "Allocations up to " << ((size_t)1 << i) << " bytes: " << stats.histogram[i] << std::endl;
+
+    return 0;
+}
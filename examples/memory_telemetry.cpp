@@ -0,0 +1,37 @@
+/*!
+    \file memory_telemetry.cpp
+    \brief Process memory telemetry example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/memory_telemetry.h"
+
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::MemoryTelemetry telemetry;
+
+    // Allocate and touch some memory
+    std::vector<char> buffer(64 * 1024 * 1024, 1);
+
+    CppCommon::MemoryUsage usage = telemetry.Usage();
+    std::cout << "Total RAM: " << usage.ram_total << " bytes" << std::endl;
+    std::cout << "Free RAM: " << usage.ram_free << " bytes" << std::endl;
+    std::cout << "Resident memory: " << usage.rss << " bytes" << std::endl;
+    std::cout << "Proportional memory: " << usage.pss << " bytes" << std::endl;
+    std::cout << "Anonymous memory: " << usage.anonymous << " bytes" << std::endl;
+    std::cout << "File-backed memory: " << usage.file << " bytes" << std::endl;
+    std::cout << "Shared memory: " << usage.shmem << " bytes" << std::endl;
+    std::cout << "Swapped memory: " << usage.swap << " bytes" << std::endl;
+    std::cout << "Transparent huge pages: " << usage.huge_pages << " bytes" << std::endl;
+    std::cout << "HugeTLB pages: " << usage.hugetlb << " bytes" << std::endl;
+    std::cout << "Control group limit: " << usage.cgroup_limit << " bytes" << std::endl;
+    std::cout << "Control group usage: " << usage.cgroup_usage << " bytes" << std::endl;
+    std::cout << "Minor page faults: " << usage.minor_faults << std::endl;
+    std::cout << "Major page faults: " << usage.major_faults << std::endl;
+    return 0;
+}
@@ -0,0 +1,34 @@
+/*!
+    \file memory_thread_cache.cpp
+    \brief Thread cache memory allocator example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_thread_cache.h"
+
+#include <iostream>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::ThreadCacheMemoryManager<CppCommon::DefaultMemoryManager> manger(auxiliary);
+    CppCommon::ThreadCacheAllocator<int, CppCommon::DefaultMemoryManager> alloc(manger);
+
+    int* v = alloc.Create(123);
+    std::cout << "v = " << *v << std::endl;
+
+    // Release the value in another thread
+    std::thread thread([&alloc, v]() { alloc.Release(v); });
+    thread.join();
+
+    int* a = alloc.CreateArray(3, 123);
+    std::cout << "a[0] = " << a[0] << std::endl;
+    std::cout << "a[1] = " << a[1] << std::endl;
+    std::cout << "a[2] = " << a[2] << std::endl;
+    alloc.ReleaseArray(a);
+
+    return 0;
+}
@@ -0,0 +1,46 @@
+/*!
+    \file threads_async_event_auto_reset.cpp
+    \brief Coroutine auto-reset event synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_event_auto_reset.h"
+
+#include <iostream>
+#include <vector>
+
+CppCommon::Task<> Waiter(CppCommon::AsyncEventAutoReset& event, int index)
+{
+    std::cout << "Coroutine " << index << " waiting for the event!" << std::endl;
+
+    // Suspend the coroutine until the event is signaled
+    co_await event;
+
+    std::cout << "Coroutine " << index << " signaled!" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    int concurrency = 8;
+
+    CppCommon::AsyncEventAutoReset event;
+
+    // Start some coroutines suspended on the event
+    std::vector<CppCommon::Task<>> tasks;
+    for (int i = 0; i < concurrency; ++i)
+    {
+        tasks.emplace_back(Waiter(event, i));
+        tasks.back().Start();
+    }
+
+    // Signal the event for each coroutine
+    for (int i = 0; i < concurrency; ++i)
+    {
+        std::cout << "Signal event!" << std::endl;
+        event.Signal();
+    }
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*!
+    \file threads_async_event_manual_reset.cpp
+    \brief Coroutine manual-reset event synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_event_manual_reset.h"
+#include "threads/thread_pool.h"
+
+#include <iostream>
+#include <vector>
+
+CppCommon::Task<> Waiter(CppCommon::AsyncEventManualReset& event, CppCommon::Executor& executor, int index)
+{
+    std::cout << "Coroutine " << index << " waiting for the event!" << std::endl;
+
+    // Suspend the coroutine and resume it in the thread pool
+    co_await event.Wait(executor);
+
+    std::cout << "Coroutine " << index << " signaled in the worker " << CppCommon::ThreadPool::CurrentWorker() << "!" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    int concurrency = 8;
+
+    CppCommon::ThreadPool pool(4);
+    CppCommon::PoolExecutor<CppCommon::ThreadPool> executor(pool);
+
+    CppCommon::AsyncEventManualReset event;
+
+    // Start some coroutines suspended on the event
+    std::vector<CppCommon::Task<>> tasks;
+    for (int i = 0; i < concurrency; ++i)
+    {
+        tasks.emplace_back(Waiter(event, executor, i));
+        tasks.back().Start();
+    }
+
+    // Signal the event
+    std::cout << "Signal event!" << std::endl;
+    event.Signal();
+
+    // Wait for all coroutines
+    pool.Wait();
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*!
+    \file threads_async_latch.cpp
+    \brief Coroutine latch synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_latch.h"
+#include "threads/thread.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+CppCommon::Task<> Waiter(CppCommon::AsyncLatch& latch)
+{
+    std::cout << "Coroutine waiting for the latch!" << std::endl;
+
+    // Suspend the coroutine until the latch counter reaches zero
+    co_await latch;
+
+    std::cout << "Coroutine continued!" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    int concurrency = 8;
+
+    CppCommon::AsyncLatch latch(concurrency);
+
+    // Start the coroutine suspended on the latch
+    CppCommon::Task<> task = Waiter(latch);
+    task.Start();
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&latch, thread]()
+        {
+            std::cout << "Thread " << thread << " initialized!" << std::endl;
+
+            // Sleep for a while...
+            CppCommon::Thread::SleepFor(CppCommon::Timespan::milliseconds(thread * 10));
+
+            std::cout << "Thread " << thread << " count down the latch!" << std::endl;
+
+            // Count down the latch (the last thread resumes the coroutine)
+            latch.CountDown();
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
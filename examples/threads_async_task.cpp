@@ -0,0 +1,58 @@
+/*!
+    \file threads_async_task.cpp
+    \brief Coroutine task and executors example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_task.h"
+#include "threads/thread_pool.h"
+
+#include <iostream>
+
+// Awaiter which moves the coroutine into the given executor
+struct SwitchTo
+{
+    CppCommon::Executor& executor;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) { executor.Execute(handle); }
+    void await_resume() const noexcept {}
+};
+
+CppCommon::Task<int> Square(int value)
+{
+    co_return value * value;
+}
+
+CppCommon::Task<int> Calculate(CppCommon::Executor& executor)
+{
+    std::cout << "Coroutine started in the main thread" << std::endl;
+
+    // Continue in the thread pool
+    co_await SwitchTo{ executor };
+
+    std::cout << "Coroutine resumed in the thread pool worker " << CppCommon::ThreadPool::CurrentWorker() << std::endl;
+
+    // Await other coroutine tasks
+    int sum = 0;
+    for (int i = 1; i <= 10; ++i)
+        sum += co_await Square(i);
+
+    co_return sum;
+}
+
+int main(int argc, char** argv)
+{
+    // Create thread pool and its coroutine executor
+    CppCommon::ThreadPool pool(4);
+    CppCommon::PoolExecutor<CppCommon::ThreadPool> executor(pool);
+
+    // Wait for the coroutine task from the main thread
+    int result = CppCommon::SyncWait(Calculate(executor));
+
+    std::cout << "Sum of squares: " << result << std::endl;
+
+    return 0;
+}
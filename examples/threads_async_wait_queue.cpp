@@ -0,0 +1,50 @@
+/*!
+    \file threads_async_wait_queue.cpp
+    \brief Multiple producers / multiple consumers coroutine wait queue example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_wait_queue.h"
+
+#include <iostream>
+#include <string>
+
+CppCommon::Task<> Consumer(CppCommon::AsyncWaitQueue<int>& queue)
+{
+    int item;
+
+    // Dequeue items until the wait queue is closed
+    while (co_await queue.Dequeue(item))
+        std::cout << "Your entered number: " << item << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create multiple producers / multiple consumers coroutine wait queue
+    CppCommon::AsyncWaitQueue<int> queue;
+
+    // Start consumer coroutine
+    CppCommon::Task<> consumer = Consumer(queue);
+    consumer.Start();
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+        if (item == 0)
+            break;
+
+        // Enqueue the item (the suspended consumer is resumed inline)
+        CppCommon::SyncWait([](CppCommon::AsyncWaitQueue<int>& q, int i) -> CppCommon::Task<bool> { co_return co_await q.Enqueue(i); }(queue, item));
+    }
+
+    // Close the wait queue
+    queue.Close();
+
+    return 0;
+}
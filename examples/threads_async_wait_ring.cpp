@@ -0,0 +1,50 @@
+/*!
+    \file threads_async_wait_ring.cpp
+    \brief Multiple producers / multiple consumers coroutine wait ring example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_wait_ring.h"
+
+#include <iostream>
+#include <string>
+
+CppCommon::Task<> Consumer(CppCommon::AsyncWaitRing<int>& ring)
+{
+    int item;
+
+    // Dequeue items until the wait ring is closed
+    while (co_await ring.Dequeue(item))
+        std::cout << "Your entered number: " << item << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create multiple producers / multiple consumers coroutine wait ring
+    CppCommon::AsyncWaitRing<int> ring(1024);
+
+    // Start consumer coroutine
+    CppCommon::Task<> consumer = Consumer(ring);
+    consumer.Start();
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+        if (item == 0)
+            break;
+
+        // Enqueue the item (the suspended consumer is resumed inline)
+        CppCommon::SyncWait([](CppCommon::AsyncWaitRing<int>& q, int i) -> CppCommon::Task<bool> { co_return co_await q.Enqueue(i); }(ring, item));
+    }
+
+    // Close the wait ring
+    ring.Close();
+
+    return 0;
+}
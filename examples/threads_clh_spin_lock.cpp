@@ -0,0 +1,50 @@
+/*!
+    \file threads_clh_spin_lock.cpp
+    \brief CLH queue spin-lock synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/clh_spin_lock.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    CppCommon::CLHSpinLock lock;
+
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    // Start some threads
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&lock, &stop, thread]()
+        {
+            while (!stop)
+            {
+                // Use locker with spin-lock to protect the output
+                CppCommon::Locker<CppCommon::CLHSpinLock> locker(lock);
+
+                std::cout << "Random value from thread " << thread << ": " << rand() << std::endl;
+            }
+        });
+    }
+
+    // Wait for input
+    std::cin.get();
+
+    // Stop threads
+    stop = true;
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*!
+    \file threads_epoch_manager.cpp
+    \brief Epoch-based memory reclamation manager example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/epoch_manager.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct Item
+{
+    int value;
+    Item* next;
+};
+
+int main(int argc, char** argv)
+{
+    CppCommon::EpochManager manager;
+    std::atomic<Item*> top(nullptr);
+
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    // Start some threads which share the lock-free stack
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&manager, &top, &stop, thread]()
+        {
+            for (int i = 0; !stop; ++i)
+            {
+                // Push the item
+                Item* push = new Item{ i, top.load() };
+                while (!top.compare_exchange_weak(push->next, push));
+
+                int value = 0;
+
+                // Pop the item and access it inside the critical section
+                Item* item = nullptr;
+                {
+                    CppCommon::EpochManager::Guard guard(manager);
+                    item = top.load();
+                    while ((item != nullptr) && !top.compare_exchange_weak(item, item->next));
+                    if (item != nullptr)
+                        value = item->value;
+                }
+
+                // Retire the popped item
+                if (item != nullptr)
+                    manager.Retire(item);
+
+                if ((i % 100000) == 0)
+                    std::cout << "Thread " << thread << " popped value: " << value << std::endl;
+            }
+        });
+    }
+
+    // Wait for input
+    std::cin.get();
+
+    // Stop threads
+    stop = true;
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Free the rest of the stack
+    for (Item* item = top.load(); item != nullptr;)
+    {
+        Item* next = item->next;
+        delete item;
+        item = next;
+    }
+
+    return 0;
+}
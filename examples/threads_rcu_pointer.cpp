@@ -0,0 +1,71 @@
+/*!
+    \file threads_rcu_pointer.cpp
+    \brief RCU protected pointer example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/rcu_pointer.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::map<std::string, int> Config;
+
+int main(int argc, char** argv)
+{
+    CppCommon::EpochManager manager;
+    CppCommon::RCUPointer<Config> config(manager, std::make_unique<Config>(Config{ { "timeout", 0 } }));
+
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    // Start some readers threads
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&config, &stop, thread]()
+        {
+            int timeout = 0;
+            while (!stop)
+            {
+                // Read the current configuration without locks
+                auto current = config.Read();
+                if (current->at("timeout") != timeout)
+                {
+                    timeout = current->at("timeout");
+                    std::cout << "Thread " << thread << " read timeout: " << timeout << std::endl;
+                }
+            }
+        });
+    }
+
+    // Update the configuration until the input
+    std::thread writer([&config, &stop]()
+    {
+        for (int i = 1; !stop; ++i)
+        {
+            config.Modify([i](Config& value) { value["timeout"] = i; });
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+    });
+
+    // Wait for input
+    std::cin.get();
+
+    // Stop threads
+    stop = true;
+
+    // Wait for all threads
+    writer.join();
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
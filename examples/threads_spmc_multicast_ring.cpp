@@ -0,0 +1,73 @@
+/*!
+    \file threads_spmc_multicast_ring.cpp
+    \brief Single producer / multiple consumers wait-free multicast ring example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/spmc_multicast_ring.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create single producer / multiple consumers wait-free multicast ring
+    CppCommon::SPMCMulticastRing<int> ring(1024);
+
+    // Register the journal stage and the business logic stage which depends on it
+    size_t journal = ring.AddConsumer();
+    size_t logic = ring.AddConsumer({ journal });
+
+    // Start journal consumer thread
+    auto journaler = std::thread([&ring, journal]()
+    {
+        bool done = false;
+        while (!done)
+        {
+            // Consume a batch of items using yield waiting strategy
+            if (ring.Consume(journal, [&done](int& item) { std::cout << "Journal number: " << item << std::endl; done = (item == 0); }) == 0)
+                std::this_thread::yield();
+        }
+    });
+
+    // Start business logic consumer thread
+    auto processor = std::thread([&ring, logic]()
+    {
+        int item;
+
+        do
+        {
+            // Dequeue using yield waiting strategy
+            while (!ring.Dequeue(logic, item))
+                std::this_thread::yield();
+
+            // Consume the item
+            std::cout << "Your entered number: " << item << std::endl;
+        } while (item != 0);
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+
+        // Enqueue using yield waiting strategy
+        while (!ring.Enqueue(item))
+            std::this_thread::yield();
+
+        if (item == 0)
+            break;
+    }
+
+    // Wait for consumer threads
+    journaler.join();
+    processor.join();
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*!
+    \file threads_thread_pool.cpp
+    \brief Work-stealing thread pool example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+
+using namespace CppCommon;
+
+// Fork-join Fibonacci numbers calculation
+uint64_t Fibonacci(ThreadPool& pool, int n)
+{
+    if (n < 20)
+        return (n < 2) ? n : Fibonacci(pool, n - 1) + Fibonacci(pool, n - 2);
+
+    // Fork the child task and calculate the other half in the current worker
+    auto child = pool.Submit([&pool, n]() { return Fibonacci(pool, n - 1); });
+    uint64_t result = Fibonacci(pool, n - 2);
+
+    // Join the child task
+    return child.Get() + result;
+}
+
+int main(int argc, char** argv)
+{
+    // Create the work-stealing thread pool
+    ThreadPool pool;
+
+    std::cout << "Thread pool workers: " << pool.threads() << std::endl;
+
+    // Submit the fork-join task and get its result
+    auto fibonacci = pool.Submit([&pool]() { return Fibonacci(pool, 32); });
+    std::cout << "Fibonacci(32) = " << fibonacci.Get() << std::endl;
+
+    // Submit the task with continuations
+    auto future = pool.Submit([](int x) { return x * x; }, 12)
+        .Then([](int x) { return x + 1; })
+        .Then([](int x) { std::cout << "Continuation result: " << x << std::endl; });
+    future.Get();
+
+    // Exceptions are propagated through futures
+    auto failed = pool.Submit([]() -> int { throw std::runtime_error("Task failed!"); });
+    try
+    {
+        failed.Get();
+    }
+    catch (const std::exception& ex)
+    {
+        std::cout << "Task exception: " << ex.what() << std::endl;
+    }
+
+    // Post many tasks and wait for all of them
+    std::atomic<int> counter(0);
+    for (int i = 0; i < 1000; ++i)
+        pool.Post([&counter]() { ++counter; });
+    pool.Wait();
+    std::cout << "Posted tasks executed: " << counter << std::endl;
+
+    return 0;
+}
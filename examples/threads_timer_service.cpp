@@ -0,0 +1,44 @@
+/*!
+    \file threads_timer_service.cpp
+    \brief Timer service example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/timer_service.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter timeouts in milliseconds. Enter '0' to exit..." << std::endl;
+
+    // Create timer service with 1 millisecond resolution and start its dispatch thread
+    CppCommon::TimerService service(CppCommon::Timespan::milliseconds(1));
+    service.Start();
+
+    // Schedule periodic heartbeat timer
+    auto heartbeat = service.Schedule(CppCommon::Timespan::seconds(5), []() { std::cout << "Heartbeat!" << std::endl; }, CppCommon::Timespan::seconds(5));
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int timeout = std::stoi(line);
+        if (timeout <= 0)
+            break;
+
+        // Schedule one-shot timer
+        service.Schedule(CppCommon::Timespan::milliseconds(timeout), [timeout]() { std::cout << "Timer expired after " << timeout << " milliseconds" << std::endl; });
+
+        // Any user activity postpones the heartbeat
+        service.Reschedule(heartbeat, CppCommon::Timespan::seconds(5));
+    }
+
+    // Stop the dispatch thread
+    service.Stop();
+
+    return 0;
+}
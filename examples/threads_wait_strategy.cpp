@@ -0,0 +1,58 @@
+/*!
+    \file threads_wait_strategy.cpp
+    \brief Wait strategies for lock-free queues example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/spsc_ring_queue.h"
+#include "threads/wait_strategy.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create single producer / single consumer wait-free ring queue
+    CppCommon::SPSCRingQueue<int> queue(1024);
+
+    // Create spin-then-park wait strategy shared by the producer and the consumer
+    CppCommon::SpinParkWait strategy;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &strategy]()
+    {
+        int item;
+
+        do
+        {
+            // Dequeue the item or park until it is available
+            CppCommon::DequeueWait(queue, item, strategy);
+
+            // Consume the item
+            std::cout << "Your entered number: " << item << std::endl;
+        } while (item != 0);
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+
+        // Enqueue the item or park until the queue has free space
+        CppCommon::EnqueueWait(queue, item, strategy);
+
+        if (item == 0)
+            break;
+    }
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    return 0;
+}
@@ -23,12 +23,28 @@ namespace CppCommon {
     Arena memory manager is suitable for multiple allocations during long
     operations with a single reset at the end (e.g. HTTP request processing).
 
+    Nested phases of the long operation could release their temporary blocks
+    early with checkpoints: mark() saves the current arena position and
+    rewind() releases all blocks allocated after the mark at once. Arena pages
+    allocated after the mark are not returned to the auxiliary memory manager,
+    but retained and reused by the following allocations. ArenaMemoryScope
+    provides the same with RAII style.
+
     Not thread-safe.
 */
 template <class TAuxMemoryManager = DefaultMemoryManager>
 class ArenaMemoryManager
 {
 public:
+    //! Arena checkpoint mark
+    struct Mark
+    {
+        void* page;
+        size_t size;
+        size_t allocated;
+        size_t allocations;
+    };
+
     //! Initialize arena memory manager with an auxiliary memory manager
     /*!
         Arena page capacity will be 65536.
@@ -67,6 +83,8 @@ public:
     size_t capacity() const noexcept { return _capacity; }
     //! Arena allocated size
     size_t size() const noexcept { return _size; }
+    //! Count of retained arena pages
+    size_t retained() const noexcept { return _retained_count; }
 
     //! Maximum memory block size, that could be allocated by the memory manager
     size_t max_size() const noexcept { return _auxiliary.max_size(); }
@@ -88,6 +106,27 @@ public:
     */
     void free(void* ptr, size_t size);
 
+    //! Mark the current arena position
+    /*!
+        \return Arena checkpoint mark
+    */
+    Mark mark() const noexcept;
+    //! Rewind the arena to the given checkpoint mark
+    /*!
+        All blocks allocated in the arena after the mark are released at once.
+        They could be also freed individually before the rewind (e.g. by
+        containers which grow their storage). Arena pages allocated after the
+        mark are retained for the following allocations. Blocks allocated in
+        the arena before the mark must not be freed until rewind.
+
+        In case of external buffer blocks that did not fit into the buffer
+        are allocated in the auxiliary memory manager and must be freed
+        individually.
+
+        \param mark - Arena checkpoint mark
+    */
+    void rewind(const Mark& mark);
+
     //! Reset the memory manager
     void reset();
     //! Reset the memory manager with a given page capacity
@@ -119,6 +158,10 @@ private:
     size_t _allocated;
     size_t _allocations;
 
+    // Arena allocation statistics
+    size_t _arena_allocated;
+    size_t _arena_allocations;
+
     // Auxiliary memory manager
     TAuxMemoryManager& _auxiliary;
 
@@ -126,6 +169,10 @@ private:
     Page* _current;
     size_t _reserved;
 
+    // Retained arena pages
+    Page* _retained;
+    size_t _retained_count;
+
     // External buffer
     bool _external;
     uint8_t* _buffer;
@@ -134,10 +181,40 @@ private:
 
     //! Allocate arena
     Page* AllocateArena(size_t capacity, Page* prev);
+    //! Reuse the retained arena page with enough capacity
+    Page* ReuseArena(size_t capacity, Page* prev);
     //! Clear arena
     void ClearArena();
 };
 
+//! Arena memory scope class
+/*!
+    Arena memory scope marks the arena position on construction and rewinds
+    the arena to the mark on destruction.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ArenaMemoryScope
+{
+public:
+    //! Mark the given arena memory manager
+    /*!
+        \param manager - Arena memory manager
+    */
+    explicit ArenaMemoryScope(ArenaMemoryManager<TAuxMemoryManager>& manager) : _manager(manager), _mark(manager.mark()) {}
+    ArenaMemoryScope(const ArenaMemoryScope&) = delete;
+    ArenaMemoryScope(ArenaMemoryScope&&) = delete;
+    ~ArenaMemoryScope() { _manager.rewind(_mark); }
+
+    ArenaMemoryScope& operator=(const ArenaMemoryScope&) = delete;
+    ArenaMemoryScope& operator=(ArenaMemoryScope&&) = delete;
+
+private:
+    ArenaMemoryManager<TAuxMemoryManager>& _manager;
+    typename ArenaMemoryManager<TAuxMemoryManager>::Mark _mark;
+};
+
 //! Arena memory allocator class
 template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
 using ArenaAllocator = Allocator<T, ArenaMemoryManager<TAuxMemoryManager>, nothrow>;
@@ -12,9 +12,13 @@ template <class TAuxMemoryManager>
 inline ArenaMemoryManager<TAuxMemoryManager>::ArenaMemoryManager(TAuxMemoryManager& auxiliary, size_t capacity)
     : _allocated(0),
       _allocations(0),
+      _arena_allocated(0),
+      _arena_allocations(0),
       _auxiliary(auxiliary),
       _current(nullptr),
       _reserved(0),
+      _retained(nullptr),
+      _retained_count(0),
       _external(false),
       _buffer(nullptr),
       _capacity(0),
@@ -27,9 +31,13 @@ template <class TAuxMemoryManager>
 inline ArenaMemoryManager<TAuxMemoryManager>::ArenaMemoryManager(TAuxMemoryManager& auxiliary, void* buffer, size_t capacity)
     : _allocated(0),
       _allocations(0),
+      _arena_allocated(0),
+      _arena_allocations(0),
       _auxiliary(auxiliary),
       _current(nullptr),
       _reserved(0),
+      _retained(nullptr),
+      _retained_count(0),
       _external(true),
       _buffer(nullptr),
       _capacity(0),
@@ -60,6 +68,8 @@ inline void* ArenaMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t a
             // Update allocation statistics
             _allocated += size;
             ++_allocations;
+            _arena_allocated += size;
+            ++_arena_allocations;
 
             return aligned;
         }
@@ -95,26 +105,36 @@ inline void* ArenaMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t a
                 // Update allocation statistics
                 _allocated += size;
                 ++_allocations;
+                _arena_allocated += size;
+                ++_arena_allocations;
 
                 return aligned;
             }
         }
 
-        // Increase the required reserved memory size
-        size_t next_reserved = 2 * _reserved;
-        while (next_reserved < size)
-            next_reserved *= 2;
+        // Reuse the retained arena page
+        Page* current = ReuseArena(size + alignment, _current);
+        if (current == nullptr)
+        {
+            // Increase the required reserved memory size
+            size_t next_reserved = 2 * _reserved;
+            while (next_reserved < size)
+                next_reserved *= 2;
+
+            // Allocate a new arena page
+            current = AllocateArena(next_reserved, _current);
+            if (current != nullptr)
+            {
+                // Increase the required reserved memory size
+                _reserved = next_reserved;
+            }
+        }
 
-        // Allocate a new arena page
-        Page* current = AllocateArena(next_reserved, _current);
         if (current != nullptr)
         {
             // Update the current arena page
             _current = current;
 
-            // Increase the required reserved memory size
-            _reserved = next_reserved;
-
             // Allocate memory from the current arena page
             uint8_t* buffer = _current->buffer + _current->size;
             uint8_t* aligned = Memory::Align(buffer, alignment);
@@ -126,6 +146,8 @@ inline void* ArenaMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t a
             // Update allocation statistics
             _allocated += size;
             ++_allocations;
+            _arena_allocated += size;
+            ++_arena_allocations;
 
             return aligned;
         }
@@ -140,22 +162,69 @@ inline void ArenaMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
 {
     assert((ptr != nullptr) && "Deallocated block must be valid!");
 
+    // Check if the memory block was allocated in the arena
+    bool arena = _external ? ((ptr >= _buffer) && (ptr < (_buffer + _size))) : (_current != nullptr);
+
+    // Free memory block in auxiliary memory manager
+    if (!arena)
+        _auxiliary.free(ptr, size);
+
+    // Update allocation statistics
+    _allocated -= size;
+    --_allocations;
+    if (arena)
+    {
+        // Keep arena statistics in sync, so rewind will not release the block twice
+        _arena_allocated -= size;
+        --_arena_allocations;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline typename ArenaMemoryManager<TAuxMemoryManager>::Mark ArenaMemoryManager<TAuxMemoryManager>::mark() const noexcept
+{
+    Mark result;
+    result.page = _current;
+    result.size = _external ? _size : ((_current != nullptr) ? _current->size : 0);
+    result.allocated = _arena_allocated;
+    result.allocations = _arena_allocations;
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void ArenaMemoryManager<TAuxMemoryManager>::rewind(const Mark& mark)
+{
+    assert((_arena_allocated >= mark.allocated) && (_arena_allocations >= mark.allocations) && "Invalid arena checkpoint mark!");
+
     if (_external)
     {
-        // Free memory block in auxiliary memory manager
-        if ((ptr < _buffer) || (ptr >= (_buffer + _size)))
-            _auxiliary.free(ptr, size);
+        // Rewind the external buffer
+        _size = mark.size;
     }
     else
     {
-        // Free memory block in auxiliary memory manager
-        if (_current == nullptr)
-            _auxiliary.free(ptr, size);
+        // Retain all arena pages allocated after the mark
+        while ((_current != nullptr) && (_current != mark.page))
+        {
+            Page* prev = _current->prev;
+            _current->prev = _retained;
+            _retained = _current;
+            ++_retained_count;
+            _current = prev;
+        }
+
+        assert((_current == mark.page) && "Invalid arena checkpoint mark!");
+
+        // Rewind the current arena page
+        if (_current != nullptr)
+            _current->size = mark.size;
     }
 
-    // Update allocation statistics
-    _allocated -= size;
-    --_allocations;
+    // Release all blocks allocated after the mark
+    _allocated -= _arena_allocated - mark.allocated;
+    _allocations -= _arena_allocations - mark.allocations;
+    _arena_allocated = mark.allocated;
+    _arena_allocations = mark.allocations;
 }
 
 template <class TAuxMemoryManager>
@@ -222,6 +291,10 @@ inline void ArenaMemoryManager<TAuxMemoryManager>::clear()
     // Clear arena
     ClearArena();
 
+    // Clear arena allocation statistics
+    _arena_allocated = 0;
+    _arena_allocations = 0;
+
     // Clear external buffer
     _external = false;
     _buffer = nullptr;
@@ -249,6 +322,33 @@ inline typename ArenaMemoryManager<TAuxMemoryManager>::Page* ArenaMemoryManager<
     return nullptr;
 }
 
+template <class TAuxMemoryManager>
+inline typename ArenaMemoryManager<TAuxMemoryManager>::Page* ArenaMemoryManager<TAuxMemoryManager>::ReuseArena(size_t capacity, Page* prev)
+{
+    // Find the retained arena page with enough capacity
+    Page* before = nullptr;
+    for (Page* page = _retained; page != nullptr; before = page, page = page->prev)
+    {
+        if (page->capacity >= capacity)
+        {
+            // Remove the page from the retained arena pages list
+            if (before != nullptr)
+                before->prev = page->prev;
+            else
+                _retained = page->prev;
+            --_retained_count;
+
+            // Prepare and return the reused arena page
+            page->size = 0;
+            page->prev = prev;
+            return page;
+        }
+    }
+
+    // No suitable retained arena page...
+    return nullptr;
+}
+
 template <class TAuxMemoryManager>
 inline void ArenaMemoryManager<TAuxMemoryManager>::ClearArena()
 {
@@ -262,6 +362,15 @@ inline void ArenaMemoryManager<TAuxMemoryManager>::ClearArena()
             _current = prev;
         }
     }
+
+    // Clear all retained arena pages
+    while (_retained != nullptr)
+    {
+        Page* prev = _retained->prev;
+        _auxiliary.free(_retained, sizeof(Page) + _retained->capacity + alignof(std::max_align_t));
+        _retained = prev;
+    }
+    _retained_count = 0;
 }
 
 } // namespace CppCommon
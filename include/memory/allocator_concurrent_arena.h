@@ -0,0 +1,213 @@
+/*!
+    \file allocator_concurrent_arena.h
+    \brief Concurrent arena memory allocator definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_CONCURRENT_ARENA_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_CONCURRENT_ARENA_H
+
+#include "allocator.h"
+
+#include "threads/spin_lock.h"
+#include "threads/thread.h"
+
+#include <atomic>
+
+namespace CppCommon {
+
+//! Concurrent arena memory manager class
+/*!
+    Concurrent arena memory manager allows many threads to bump-allocate
+    memory blocks from the shared arena. Allocation from the current arena
+    page is a single atomic fetch-add operation. When the current page is
+    exhausted a new page is allocated from the auxiliary memory manager and
+    published as the current one with an atomic pointer swap, so only
+    threads that hit the page end are serialized with a spin-lock which
+    protects the (not thread-safe) auxiliary memory manager.
+
+    Blocks that do not fit into the arena page are allocated in dedicated
+    pages which are released on reset. Deallocation of a single block only
+    updates allocation statistics.
+
+    Arena pages are reused with an epoch-style reset: users of the arena
+    enter and leave it (see ConcurrentArenaScope), and reset() requested
+    during active users is deferred until the last user leaves. Each reset
+    increments the arena epoch.
+
+    Concurrent arena memory manager is suitable for fan-out parallel stages
+    that share the same scratch memory (e.g. parallel request processing).
+
+    Thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ConcurrentArenaMemoryManager
+{
+public:
+    //! Initialize concurrent arena memory manager with an auxiliary memory manager
+    /*!
+        Arena page capacity will be 65536.
+
+        \param auxiliary - Auxiliary memory manager
+    */
+    explicit ConcurrentArenaMemoryManager(TAuxMemoryManager& auxiliary) : ConcurrentArenaMemoryManager(auxiliary, 65536) {}
+    //! Initialize concurrent arena memory manager with an auxiliary memory manager and a given page capacity
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param capacity - Arena page capacity in bytes
+    */
+    explicit ConcurrentArenaMemoryManager(TAuxMemoryManager& auxiliary, size_t capacity);
+    ConcurrentArenaMemoryManager(const ConcurrentArenaMemoryManager&) = delete;
+    ConcurrentArenaMemoryManager(ConcurrentArenaMemoryManager&&) = delete;
+    ~ConcurrentArenaMemoryManager() { clear(); }
+
+    ConcurrentArenaMemoryManager& operator=(const ConcurrentArenaMemoryManager&) = delete;
+    ConcurrentArenaMemoryManager& operator=(ConcurrentArenaMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated.load(std::memory_order_relaxed); }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations.load(std::memory_order_relaxed); }
+
+    //! Arena page capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Count of allocated arena pages
+    size_t pages() const noexcept { return _pages.load(std::memory_order_relaxed); }
+    //! Arena epoch (incremented on each reset)
+    uint64_t epoch() const noexcept { return _epoch.load(std::memory_order_acquire); }
+    //! Count of active arena users
+    size_t users() const noexcept;
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _auxiliary.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _auxiliary; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Enter the arena as a new user
+    /*!
+        Waits if the arena is being reset at the moment.
+    */
+    void enter();
+    //! Leave the arena
+    /*!
+        The last leaving user performs the deferred reset.
+    */
+    void leave();
+
+    //! Reset the memory manager
+    /*!
+        If there are active arena users the reset is deferred until the last
+        user leaves the arena.
+
+        \return 'true' if the arena was reset immediately, 'false' if the reset was deferred
+    */
+    bool reset();
+
+    //! Clear concurrent arena memory allocator
+    /*!
+        Must not be called concurrently with other arena operations.
+    */
+    void clear();
+
+private:
+    // Arena page
+    struct Page
+    {
+        std::atomic<size_t> size;
+        size_t capacity;
+        Page* prev;
+
+        uint8_t* buffer() noexcept { return (uint8_t*)this + Header; }
+    };
+
+    // Page header size keeps the page buffer aligned
+    static const size_t Header = (sizeof(Page) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    // Arena users value during the reset
+    static const int64_t Resetting = -1;
+
+    // Allocation statistics
+    std::atomic<size_t> _allocated;
+    std::atomic<size_t> _allocations;
+
+    // Auxiliary memory manager
+    TAuxMemoryManager& _auxiliary;
+    SpinLock _lock;
+
+    // Arena pages
+    size_t _capacity;
+    std::atomic<Page*> _current;
+    std::atomic<size_t> _pages;
+    Page* _dedicated;
+
+    // Arena epoch
+    std::atomic<int64_t> _users;
+    std::atomic<bool> _pending;
+    std::atomic<uint64_t> _epoch;
+
+    //! Allocate a new arena page if the observed one is still the current
+    bool AllocatePage(Page* observed);
+    //! Allocate a dedicated arena page for the huge block
+    void* AllocateDedicated(size_t size, size_t alignment);
+    //! Try to perform the pending reset if there are no active users
+    bool TryReset();
+    //! Reset arena pages
+    void ResetPages();
+    //! Release the arena pages list
+    void ReleasePages(Page* page);
+};
+
+//! Concurrent arena scope class
+/*!
+    Concurrent arena scope enters the arena on construction and leaves it
+    on destruction.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ConcurrentArenaScope
+{
+public:
+    //! Enter the given concurrent arena memory manager
+    /*!
+        \param manager - Concurrent arena memory manager
+    */
+    explicit ConcurrentArenaScope(ConcurrentArenaMemoryManager<TAuxMemoryManager>& manager) : _manager(manager) { _manager.enter(); }
+    ConcurrentArenaScope(const ConcurrentArenaScope&) = delete;
+    ConcurrentArenaScope(ConcurrentArenaScope&&) = delete;
+    ~ConcurrentArenaScope() { _manager.leave(); }
+
+    ConcurrentArenaScope& operator=(const ConcurrentArenaScope&) = delete;
+    ConcurrentArenaScope& operator=(ConcurrentArenaScope&&) = delete;
+
+private:
+    ConcurrentArenaMemoryManager<TAuxMemoryManager>& _manager;
+};
+
+//! Concurrent arena memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using ConcurrentArenaAllocator = Allocator<T, ConcurrentArenaMemoryManager<TAuxMemoryManager>, nothrow>;
+
+/*! \example memory_concurrent_arena.cpp Concurrent arena memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_concurrent_arena.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_CONCURRENT_ARENA_H
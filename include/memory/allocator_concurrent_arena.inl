@@ -0,0 +1,252 @@
+/*!
+    \file allocator_concurrent_arena.inl
+    \brief Concurrent arena memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TAuxMemoryManager>
+inline ConcurrentArenaMemoryManager<TAuxMemoryManager>::ConcurrentArenaMemoryManager(TAuxMemoryManager& auxiliary, size_t capacity)
+    : _allocated(0),
+      _allocations(0),
+      _auxiliary(auxiliary),
+      _capacity(capacity),
+      _current(nullptr),
+      _pages(0),
+      _dedicated(nullptr),
+      _users(0),
+      _pending(false),
+      _epoch(0)
+{
+    assert((capacity > 0) && "Arena capacity must be greater than zero!");
+}
+
+template <class TAuxMemoryManager>
+inline size_t ConcurrentArenaMemoryManager<TAuxMemoryManager>::users() const noexcept
+{
+    int64_t users = _users.load(std::memory_order_acquire);
+    return (users > 0) ? (size_t)users : 0;
+}
+
+template <class TAuxMemoryManager>
+inline void* ConcurrentArenaMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    // Keep all arena offsets aligned to the fundamental alignment, so only extended alignment requires padding.
+    // The padded size of extended alignment blocks is rounded too, otherwise the next block would be misaligned.
+    const size_t fundamental = alignof(std::max_align_t);
+    size_t required = (alignment <= fundamental) ? size : (size + alignment - 1);
+    required = (required + fundamental - 1) & ~(fundamental - 1);
+
+    // Allocate huge blocks in dedicated pages
+    if (required > _capacity)
+        return AllocateDedicated(size, alignment);
+
+    for (;;)
+    {
+        Page* page = _current.load(std::memory_order_acquire);
+        if (page != nullptr)
+        {
+            // Bump-allocate memory from the current arena page
+            size_t offset = page->size.fetch_add(required, std::memory_order_relaxed);
+            if ((offset + required) <= page->capacity)
+            {
+                // Update allocation statistics
+                _allocated.fetch_add(size, std::memory_order_relaxed);
+                _allocations.fetch_add(1, std::memory_order_relaxed);
+
+                return Memory::Align(page->buffer() + offset, alignment);
+            }
+        }
+
+        // The current arena page is exhausted...
+        if (!AllocatePage(page))
+        {
+            // Out of memory...
+            return nullptr;
+        }
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentArenaMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    // Update allocation statistics
+    _allocated.fetch_sub(size, std::memory_order_relaxed);
+    _allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentArenaMemoryManager<TAuxMemoryManager>::enter()
+{
+    for (;;)
+    {
+        int64_t users = _users.load(std::memory_order_acquire);
+        if (users == Resetting)
+        {
+            // Wait for the reset to finish
+            Thread::Yield();
+            continue;
+        }
+        if (_users.compare_exchange_weak(users, users + 1, std::memory_order_acq_rel))
+            return;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentArenaMemoryManager<TAuxMemoryManager>::leave()
+{
+    assert((_users.load(std::memory_order_relaxed) > 0) && "Arena must be entered before leaving!");
+
+    // The last leaving user performs the deferred reset
+    if (_users.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        TryReset();
+}
+
+template <class TAuxMemoryManager>
+inline bool ConcurrentArenaMemoryManager<TAuxMemoryManager>::reset()
+{
+    _pending.store(true, std::memory_order_release);
+    return TryReset();
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentArenaMemoryManager<TAuxMemoryManager>::clear()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+    assert((_users == 0) && "Arena must not have active users!");
+
+    Locker<SpinLock> locker(_lock);
+
+    // Release all arena pages
+    ReleasePages(_current.exchange(nullptr, std::memory_order_acq_rel));
+    ReleasePages(_dedicated);
+    _dedicated = nullptr;
+    _pages.store(0, std::memory_order_relaxed);
+    _pending.store(false, std::memory_order_relaxed);
+}
+
+template <class TAuxMemoryManager>
+inline bool ConcurrentArenaMemoryManager<TAuxMemoryManager>::AllocatePage(Page* observed)
+{
+    Locker<SpinLock> locker(_lock);
+
+    // Another thread has already published a new arena page
+    if (_current.load(std::memory_order_acquire) != observed)
+        return true;
+
+    // Allocate a new arena page
+    void* buffer = _auxiliary.malloc(Header + _capacity);
+    if (buffer == nullptr)
+        return false;
+
+    Page* page = new (buffer) Page();
+    page->size.store(0, std::memory_order_relaxed);
+    page->capacity = _capacity;
+    page->prev = observed;
+
+    // Publish the new arena page
+    _current.store(page, std::memory_order_release);
+    _pages.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+template <class TAuxMemoryManager>
+inline void* ConcurrentArenaMemoryManager<TAuxMemoryManager>::AllocateDedicated(size_t size, size_t alignment)
+{
+    Locker<SpinLock> locker(_lock);
+
+    // Allocate a new dedicated arena page
+    size_t capacity = size + alignment - 1;
+    void* buffer = _auxiliary.malloc(Header + capacity);
+    if (buffer == nullptr)
+        return nullptr;
+
+    Page* page = new (buffer) Page();
+    page->size.store(capacity, std::memory_order_relaxed);
+    page->capacity = capacity;
+    page->prev = _dedicated;
+    _dedicated = page;
+    _pages.fetch_add(1, std::memory_order_relaxed);
+
+    // Update allocation statistics
+    _allocated.fetch_add(size, std::memory_order_relaxed);
+    _allocations.fetch_add(1, std::memory_order_relaxed);
+
+    return Memory::Align(page->buffer(), alignment);
+}
+
+template <class TAuxMemoryManager>
+inline bool ConcurrentArenaMemoryManager<TAuxMemoryManager>::TryReset()
+{
+    if (!_pending.load(std::memory_order_acquire))
+        return false;
+
+    // Block new arena users during the reset
+    int64_t users = 0;
+    if (!_users.compare_exchange_strong(users, Resetting, std::memory_order_acq_rel))
+        return false;
+
+    bool result = false;
+    if (_pending.exchange(false, std::memory_order_acq_rel))
+    {
+        ResetPages();
+        result = true;
+    }
+
+    // Allow new arena users
+    _users.store(0, std::memory_order_release);
+
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentArenaMemoryManager<TAuxMemoryManager>::ResetPages()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    Locker<SpinLock> locker(_lock);
+
+    // Keep only the current arena page
+    Page* current = _current.load(std::memory_order_relaxed);
+    if (current != nullptr)
+    {
+        ReleasePages(current->prev);
+        current->prev = nullptr;
+        current->size.store(0, std::memory_order_relaxed);
+    }
+
+    // Release dedicated arena pages
+    ReleasePages(_dedicated);
+    _dedicated = nullptr;
+
+    _pages.store((current != nullptr) ? 1 : 0, std::memory_order_relaxed);
+
+    // Start a new arena epoch
+    _epoch.fetch_add(1, std::memory_order_release);
+}
+
+template <class TAuxMemoryManager>
+inline void ConcurrentArenaMemoryManager<TAuxMemoryManager>::ReleasePages(Page* page)
+{
+    while (page != nullptr)
+    {
+        Page* prev = page->prev;
+        size_t capacity = page->capacity;
+        page->~Page();
+        _auxiliary.free(page, Header + capacity);
+        page = prev;
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,137 @@
+/*!
+    \file allocator_page.h
+    \brief Page memory allocator definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_PAGE_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_PAGE_H
+
+#include "allocator.h"
+
+#include "common/flags.h"
+
+namespace CppCommon {
+
+//! Page memory flags
+enum class PageFlags
+{
+    NONE        = 0x00, //!< None
+    HUGEPAGES   = 0x01, //!< Map explicit huge pages (Linux: MAP_HUGETLB, Windows: MEM_LARGE_PAGES)
+    TRANSPARENT = 0x02, //!< Advise transparent huge pages (Linux: MADV_HUGEPAGE)
+    POPULATE    = 0x04  //!< Prefault all pages during the allocation
+};
+
+//! Page memory manager class
+/*!
+    Page memory manager maps memory blocks directly from the operating system
+    with a page granularity. It is designed to be used as an auxiliary memory
+    manager for arena, pool and slab memory managers with big pages.
+
+    Explicit huge pages are used if the corresponding flag is set. If huge
+    pages are not available (e.g. not reserved in the system) the memory
+    manager gracefully falls back to regular pages with transparent huge
+    pages advice. Block sizes are always rounded to the huge page size in
+    this mode, so choose arena and pool page sizes close to the multiple of
+    the huge page size.
+
+    If NUMA node is provided all mapped pages will be bound to the given
+    NUMA node with a preferred policy (Linux: mbind(), Windows:
+    VirtualAllocExNuma()). Otherwise pages are placed with the default first
+    touch policy, so prefaulting pages with the populate flag places them on
+    the NUMA node of the allocating thread.
+
+    Not thread-safe.
+*/
+class PageMemoryManager
+{
+public:
+    //! Initialize page memory manager with the given flags and NUMA node
+    /*!
+        \param flags - Page memory flags (default is PageFlags::NONE)
+        \param node - NUMA node to bind mapped pages. Negative value means no binding (default is -1)
+    */
+    explicit PageMemoryManager(Flags<PageFlags> flags = PageFlags::NONE, int node = -1);
+    PageMemoryManager(const PageMemoryManager&) = delete;
+    PageMemoryManager(PageMemoryManager&&) = delete;
+    ~PageMemoryManager() noexcept { reset(); }
+
+    PageMemoryManager& operator=(const PageMemoryManager&) = delete;
+    PageMemoryManager& operator=(PageMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+    //! Count of allocations which fell back from explicit huge pages to regular pages
+    size_t fallbacks() const noexcept { return _fallbacks; }
+
+    //! Page memory flags
+    Flags<PageFlags> flags() const noexcept { return _flags; }
+    //! NUMA node
+    int node() const noexcept { return _node; }
+    //! Page granularity of memory blocks in bytes
+    size_t granularity() const noexcept { return _granularity; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return std::numeric_limits<size_t>::max() - _granularity; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+    //! Get the system page size in bytes
+    static size_t PageSize() noexcept;
+    //! Get the system huge page size in bytes
+    /*!
+        \return Huge page size in bytes or zero if huge pages are not supported
+    */
+    static size_t HugePageSize() noexcept;
+
+private:
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+    size_t _fallbacks;
+
+    // Page settings
+    Flags<PageFlags> _flags;
+    int _node;
+    size_t _granularity;
+
+    //! Map memory pages from the operating system
+    void* MapPages(size_t length, size_t alignment);
+    //! Unmap memory pages
+    void UnmapPages(void* ptr, size_t length);
+
+    //! Calculate the mapped length of the given block size
+    size_t MappedLength(size_t size) const noexcept
+    { return ((size + _granularity - 1) / _granularity) * _granularity; }
+};
+
+//! Page memory allocator class
+template <typename T, bool nothrow = false>
+using PageAllocator = Allocator<T, PageMemoryManager, nothrow>;
+
+/*! \example memory_page.cpp Page memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_page.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_PAGE_H
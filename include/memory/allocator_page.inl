@@ -0,0 +1,48 @@
+/*!
+    \file allocator_page.inl
+    \brief Page memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+ENUM_FLAGS(CppCommon::PageFlags)
+
+namespace CppCommon {
+
+inline void* PageMemoryManager::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    void* result = MapPages(MappedLength(size), alignment);
+    if (result != nullptr)
+    {
+        // Update allocation statistics
+        _allocated += size;
+        ++_allocations;
+    }
+    return result;
+}
+
+inline void PageMemoryManager::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+        UnmapPages(ptr, MappedLength(size));
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+    }
+}
+
+inline void PageMemoryManager::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+} // namespace CppCommon
@@ -0,0 +1,136 @@
+/*!
+    \file allocator_pmr.h
+    \brief Polymorphic memory resource adapters definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_PMR_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_PMR_H
+
+#include "allocator.h"
+
+#include <memory_resource>
+
+namespace CppCommon {
+
+//! Memory manager resource class
+/*!
+    Memory manager resource adapts any memory manager (default, heap, arena,
+    pool, stack, null, etc.) to the standard polymorphic memory resource
+    interface. It allows to use memory managers with std::pmr containers
+    without changing container types.
+
+    In case of allocation failed std::bad_alloc exception will be thrown
+    as required by the std::pmr::memory_resource interface.
+
+    Thread-safe if the adapted memory manager is thread-safe.
+*/
+template <class TMemoryManager>
+class MemoryManagerResource : public std::pmr::memory_resource
+{
+public:
+    //! Initialize memory manager resource with an adapted memory manager
+    /*!
+        \param manager - Adapted memory manager
+    */
+    explicit MemoryManagerResource(TMemoryManager& manager) noexcept : _manager(manager) {}
+    MemoryManagerResource(const MemoryManagerResource&) = delete;
+    MemoryManagerResource(MemoryManagerResource&&) = delete;
+    ~MemoryManagerResource() override = default;
+
+    MemoryManagerResource& operator=(const MemoryManagerResource&) = delete;
+    MemoryManagerResource& operator=(MemoryManagerResource&&) = delete;
+
+    //! Adapted memory manager
+    TMemoryManager& manager() noexcept { return _manager; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    TMemoryManager& _manager;
+};
+
+//! Memory resource manager class
+/*!
+    Memory resource manager adapts any standard polymorphic memory resource
+    (e.g. std::pmr::monotonic_buffer_resource, std::pmr::unsynchronized_pool_resource)
+    to the memory manager interface. It allows to use memory resources with
+    memory allocators and as an auxiliary memory manager of arena, pool and
+    other memory managers.
+
+    All blocks are allocated with the fundamental alignment, because
+    the memory resource requires the same alignment for deallocation.
+    Extended alignment is not supported.
+
+    Not thread-safe.
+*/
+class MemoryResourceManager
+{
+public:
+    //! Initialize memory resource manager with the default memory resource
+    MemoryResourceManager() noexcept : MemoryResourceManager(std::pmr::get_default_resource()) {}
+    //! Initialize memory resource manager with an adapted memory resource
+    /*!
+        \param resource - Adapted memory resource
+    */
+    explicit MemoryResourceManager(std::pmr::memory_resource* resource) noexcept : _allocated(0), _allocations(0), _resource(resource) {}
+    MemoryResourceManager(const MemoryResourceManager&) = delete;
+    MemoryResourceManager(MemoryResourceManager&&) = delete;
+    ~MemoryResourceManager() noexcept { reset(); }
+
+    MemoryResourceManager& operator=(const MemoryResourceManager&) = delete;
+    MemoryResourceManager& operator=(MemoryResourceManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return std::numeric_limits<size_t>::max(); }
+
+    //! Adapted memory resource
+    std::pmr::memory_resource* resource() const noexcept { return _resource; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+private:
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // Adapted memory resource
+    std::pmr::memory_resource* _resource;
+};
+
+//! Memory resource allocator class
+template <typename T, bool nothrow = false>
+using MemoryResourceAllocator = Allocator<T, MemoryResourceManager, nothrow>;
+
+/*! \example memory_pmr.cpp Polymorphic memory resource adapters example */
+
+} // namespace CppCommon
+
+#include "allocator_pmr.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_PMR_H
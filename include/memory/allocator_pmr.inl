@@ -0,0 +1,81 @@
+/*!
+    \file allocator_pmr.inl
+    \brief Polymorphic memory resource adapters inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TMemoryManager>
+inline void* MemoryManagerResource<TMemoryManager>::do_allocate(size_t bytes, size_t alignment)
+{
+    // Memory managers do not support zero sized blocks
+    void* result = _manager.malloc((bytes > 0) ? bytes : 1, alignment);
+    if (result == nullptr)
+        throw std::bad_alloc();
+    return result;
+}
+
+template <class TMemoryManager>
+inline void MemoryManagerResource<TMemoryManager>::do_deallocate(void* ptr, size_t bytes, size_t alignment)
+{
+    _manager.free(ptr, (bytes > 0) ? bytes : 1);
+}
+
+template <class TMemoryManager>
+inline bool MemoryManagerResource<TMemoryManager>::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    if (this == &other)
+        return true;
+
+    // Memory resources are equal if they adapt the same memory manager
+    const MemoryManagerResource<TMemoryManager>* resource = dynamic_cast<const MemoryManagerResource<TMemoryManager>*>(&other);
+    return (resource != nullptr) && (&resource->_manager == &_manager);
+}
+
+inline void* MemoryResourceManager::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+    assert((alignment <= alignof(std::max_align_t)) && "Extended alignment is not supported by the memory resource manager!");
+
+    try
+    {
+        void* result = _resource->allocate(size, alignof(std::max_align_t));
+
+        // Update allocation statistics
+        _allocated += size;
+        ++_allocations;
+
+        return result;
+    }
+    catch (const std::bad_alloc&)
+    {
+        // Out of memory...
+        return nullptr;
+    }
+}
+
+inline void MemoryResourceManager::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+        _resource->deallocate(ptr, size, alignof(std::max_align_t));
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+    }
+}
+
+inline void MemoryResourceManager::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+} // namespace CppCommon
@@ -0,0 +1,191 @@
+/*!
+    \file allocator_slab.h
+    \brief Slab memory allocator definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
+
+#include "allocator.h"
+
+namespace CppCommon {
+
+//! Slab memory manager class
+/*!
+    Slab memory manager segregates small blocks into size classes (powers
+    of two and their middles: 16, 24, 32, 48, 64, ... 3072, 4096 bytes).
+    Each size class owns a list of slabs with free blocks. Slab is an aligned
+    chunk of memory with a small header followed by the blocks of the same
+    size class, so the slab of any block is found by aligning its address.
+
+    Allocation and deallocation are O(1) operations: allocation takes the
+    first free block of the first partial slab (or carves a new block from
+    the untouched slab tail), deallocation pushes the block into the free
+    list of its slab.
+
+    Slabs are carved from regions allocated in the auxiliary memory manager.
+    When a slab becomes empty it is returned to its region (except the last
+    partial slab of the size class), and when all slabs of the region are
+    empty the region is returned back to the auxiliary memory manager.
+
+    If the allocated block is huge (greater than 4096 bytes) then it will be
+    allocated directly from auxiliary memory manager. Alignment up to 64 bytes
+    is supported for small blocks.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class SlabMemoryManager
+{
+public:
+    //! Initialize slab memory manager with an auxiliary memory manager
+    /*!
+        Slab memory manager will have slabs of size 65536 carved from regions of 16 slabs.
+
+        \param auxiliary - Auxiliary memory manager
+    */
+    explicit SlabMemoryManager(TAuxMemoryManager& auxiliary) : SlabMemoryManager(auxiliary, 65536, 16) {}
+    //! Initialize slab memory manager with an auxiliary memory manager, single slab size and slabs count in region
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param slab - Slab size in bytes (must be a power of two)
+        \param slabs - Slabs count in region (default is 16)
+    */
+    explicit SlabMemoryManager(TAuxMemoryManager& auxiliary, size_t slab, size_t slabs = 16);
+    SlabMemoryManager(const SlabMemoryManager&) = delete;
+    SlabMemoryManager(SlabMemoryManager&&) = delete;
+    ~SlabMemoryManager() { clear(); }
+
+    SlabMemoryManager& operator=(const SlabMemoryManager&) = delete;
+    SlabMemoryManager& operator=(SlabMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Slab size in bytes
+    size_t slab() const noexcept { return _slab; }
+    //! Slabs count in region
+    size_t slabs() const noexcept { return _slabs; }
+    //! Count of regions allocated from the auxiliary memory manager
+    size_t regions() const noexcept { return _regions_count; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _auxiliary.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _auxiliary; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+    //! Reset the memory manager with a given single slab size and slabs count in region
+    /*!
+        \param slab - Slab size in bytes (must be a power of two)
+        \param slabs - Slabs count in region (default is 16)
+    */
+    void reset(size_t slab, size_t slabs = 16);
+
+    //! Clear slab memory manager
+    void clear();
+
+private:
+    // Size classes
+    static const size_t Classes = 17;
+    static const size_t MaxClassSize = 4096;
+    static const size_t MaxAlignment = 64;
+    static const size_t SlabHeader = 64;
+
+    struct Region;
+
+    // Free block
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+    // Slab contains blocks of the same size class
+    struct Slab
+    {
+        Region* region;
+        Slab* prev;
+        Slab* next;
+        FreeBlock* free;
+        uint8_t* tail;
+        size_t used;
+        size_t capacity;
+        size_t index;
+    };
+    // Region contains slabs allocated from the auxiliary memory manager
+    struct Region
+    {
+        Region* prev;
+        Region* next;
+        uint8_t* base;
+        Slab* free;
+        size_t carved;
+        size_t used;
+    };
+
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // Auxiliary memory manager
+    TAuxMemoryManager& _auxiliary;
+
+    // Slabs
+    size_t _slab;
+    size_t _slabs;
+    Slab* _partial[Classes];
+
+    // Regions
+    Region* _regions;
+    size_t _regions_count;
+
+    // Size class lookup table
+    uint8_t _lookup[(MaxClassSize >> 3) + 1];
+
+    //! Get the block size of the given size class index
+    static size_t ClassSize(size_t index) noexcept;
+
+    //! Allocate a new slab for the given size class
+    Slab* AllocateSlab(size_t index);
+    //! Release the empty slab back to its region
+    void ReleaseSlab(Slab* slab);
+
+    //! Allocate a new region
+    Region* AllocateRegion();
+    //! Release the empty region
+    void ReleaseRegion(Region* region);
+    //! Region size in bytes
+    size_t RegionSize() const noexcept { return sizeof(Region) + (_slabs + 1) * _slab; }
+};
+
+//! Slab memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using SlabAllocator = Allocator<T, SlabMemoryManager<TAuxMemoryManager>, nothrow>;
+
+/*! \example memory_slab.cpp Slab memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_slab.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_SLAB_H
@@ -0,0 +1,328 @@
+/*!
+    \file allocator_slab.inl
+    \brief Slab memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TAuxMemoryManager>
+inline SlabMemoryManager<TAuxMemoryManager>::SlabMemoryManager(TAuxMemoryManager& auxiliary, size_t slab, size_t slabs)
+    : _allocated(0),
+      _allocations(0),
+      _auxiliary(auxiliary),
+      _slab(0),
+      _slabs(0),
+      _regions(nullptr),
+      _regions_count(0)
+{
+    static_assert(sizeof(Slab) <= SlabHeader, "Slab header structure size must not be greater than slab header size!");
+
+    for (size_t i = 0; i < Classes; ++i)
+        _partial[i] = nullptr;
+
+    // Initialize the size class lookup table
+    size_t index = 0;
+    for (size_t i = 0; i < sizeof(_lookup); ++i)
+    {
+        while (ClassSize(index) < (i << 3))
+            ++index;
+        _lookup[i] = (uint8_t)index;
+    }
+
+    reset(slab, slabs);
+}
+
+template <class TAuxMemoryManager>
+inline void* SlabMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    // Allocate huge blocks using the auxiliary memory manager
+    if (size > MaxClassSize)
+    {
+        void* result = _auxiliary.malloc(size, alignment);
+        if (result != nullptr)
+        {
+            // Update allocation statistics
+            _allocated += size;
+            ++_allocations;
+        }
+        return result;
+    }
+
+    assert((alignment <= MaxAlignment) && "Alignment of small blocks must not be greater than 64 bytes!");
+
+    // Find the size class which block size is suitable for the required alignment
+    size_t index = _lookup[(size + 7) >> 3];
+    while ((ClassSize(index) & (alignment - 1)) != 0)
+        ++index;
+
+    // Use the first partial slab of the size class or allocate a new one
+    Slab* slab = _partial[index];
+    if (slab == nullptr)
+    {
+        slab = AllocateSlab(index);
+        if (slab == nullptr)
+        {
+            // Out of memory...
+            return nullptr;
+        }
+    }
+
+    void* result;
+
+    // Allocate a block from the slab free list or from the untouched slab tail
+    if (slab->free != nullptr)
+    {
+        result = slab->free;
+        slab->free = slab->free->next;
+    }
+    else
+    {
+        result = slab->tail;
+        slab->tail += ClassSize(index);
+    }
+
+    // Remove the full slab from the partial slabs list
+    if (++slab->used == slab->capacity)
+    {
+        _partial[index] = slab->next;
+        if (slab->next != nullptr)
+            slab->next->prev = nullptr;
+        slab->next = nullptr;
+    }
+
+    // Update allocation statistics
+    _allocated += size;
+    ++_allocations;
+
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    // Deallocate huge blocks using the auxiliary memory manager
+    if (size > MaxClassSize)
+    {
+        _auxiliary.free(ptr, size);
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+
+        return;
+    }
+
+    // Find the slab of the block by its address
+    Slab* slab = (Slab*)Memory::Align((uint8_t*)ptr, _slab, false);
+    size_t index = slab->index;
+
+    // Insert the block into the slab free list
+    FreeBlock* block = (FreeBlock*)ptr;
+    block->next = slab->free;
+    slab->free = block;
+
+    // Insert the full slab into the partial slabs list
+    if (slab->used-- == slab->capacity)
+    {
+        slab->prev = nullptr;
+        slab->next = _partial[index];
+        if (slab->next != nullptr)
+            slab->next->prev = slab;
+        _partial[index] = slab;
+    }
+
+    // Release the empty slab if it is not the last partial slab of the size class
+    if ((slab->used == 0) && ((_partial[index] != slab) || (slab->next != nullptr)))
+    {
+        if (slab->prev != nullptr)
+            slab->prev->next = slab->next;
+        else
+            _partial[index] = slab->next;
+        if (slab->next != nullptr)
+            slab->next->prev = slab->prev;
+
+        ReleaseSlab(slab);
+    }
+
+    // Update allocation statistics
+    _allocated -= size;
+    --_allocations;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    // Reset partial slabs lists
+    for (size_t i = 0; i < Classes; ++i)
+        _partial[i] = nullptr;
+
+    // Mark all slabs of allocated regions as free
+    for (Region* region = _regions; region != nullptr; region = region->next)
+    {
+        region->free = nullptr;
+        region->carved = 0;
+        region->used = 0;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::reset(size_t slab, size_t slabs)
+{
+    assert(Memory::IsValidAlignment(slab) && "Slab size must be a power of two!");
+    assert((slab >= (2 * MaxClassSize)) && "Slab size must be big enough to fit at least one block of the maximal size class!");
+    assert((slabs > 0) && "Slabs count in region must be greater than zero!");
+
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    // Clear previous allocations
+    clear();
+
+    // Initialize slabs
+    _slab = slab;
+    _slabs = slabs;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::clear()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    // Reset partial slabs lists
+    for (size_t i = 0; i < Classes; ++i)
+        _partial[i] = nullptr;
+
+    // Release all regions
+    while (_regions != nullptr)
+        ReleaseRegion(_regions);
+}
+
+template <class TAuxMemoryManager>
+inline size_t SlabMemoryManager<TAuxMemoryManager>::ClassSize(size_t index) noexcept
+{
+    // Size classes: 16, 24, 32, 48, 64, 96, 128, ... 3072, 4096
+    if (index == 0)
+        return 16;
+    else if ((index & 1) != 0)
+        return (size_t)3 << (((index - 1) >> 1) + 3);
+    else
+        return (size_t)1 << ((index >> 1) + 4);
+}
+
+template <class TAuxMemoryManager>
+inline typename SlabMemoryManager<TAuxMemoryManager>::Slab* SlabMemoryManager<TAuxMemoryManager>::AllocateSlab(size_t index)
+{
+    // Find the region with free slabs
+    Region* region = _regions;
+    while ((region != nullptr) && (region->free == nullptr) && (region->carved == _slabs))
+        region = region->next;
+
+    // Allocate a new region
+    if (region == nullptr)
+    {
+        region = AllocateRegion();
+        if (region == nullptr)
+            return nullptr;
+    }
+
+    // Take the free slab from the region or carve a new one
+    Slab* slab;
+    if (region->free != nullptr)
+    {
+        slab = region->free;
+        region->free = slab->next;
+    }
+    else
+        slab = (Slab*)(region->base + (region->carved++ * _slab));
+    ++region->used;
+
+    // Prepare a new slab
+    slab->region = region;
+    slab->free = nullptr;
+    slab->tail = (uint8_t*)slab + SlabHeader;
+    slab->used = 0;
+    slab->capacity = (_slab - SlabHeader) / ClassSize(index);
+    slab->index = index;
+
+    // Insert the slab into the partial slabs list
+    slab->prev = nullptr;
+    slab->next = _partial[index];
+    if (slab->next != nullptr)
+        slab->next->prev = slab;
+    _partial[index] = slab;
+
+    return slab;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::ReleaseSlab(Slab* slab)
+{
+    Region* region = slab->region;
+
+    // Return the slab to its region
+    slab->next = region->free;
+    region->free = slab;
+
+    // Release the empty region
+    if (--region->used == 0)
+        ReleaseRegion(region);
+}
+
+template <class TAuxMemoryManager>
+inline typename SlabMemoryManager<TAuxMemoryManager>::Region* SlabMemoryManager<TAuxMemoryManager>::AllocateRegion()
+{
+    // Allocate a new region with enough space to align slabs
+    uint8_t* buffer = (uint8_t*)_auxiliary.malloc(RegionSize());
+    Region* region = (Region*)buffer;
+    if (region != nullptr)
+    {
+        // Prepare a new region
+        region->base = Memory::Align(buffer + sizeof(Region), _slab);
+        region->free = nullptr;
+        region->carved = 0;
+        region->used = 0;
+
+        // Insert the region into the regions list
+        region->prev = nullptr;
+        region->next = _regions;
+        if (_regions != nullptr)
+            _regions->prev = region;
+        _regions = region;
+        ++_regions_count;
+
+        return region;
+    }
+
+    // Out of memory...
+    return nullptr;
+}
+
+template <class TAuxMemoryManager>
+inline void SlabMemoryManager<TAuxMemoryManager>::ReleaseRegion(Region* region)
+{
+    // Remove the region from the regions list
+    if (region->prev != nullptr)
+        region->prev->next = region->next;
+    else
+        _regions = region->next;
+    if (region->next != nullptr)
+        region->next->prev = region->prev;
+    --_regions_count;
+
+    // Return the region back to the auxiliary memory manager
+    _auxiliary.free(region, RegionSize());
+}
+
+} // namespace CppCommon
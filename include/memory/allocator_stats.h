@@ -0,0 +1,246 @@
+/*!
+    \file allocator_stats.h
+    \brief Statistics memory allocator definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_STATS_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_STATS_H
+
+#include "allocator.h"
+
+#include "threads/spin_lock.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Memory statistics snapshot
+struct MemoryStats
+{
+    //! Count of allocation size histogram buckets
+    static const size_t Buckets = 32;
+
+    //! Currently allocated memory in bytes
+    size_t allocated;
+    //! Peak allocated memory in bytes
+    size_t peak;
+    //! Count of active memory allocations (in-flight blocks)
+    size_t allocations;
+
+    //! Total allocated memory in bytes
+    uint64_t total_allocated;
+    //! Total freed memory in bytes
+    uint64_t total_freed;
+    //! Total count of memory allocations
+    uint64_t total_allocations;
+    //! Total count of memory deallocations
+    uint64_t total_frees;
+    //! Total count of failed memory allocations
+    uint64_t failures;
+
+    //! Allocation size histogram
+    /*!
+        Bucket 'i' counts allocations of size in range (2^(i-1), 2^i].
+        The last bucket counts all bigger allocations.
+    */
+    uint64_t histogram[Buckets];
+
+    MemoryStats() noexcept;
+
+    //! Get the histogram bucket index of the given allocation size
+    static size_t Bucket(size_t size) noexcept;
+};
+
+//! Thread memory statistics snapshot
+struct ThreadMemoryStats
+{
+    //! Thread Id (zero for aggregated statistics of exited threads)
+    uint64_t thread;
+    //! Currently allocated memory in bytes by the thread (negative if the thread frees blocks allocated by other threads)
+    int64_t allocated;
+    //! Total allocated memory in bytes by the thread
+    uint64_t total_allocated;
+    //! Total freed memory in bytes by the thread
+    uint64_t total_freed;
+    //! Total count of memory allocations by the thread
+    uint64_t total_allocations;
+    //! Total count of memory deallocations by the thread
+    uint64_t total_frees;
+};
+
+//! Statistics memory manager class
+/*!
+    Statistics memory manager is a decorator over another memory manager
+    which collects memory statistics: allocated, freed and peak memory,
+    count of in-flight blocks, failed allocations and allocation size
+    histogram. Optionally memory statistics could be attributed to threads
+    which allocate and free memory blocks.
+
+    Statistics counters are updated with relaxed atomic operations, so the
+    decorator could be used with thread-safe memory managers. Snapshots
+    are cheap and do not block the memory manager.
+
+    If statistics is disabled with the template argument all calls are
+    forwarded to the decorated memory manager with zero cost and the
+    statistics manager holds no counters at all.
+
+    Counters of exited threads are folded into a single aggregated entry
+    of threads statistics with zero thread Id, so threads statistics does
+    not grow with short-living threads.
+
+    Thread-safe if the decorated memory manager is thread-safe.
+*/
+template <class TMemoryManager, bool enabled = true>
+class StatsMemoryManager
+{
+public:
+    //! Initialize statistics memory manager with a decorated memory manager
+    /*!
+        \param manager - Decorated memory manager
+        \param threads - Attribute memory statistics to threads (default is false)
+    */
+    explicit StatsMemoryManager(TMemoryManager& manager, bool threads = false);
+    StatsMemoryManager(const StatsMemoryManager&) = delete;
+    StatsMemoryManager(StatsMemoryManager&&) = delete;
+    ~StatsMemoryManager() = default;
+
+    StatsMemoryManager& operator=(const StatsMemoryManager&) = delete;
+    StatsMemoryManager& operator=(StatsMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _manager.allocated(); }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _manager.allocations(); }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _manager.max_size(); }
+
+    //! Decorated memory manager
+    TMemoryManager& manager() noexcept { return _manager; }
+
+    //! Is memory statistics enabled?
+    static constexpr bool is_enabled() noexcept { return enabled; }
+    //! Is memory statistics attributed to threads?
+    bool is_threads() const noexcept;
+
+    //! Get memory statistics snapshot
+    MemoryStats stats() const noexcept;
+    //! Get threads memory statistics snapshot
+    std::vector<ThreadMemoryStats> threads_stats() const;
+
+    //! Clear memory statistics
+    /*!
+        Total counters, peak and histogram are cleared. Current allocated
+        memory and in-flight blocks are preserved.
+    */
+    void clear_stats() noexcept;
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset() { _manager.reset(); }
+
+private:
+    // Thread statistics counters
+    struct ThreadCounters
+    {
+        uint64_t thread;
+        std::atomic<int64_t> allocated;
+        std::atomic<uint64_t> total_allocated;
+        std::atomic<uint64_t> total_freed;
+        std::atomic<uint64_t> total_allocations;
+        std::atomic<uint64_t> total_frees;
+
+        explicit ThreadCounters(uint64_t id) noexcept;
+    };
+    // Threads statistics shared state
+    struct ThreadsState
+    {
+        uint64_t id;
+        mutable SpinLock lock;
+        std::vector<std::unique_ptr<ThreadCounters>> counters;
+        // Aggregated counters of exited threads
+        ThreadCounters exited;
+        size_t exited_threads;
+
+        ThreadsState();
+    };
+    // Thread counters entry
+    struct Entry
+    {
+        uint64_t id;
+        ThreadCounters* counters;
+        std::weak_ptr<ThreadsState> state;
+    };
+    // Thread counters entries of the current thread
+    struct Entries
+    {
+        std::vector<Entry> entries;
+
+        // Fold thread counters into the aggregated counters of exited threads
+        ~Entries();
+    };
+    // Statistics counters
+    struct Counters
+    {
+        std::atomic<size_t> allocated;
+        std::atomic<size_t> peak;
+        std::atomic<size_t> allocations;
+        std::atomic<uint64_t> total_allocated;
+        std::atomic<uint64_t> total_freed;
+        std::atomic<uint64_t> total_allocations;
+        std::atomic<uint64_t> total_frees;
+        std::atomic<uint64_t> failures;
+        std::atomic<uint64_t> histogram[MemoryStats::Buckets];
+
+        // Threads statistics
+        bool threads;
+        std::shared_ptr<ThreadsState> threads_state;
+
+        explicit Counters(bool attribute);
+    };
+    // Empty statistics counters of the disabled statistics
+    struct EmptyCounters
+    {
+        explicit EmptyCounters(bool attribute) noexcept {}
+    };
+
+    // Decorated memory manager
+    TMemoryManager& _manager;
+    // Statistics counters
+    [[no_unique_address]] std::conditional_t<enabled, Counters, EmptyCounters> _stats;
+
+    //! Get the current thread counters
+    ThreadCounters* GetThreadCounters();
+};
+
+//! Statistics memory allocator class
+template <typename T, class TMemoryManager, bool enabled = true, bool nothrow = false>
+using StatsAllocator = Allocator<T, StatsMemoryManager<TMemoryManager, enabled>, nothrow>;
+
+/*! \example memory_stats.cpp Statistics memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_stats.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_STATS_H
@@ -0,0 +1,296 @@
+/*!
+    \file allocator_stats.inl
+    \brief Statistics memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include <algorithm>
+
+namespace CppCommon {
+
+inline MemoryStats::MemoryStats() noexcept
+    : allocated(0),
+      peak(0),
+      allocations(0),
+      total_allocated(0),
+      total_freed(0),
+      total_allocations(0),
+      total_frees(0),
+      failures(0)
+{
+    for (size_t i = 0; i < Buckets; ++i)
+        histogram[i] = 0;
+}
+
+inline size_t MemoryStats::Bucket(size_t size) noexcept
+{
+    size_t index = 0;
+    size_t bucket = 1;
+    while ((bucket < size) && (index < (Buckets - 1)))
+    {
+        bucket <<= 1;
+        ++index;
+    }
+    return index;
+}
+
+template <class TMemoryManager, bool enabled>
+inline StatsMemoryManager<TMemoryManager, enabled>::ThreadCounters::ThreadCounters(uint64_t id) noexcept
+    : thread(id),
+      allocated(0),
+      total_allocated(0),
+      total_freed(0),
+      total_allocations(0),
+      total_frees(0)
+{
+}
+
+template <class TMemoryManager, bool enabled>
+inline StatsMemoryManager<TMemoryManager, enabled>::ThreadsState::ThreadsState()
+    : id(0),
+      exited(0),
+      exited_threads(0)
+{
+    static std::atomic<uint64_t> generator(0);
+    id = ++generator;
+}
+
+template <class TMemoryManager, bool enabled>
+inline StatsMemoryManager<TMemoryManager, enabled>::Entries::~Entries()
+{
+    for (auto& entry : entries)
+    {
+        // Skip entries of destroyed memory managers
+        std::shared_ptr<ThreadsState> state = entry.state.lock();
+        if (!state)
+            continue;
+
+        Locker<SpinLock> locker(state->lock);
+
+        ThreadCounters* counters = entry.counters;
+        state->exited.allocated.fetch_add(counters->allocated.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        state->exited.total_allocated.fetch_add(counters->total_allocated.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        state->exited.total_freed.fetch_add(counters->total_freed.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        state->exited.total_allocations.fetch_add(counters->total_allocations.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        state->exited.total_frees.fetch_add(counters->total_frees.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        ++state->exited_threads;
+
+        // Remove the thread counters
+        state->counters.erase(std::remove_if(state->counters.begin(), state->counters.end(), [counters](const std::unique_ptr<ThreadCounters>& item) { return item.get() == counters; }), state->counters.end());
+    }
+}
+
+template <class TMemoryManager, bool enabled>
+inline StatsMemoryManager<TMemoryManager, enabled>::Counters::Counters(bool attribute)
+    : allocated(0),
+      peak(0),
+      allocations(0),
+      total_allocated(0),
+      total_freed(0),
+      total_allocations(0),
+      total_frees(0),
+      failures(0),
+      threads(attribute)
+{
+    for (size_t i = 0; i < MemoryStats::Buckets; ++i)
+        histogram[i] = 0;
+
+    if (threads)
+        threads_state = std::make_shared<ThreadsState>();
+}
+
+template <class TMemoryManager, bool enabled>
+inline StatsMemoryManager<TMemoryManager, enabled>::StatsMemoryManager(TMemoryManager& manager, bool threads)
+    : _manager(manager),
+      _stats(threads)
+{
+}
+
+template <class TMemoryManager, bool enabled>
+inline bool StatsMemoryManager<TMemoryManager, enabled>::is_threads() const noexcept
+{
+    if constexpr (enabled)
+        return _stats.threads;
+    else
+        return false;
+}
+
+template <class TMemoryManager, bool enabled>
+inline MemoryStats StatsMemoryManager<TMemoryManager, enabled>::stats() const noexcept
+{
+    MemoryStats result;
+
+    if constexpr (enabled)
+    {
+        result.allocated = _stats.allocated.load(std::memory_order_relaxed);
+        result.peak = _stats.peak.load(std::memory_order_relaxed);
+        result.allocations = _stats.allocations.load(std::memory_order_relaxed);
+        result.total_allocated = _stats.total_allocated.load(std::memory_order_relaxed);
+        result.total_freed = _stats.total_freed.load(std::memory_order_relaxed);
+        result.total_allocations = _stats.total_allocations.load(std::memory_order_relaxed);
+        result.total_frees = _stats.total_frees.load(std::memory_order_relaxed);
+        result.failures = _stats.failures.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < MemoryStats::Buckets; ++i)
+            result.histogram[i] = _stats.histogram[i].load(std::memory_order_relaxed);
+    }
+
+    return result;
+}
+
+template <class TMemoryManager, bool enabled>
+inline std::vector<ThreadMemoryStats> StatsMemoryManager<TMemoryManager, enabled>::threads_stats() const
+{
+    std::vector<ThreadMemoryStats> result;
+
+    if constexpr (enabled)
+    {
+        if (!_stats.threads)
+            return result;
+
+        auto snapshot = [](const ThreadCounters& counters)
+        {
+            ThreadMemoryStats stats;
+            stats.thread = counters.thread;
+            stats.allocated = counters.allocated.load(std::memory_order_relaxed);
+            stats.total_allocated = counters.total_allocated.load(std::memory_order_relaxed);
+            stats.total_freed = counters.total_freed.load(std::memory_order_relaxed);
+            stats.total_allocations = counters.total_allocations.load(std::memory_order_relaxed);
+            stats.total_frees = counters.total_frees.load(std::memory_order_relaxed);
+            return stats;
+        };
+
+        Locker<SpinLock> locker(_stats.threads_state->lock);
+
+        result.reserve(_stats.threads_state->counters.size() + 1);
+        for (auto& counters : _stats.threads_state->counters)
+            result.push_back(snapshot(*counters));
+
+        // Aggregated statistics of exited threads
+        if (_stats.threads_state->exited_threads > 0)
+            result.push_back(snapshot(_stats.threads_state->exited));
+    }
+
+    return result;
+}
+
+template <class TMemoryManager, bool enabled>
+inline void StatsMemoryManager<TMemoryManager, enabled>::clear_stats() noexcept
+{
+    if constexpr (enabled)
+    {
+        _stats.peak.store(_stats.allocated.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        _stats.total_allocated.store(0, std::memory_order_relaxed);
+        _stats.total_freed.store(0, std::memory_order_relaxed);
+        _stats.total_allocations.store(0, std::memory_order_relaxed);
+        _stats.total_frees.store(0, std::memory_order_relaxed);
+        _stats.failures.store(0, std::memory_order_relaxed);
+        for (size_t i = 0; i < MemoryStats::Buckets; ++i)
+            _stats.histogram[i].store(0, std::memory_order_relaxed);
+
+        if (_stats.threads)
+        {
+            auto clear = [](ThreadCounters& counters)
+            {
+                counters.total_allocated.store(0, std::memory_order_relaxed);
+                counters.total_freed.store(0, std::memory_order_relaxed);
+                counters.total_allocations.store(0, std::memory_order_relaxed);
+                counters.total_frees.store(0, std::memory_order_relaxed);
+            };
+
+            Locker<SpinLock> locker(_stats.threads_state->lock);
+
+            for (auto& counters : _stats.threads_state->counters)
+                clear(*counters);
+            clear(_stats.threads_state->exited);
+        }
+    }
+}
+
+template <class TMemoryManager, bool enabled>
+inline void* StatsMemoryManager<TMemoryManager, enabled>::malloc(size_t size, size_t alignment)
+{
+    void* result = _manager.malloc(size, alignment);
+
+    if constexpr (enabled)
+    {
+        if (result == nullptr)
+        {
+            _stats.failures.fetch_add(1, std::memory_order_relaxed);
+            return result;
+        }
+
+        // Update allocation statistics
+        size_t allocated = _stats.allocated.fetch_add(size, std::memory_order_relaxed) + size;
+        _stats.allocations.fetch_add(1, std::memory_order_relaxed);
+        _stats.total_allocated.fetch_add(size, std::memory_order_relaxed);
+        _stats.total_allocations.fetch_add(1, std::memory_order_relaxed);
+        _stats.histogram[MemoryStats::Bucket(size)].fetch_add(1, std::memory_order_relaxed);
+
+        // Update the peak allocated memory
+        size_t peak = _stats.peak.load(std::memory_order_relaxed);
+        while ((peak < allocated) && !_stats.peak.compare_exchange_weak(peak, allocated, std::memory_order_relaxed));
+
+        // Update thread allocation statistics
+        if (_stats.threads)
+        {
+            ThreadCounters* counters = GetThreadCounters();
+            counters->allocated.fetch_add((int64_t)size, std::memory_order_relaxed);
+            counters->total_allocated.fetch_add(size, std::memory_order_relaxed);
+            counters->total_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    return result;
+}
+
+template <class TMemoryManager, bool enabled>
+inline void StatsMemoryManager<TMemoryManager, enabled>::free(void* ptr, size_t size)
+{
+    _manager.free(ptr, size);
+
+    if constexpr (enabled)
+    {
+        // Update allocation statistics
+        _stats.allocated.fetch_sub(size, std::memory_order_relaxed);
+        _stats.allocations.fetch_sub(1, std::memory_order_relaxed);
+        _stats.total_freed.fetch_add(size, std::memory_order_relaxed);
+        _stats.total_frees.fetch_add(1, std::memory_order_relaxed);
+
+        // Update thread allocation statistics
+        if (_stats.threads)
+        {
+            ThreadCounters* counters = GetThreadCounters();
+            counters->allocated.fetch_sub((int64_t)size, std::memory_order_relaxed);
+            counters->total_freed.fetch_add(size, std::memory_order_relaxed);
+            counters->total_frees.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+template <class TMemoryManager, bool enabled>
+inline typename StatsMemoryManager<TMemoryManager, enabled>::ThreadCounters* StatsMemoryManager<TMemoryManager, enabled>::GetThreadCounters()
+{
+    static thread_local Entries thread_entries;
+    std::vector<Entry>& entries = thread_entries.entries;
+
+    // Find the thread counters of the current memory manager
+    for (auto& entry : entries)
+        if (entry.id == _stats.threads_state->id)
+            return entry.counters;
+
+    Locker<SpinLock> locker(_stats.threads_state->lock);
+
+    // Remove entries of destroyed memory managers
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const Entry& entry) { return entry.state.expired(); }), entries.end());
+
+    // Register new thread counters
+    _stats.threads_state->counters.emplace_back(std::make_unique<ThreadCounters>(Thread::CurrentThreadId()));
+    ThreadCounters* counters = _stats.threads_state->counters.back().get();
+    entries.push_back(Entry{ _stats.threads_state->id, counters, _stats.threads_state });
+
+    return counters;
+}
+
+} // namespace CppCommon
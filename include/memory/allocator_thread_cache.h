@@ -0,0 +1,231 @@
+/*!
+    \file allocator_thread_cache.h
+    \brief Thread cache memory allocator definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_THREAD_CACHE_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_THREAD_CACHE_H
+
+#include "allocator_pool.h"
+
+#include "threads/critical_section.h"
+#include "threads/spin_lock.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Thread cache memory manager class
+/*!
+    Thread cache memory manager is a thread-safe front end of the memory pool
+    manager. Small blocks are grouped into power of two size classes (from 16
+    to 8192 bytes). Each thread keeps two magazines (fixed size stacks of free
+    blocks) per size class, so most of malloc() and free() calls are served
+    from the thread local magazines without any synchronization.
+
+    When both thread magazines are empty (or full) they are exchanged with
+    the global depot of full and empty magazines under a per size class
+    spin-lock. Only if the depot has no full magazines a batch of blocks is
+    allocated from the underlying memory pool under the global lock. When the
+    depot overflows the whole magazine of blocks is returned back to the pool.
+
+    Blocks are interchangeable inside a size class, so a block allocated in
+    one thread could be freed in any other thread. Cross-thread frees simply
+    fill the magazines of the releasing thread and flow back to allocating
+    threads through the depot.
+
+    Huge blocks (greater than the maximal size class) are allocated directly
+    from the memory pool under the global lock. Alignment greater than
+    alignof(std::max_align_t) is not supported.
+
+    Thread caches are released to the depot when the thread exits. Memory
+    manager could be destroyed before threads that used it exit, their
+    thread caches are discarded safely. Memory manager must not be used
+    concurrently with reset(), clear() or its destruction.
+
+    Thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ThreadCacheMemoryManager
+{
+public:
+    //! Initialize thread cache memory manager with an auxiliary memory manager
+    /*!
+        Memory pool will have unlimited pages of size 65536.
+
+        \param auxiliary - Auxiliary memory manager
+    */
+    explicit ThreadCacheMemoryManager(TAuxMemoryManager& auxiliary) : ThreadCacheMemoryManager(auxiliary, 65536, 0) {}
+    //! Initialize thread cache memory manager with an auxiliary memory manager, single page size and max pages count
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param page - Memory pool page size in bytes
+        \param pages - Memory pool max pages count. Zero value means unlimited count (default is 0)
+    */
+    explicit ThreadCacheMemoryManager(TAuxMemoryManager& auxiliary, size_t page, size_t pages = 0);
+    ThreadCacheMemoryManager(const ThreadCacheMemoryManager&) = delete;
+    ThreadCacheMemoryManager(ThreadCacheMemoryManager&&) = delete;
+    ~ThreadCacheMemoryManager() { clear(); }
+
+    ThreadCacheMemoryManager& operator=(const ThreadCacheMemoryManager&) = delete;
+    ThreadCacheMemoryManager& operator=(ThreadCacheMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept;
+    //! Count of active memory allocations
+    size_t allocations() const noexcept;
+
+    //! Memory pool page size in bytes
+    size_t page() const noexcept { return _state->pool.page(); }
+    //! Memory pool max pages size
+    size_t pages() const noexcept { return _state->pool.pages(); }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _state->pool.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _state->pool.auxiliary(); }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    /*!
+        Return all cached blocks back to the memory pool and reset it.
+    */
+    void reset();
+
+    //! Clear the memory manager
+    /*!
+        Return all cached blocks back to the memory pool, release all
+        magazines and clear the memory pool.
+    */
+    void clear();
+
+private:
+    // Size classes
+    static const size_t MinClassShift = 4;
+    static const size_t Classes = 10;
+    static const size_t MaxClassSize = (size_t)1 << (MinClassShift + Classes - 1);
+    // Magazine capacity
+    static const size_t MagazineCapacity = 64;
+    static const size_t MagazineBytes = 32768;
+    // Max count of full magazines in the depot per size class
+    static const size_t DepotLimit = 32;
+
+    // Magazine is a fixed size stack of free blocks
+    struct Magazine
+    {
+        Magazine* next;
+        size_t count;
+        void* blocks[MagazineCapacity];
+    };
+    // Depot of full and empty magazines
+    struct Depot
+    {
+        SpinLock lock;
+        Magazine* full;
+        Magazine* empty;
+        size_t full_count;
+
+        Depot() noexcept : full(nullptr), empty(nullptr), full_count(0) {}
+    };
+    // Thread cache
+    struct Cache
+    {
+        Cache* next;
+        bool active;
+        Magazine* loaded[Classes];
+        Magazine* previous[Classes];
+        // Allocation statistics (modified only by the owner thread)
+        std::atomic<int64_t> allocated;
+        std::atomic<int64_t> allocations;
+
+        Cache() noexcept;
+    };
+    // Shared state of the memory manager
+    struct State
+    {
+        uint64_t id;
+        CriticalSection lock;
+        PoolMemoryManager<TAuxMemoryManager> pool;
+        Depot depots[Classes];
+        Cache* caches;
+
+        State(TAuxMemoryManager& auxiliary, size_t page, size_t pages);
+        ~State();
+    };
+    // Thread cache entry
+    struct Entry
+    {
+        uint64_t id;
+        Cache* cache;
+        std::weak_ptr<State> state;
+    };
+    // Thread cache entries which release thread caches on thread exit
+    struct Entries
+    {
+        std::vector<Entry> entries;
+
+        ~Entries();
+    };
+
+    std::shared_ptr<State> _state;
+
+    //! Get the size class index of the given block size
+    static size_t ClassIndex(size_t size) noexcept;
+    //! Get the block size of the given size class index
+    static size_t ClassSize(size_t index) noexcept { return (size_t)1 << (MinClassShift + index); }
+    //! Get the magazine capacity of the given size class index
+    static size_t ClassCapacity(size_t index) noexcept;
+
+    //! Get the current thread entries
+    static Entries& ThreadEntries();
+
+    //! Get the current thread cache
+    Cache* GetCache();
+    //! Attach a new thread cache to the current thread
+    Cache* AttachCache(Entries& entries);
+    //! Release the thread cache magazines into the depot
+    static void ReleaseCache(State& state, Cache* cache);
+
+    //! Allocate a block when the thread magazines are empty
+    void* MallocSlow(Cache* cache, size_t index);
+    //! Free a block when the thread magazines are full
+    void FreeSlow(Cache* cache, size_t index, void* ptr);
+
+    //! Allocate an empty magazine (global lock must be held)
+    static Magazine* AllocateMagazine(State& state);
+    //! Return all blocks of the given magazine back to the memory pool (global lock must be held)
+    static void FlushMagazine(State& state, Magazine* magazine, size_t index);
+    //! Return all cached blocks back to the memory pool (global lock must be held)
+    void FlushAll(bool release);
+};
+
+//! Thread cache memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using ThreadCacheAllocator = Allocator<T, ThreadCacheMemoryManager<TAuxMemoryManager>, nothrow>;
+
+/*! \example memory_thread_cache.cpp Thread cache memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_thread_cache.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_THREAD_CACHE_H
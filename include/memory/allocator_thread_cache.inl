@@ -0,0 +1,540 @@
+/*!
+    \file allocator_thread_cache.inl
+    \brief Thread cache memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TAuxMemoryManager>
+inline ThreadCacheMemoryManager<TAuxMemoryManager>::Cache::Cache() noexcept
+    : next(nullptr),
+      active(false),
+      allocated(0),
+      allocations(0)
+{
+    for (size_t i = 0; i < Classes; ++i)
+    {
+        loaded[i] = nullptr;
+        previous[i] = nullptr;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline ThreadCacheMemoryManager<TAuxMemoryManager>::State::State(TAuxMemoryManager& auxiliary, size_t page, size_t pages)
+    : id(0),
+      pool(auxiliary, page, pages),
+      caches(nullptr)
+{
+    static std::atomic<uint64_t> generator(0);
+    id = ++generator;
+}
+
+template <class TAuxMemoryManager>
+inline ThreadCacheMemoryManager<TAuxMemoryManager>::State::~State()
+{
+    // Release all thread caches
+    while (caches != nullptr)
+    {
+        Cache* cache = caches;
+        caches = cache->next;
+        cache->~Cache();
+        pool.auxiliary().free(cache, sizeof(Cache));
+    }
+}
+
+template <class TAuxMemoryManager>
+inline ThreadCacheMemoryManager<TAuxMemoryManager>::Entries::~Entries()
+{
+    // Release thread caches of all alive memory managers
+    for (auto& entry : entries)
+    {
+        std::shared_ptr<State> state = entry.state.lock();
+        if (state)
+            ReleaseCache(*state, entry.cache);
+    }
+}
+
+template <class TAuxMemoryManager>
+inline ThreadCacheMemoryManager<TAuxMemoryManager>::ThreadCacheMemoryManager(TAuxMemoryManager& auxiliary, size_t page, size_t pages)
+    : _state(std::make_shared<State>(auxiliary, page, pages))
+{
+}
+
+template <class TAuxMemoryManager>
+inline size_t ThreadCacheMemoryManager<TAuxMemoryManager>::allocated() const noexcept
+{
+    Locker<CriticalSection> locker(_state->lock);
+
+    int64_t result = 0;
+    for (Cache* cache = _state->caches; cache != nullptr; cache = cache->next)
+        result += cache->allocated.load(std::memory_order_relaxed);
+    return (size_t)result;
+}
+
+template <class TAuxMemoryManager>
+inline size_t ThreadCacheMemoryManager<TAuxMemoryManager>::allocations() const noexcept
+{
+    Locker<CriticalSection> locker(_state->lock);
+
+    int64_t result = 0;
+    for (Cache* cache = _state->caches; cache != nullptr; cache = cache->next)
+        result += cache->allocations.load(std::memory_order_relaxed);
+    return (size_t)result;
+}
+
+template <class TAuxMemoryManager>
+inline void* ThreadCacheMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+    assert((alignment <= alignof(std::max_align_t)) && "Extended alignment is not supported by the thread cache memory manager!");
+
+    Cache* cache = GetCache();
+    if (cache == nullptr)
+        return nullptr;
+
+    void* result;
+
+    if (size > MaxClassSize)
+    {
+        // Allocate huge blocks directly from the memory pool
+        Locker<CriticalSection> locker(_state->lock);
+        result = _state->pool.malloc(size, alignment);
+    }
+    else
+    {
+        size_t index = ClassIndex(size);
+
+        // Allocate the block from the loaded thread magazine
+        Magazine* loaded = cache->loaded[index];
+        if ((loaded != nullptr) && (loaded->count > 0))
+            result = loaded->blocks[--loaded->count];
+        else
+            result = MallocSlow(cache, index);
+    }
+
+    if (result != nullptr)
+    {
+        // Update allocation statistics
+        cache->allocated.store(cache->allocated.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        cache->allocations.store(cache->allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void ThreadCacheMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    Cache* cache = GetCache();
+
+    if ((size > MaxClassSize) || (cache == nullptr))
+    {
+        // Free huge blocks directly into the memory pool
+        Locker<CriticalSection> locker(_state->lock);
+        _state->pool.free(ptr, (size > MaxClassSize) ? size : ClassSize(ClassIndex(size)));
+    }
+    else
+    {
+        size_t index = ClassIndex(size);
+
+        // Free the block into the loaded thread magazine
+        Magazine* loaded = cache->loaded[index];
+        if ((loaded != nullptr) && (loaded->count < ClassCapacity(index)))
+            loaded->blocks[loaded->count++] = ptr;
+        else
+            FreeSlow(cache, index, ptr);
+    }
+
+    if (cache != nullptr)
+    {
+        // Update allocation statistics
+        cache->allocated.store(cache->allocated.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+        cache->allocations.store(cache->allocations.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void ThreadCacheMemoryManager<TAuxMemoryManager>::reset()
+{
+    assert((allocated() == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((allocations() == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    Locker<CriticalSection> locker(_state->lock);
+
+    // Return all cached blocks back to the memory pool
+    FlushAll(false);
+
+    // Reset the memory pool
+    _state->pool.reset();
+}
+
+template <class TAuxMemoryManager>
+inline void ThreadCacheMemoryManager<TAuxMemoryManager>::clear()
+{
+    assert((allocated() == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((allocations() == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    Locker<CriticalSection> locker(_state->lock);
+
+    // Return all cached blocks back to the memory pool and release magazines
+    FlushAll(true);
+
+    // Clear the memory pool
+    _state->pool.clear();
+}
+
+template <class TAuxMemoryManager>
+inline size_t ThreadCacheMemoryManager<TAuxMemoryManager>::ClassIndex(size_t size) noexcept
+{
+    size_t index = 0;
+    size_t block = (size_t)1 << MinClassShift;
+    while (block < size)
+    {
+        block <<= 1;
+        ++index;
+    }
+    return index;
+}
+
+template <class TAuxMemoryManager>
+inline size_t ThreadCacheMemoryManager<TAuxMemoryManager>::ClassCapacity(size_t index) noexcept
+{
+    // Keep about the same amount of bytes in magazines of big size classes
+    size_t capacity = MagazineBytes / ClassSize(index);
+    if (capacity > MagazineCapacity)
+        return MagazineCapacity;
+    if (capacity < 8)
+        return 8;
+    return capacity;
+}
+
+template <class TAuxMemoryManager>
+inline typename ThreadCacheMemoryManager<TAuxMemoryManager>::Entries& ThreadCacheMemoryManager<TAuxMemoryManager>::ThreadEntries()
+{
+    static thread_local Entries entries;
+    return entries;
+}
+
+template <class TAuxMemoryManager>
+inline typename ThreadCacheMemoryManager<TAuxMemoryManager>::Cache* ThreadCacheMemoryManager<TAuxMemoryManager>::GetCache()
+{
+    Entries& entries = ThreadEntries();
+
+    // Find the thread cache of the current memory manager
+    for (auto& entry : entries.entries)
+        if (entry.id == _state->id)
+            return entry.cache;
+
+    return AttachCache(entries);
+}
+
+template <class TAuxMemoryManager>
+inline typename ThreadCacheMemoryManager<TAuxMemoryManager>::Cache* ThreadCacheMemoryManager<TAuxMemoryManager>::AttachCache(Entries& entries)
+{
+    Locker<CriticalSection> locker(_state->lock);
+
+    // Remove entries of destroyed memory managers
+    entries.entries.erase(std::remove_if(entries.entries.begin(), entries.entries.end(), [](const Entry& entry) { return entry.state.expired(); }), entries.entries.end());
+
+    // Reuse the thread cache released by the finished thread
+    Cache* cache = _state->caches;
+    while ((cache != nullptr) && cache->active)
+        cache = cache->next;
+
+    // Allocate a new thread cache
+    if (cache == nullptr)
+    {
+        void* buffer = _state->pool.auxiliary().malloc(sizeof(Cache), alignof(Cache));
+        if (buffer == nullptr)
+            return nullptr;
+
+        cache = new (buffer) Cache();
+        cache->next = _state->caches;
+        _state->caches = cache;
+    }
+
+    cache->active = true;
+
+    entries.entries.push_back(Entry{ _state->id, cache, _state });
+
+    return cache;
+}
+
+template <class TAuxMemoryManager>
+inline void ThreadCacheMemoryManager<TAuxMemoryManager>::ReleaseCache(State& state, Cache* cache)
+{
+    Locker<CriticalSection> locker(state.lock);
+
+    // Move all thread magazines into the depot
+    for (size_t i = 0; i < Classes; ++i)
+    {
+        Depot& depot = state.depots[i];
+        Locker<SpinLock> depot_locker(depot.lock);
+
+        for (Magazine* magazine : { cache->loaded[i], cache->previous[i] })
+        {
+            if (magazine == nullptr)
+                continue;
+
+            if (magazine->count > 0)
+            {
+                magazine->next = depot.full;
+                depot.full = magazine;
+                ++depot.full_count;
+            }
+            else
+            {
+                magazine->next = depot.empty;
+                depot.empty = magazine;
+            }
+        }
+
+        cache->loaded[i] = nullptr;
+        cache->previous[i] = nullptr;
+    }
+
+    cache->active = false;
+}
+
+template <class TAuxMemoryManager>
+inline void* ThreadCacheMemoryManager<TAuxMemoryManager>::MallocSlow(Cache* cache, size_t index)
+{
+    Magazine*& loaded = cache->loaded[index];
+    Magazine*& previous = cache->previous[index];
+
+    // Lazy initialize thread magazines of the size class
+    if (loaded == nullptr)
+    {
+        Locker<CriticalSection> locker(_state->lock);
+        loaded = AllocateMagazine(*_state);
+        if (loaded == nullptr)
+            return nullptr;
+    }
+    if (previous == nullptr)
+    {
+        Locker<CriticalSection> locker(_state->lock);
+        previous = AllocateMagazine(*_state);
+        if (previous == nullptr)
+            return nullptr;
+    }
+
+    // Use the previous magazine if it is not empty
+    if (previous->count > 0)
+    {
+        std::swap(loaded, previous);
+        return loaded->blocks[--loaded->count];
+    }
+
+    // Exchange the empty previous magazine with a full one from the depot
+    Depot& depot = _state->depots[index];
+    {
+        Locker<SpinLock> locker(depot.lock);
+
+        Magazine* full = depot.full;
+        if (full != nullptr)
+        {
+            depot.full = full->next;
+            --depot.full_count;
+
+            previous->next = depot.empty;
+            depot.empty = previous;
+
+            previous = loaded;
+            loaded = full;
+
+            return loaded->blocks[--loaded->count];
+        }
+    }
+
+    // Refill the loaded magazine with a batch of blocks from the memory pool
+    {
+        Locker<CriticalSection> locker(_state->lock);
+
+        size_t block = ClassSize(index);
+        size_t capacity = ClassCapacity(index);
+        while (loaded->count < capacity)
+        {
+            void* ptr = _state->pool.malloc(block);
+            if (ptr == nullptr)
+                break;
+            loaded->blocks[loaded->count++] = ptr;
+        }
+    }
+
+    if (loaded->count > 0)
+        return loaded->blocks[--loaded->count];
+
+    // Out of memory...
+    return nullptr;
+}
+
+template <class TAuxMemoryManager>
+inline void ThreadCacheMemoryManager<TAuxMemoryManager>::FreeSlow(Cache* cache, size_t index, void* ptr)
+{
+    Magazine*& loaded = cache->loaded[index];
+    Magazine*& previous = cache->previous[index];
+
+    // Lazy initialize thread magazines of the size class
+    if ((loaded == nullptr) || (previous == nullptr))
+    {
+        Locker<CriticalSection> locker(_state->lock);
+
+        if (loaded == nullptr)
+            loaded = AllocateMagazine(*_state);
+        if (previous == nullptr)
+            previous = AllocateMagazine(*_state);
+
+        // Not enough memory for magazines... free the block into the memory pool
+        if ((loaded == nullptr) || (previous == nullptr))
+        {
+            _state->pool.free(ptr, ClassSize(index));
+            return;
+        }
+    }
+
+    // Use the previous magazine if it is empty
+    if (previous->count == 0)
+    {
+        std::swap(loaded, previous);
+        loaded->blocks[loaded->count++] = ptr;
+        return;
+    }
+
+    // Exchange the full previous magazine with an empty one from the depot
+    Depot& depot = _state->depots[index];
+    Magazine* empty = nullptr;
+    bool overflow = false;
+    {
+        Locker<SpinLock> locker(depot.lock);
+
+        if (depot.full_count < DepotLimit)
+        {
+            empty = depot.empty;
+            if (empty != nullptr)
+            {
+                depot.empty = empty->next;
+
+                previous->next = depot.full;
+                depot.full = previous;
+                ++depot.full_count;
+            }
+        }
+        else
+            overflow = true;
+    }
+
+    if (empty == nullptr)
+    {
+        Locker<CriticalSection> locker(_state->lock);
+
+        // Allocate a new empty magazine
+        if (!overflow)
+            empty = AllocateMagazine(*_state);
+
+        if (empty != nullptr)
+        {
+            Locker<SpinLock> depot_locker(depot.lock);
+
+            previous->next = depot.full;
+            depot.full = previous;
+            ++depot.full_count;
+        }
+        else
+        {
+            // Depot overflow... return all blocks of the previous magazine back to the memory pool
+            FlushMagazine(*_state, previous, index);
+            empty = previous;
+        }
+    }
+
+    previous = loaded;
+    loaded = empty;
+    loaded->blocks[loaded->count++] = ptr;
+}
+
+template <class TAuxMemoryManager>
+inline typename ThreadCacheMemoryManager<TAuxMemoryManager>::Magazine* ThreadCacheMemoryManager<TAuxMemoryManager>::AllocateMagazine(State& state)
+{
+    Magazine* magazine = (Magazine*)state.pool.auxiliary().malloc(sizeof(Magazine), alignof(Magazine));
+    if (magazine != nullptr)
+    {
+        magazine->next = nullptr;
+        magazine->count = 0;
+    }
+    return magazine;
+}
+
+template <class TAuxMemoryManager>
+inline void ThreadCacheMemoryManager<TAuxMemoryManager>::FlushMagazine(State& state, Magazine* magazine, size_t index)
+{
+    size_t block = ClassSize(index);
+    while (magazine->count > 0)
+        state.pool.free(magazine->blocks[--magazine->count], block);
+}
+
+template <class TAuxMemoryManager>
+inline void ThreadCacheMemoryManager<TAuxMemoryManager>::FlushAll(bool release)
+{
+    TAuxMemoryManager& auxiliary = _state->pool.auxiliary();
+
+    // Flush magazines of all thread caches
+    for (Cache* cache = _state->caches; cache != nullptr; cache = cache->next)
+    {
+        for (size_t i = 0; i < Classes; ++i)
+        {
+            for (Magazine** magazine : { &cache->loaded[i], &cache->previous[i] })
+            {
+                if (*magazine == nullptr)
+                    continue;
+
+                FlushMagazine(*_state, *magazine, i);
+
+                if (release)
+                {
+                    auxiliary.free(*magazine, sizeof(Magazine));
+                    *magazine = nullptr;
+                }
+            }
+        }
+
+        cache->allocated.store(0, std::memory_order_relaxed);
+        cache->allocations.store(0, std::memory_order_relaxed);
+    }
+
+    // Flush magazines of the depot
+    for (size_t i = 0; i < Classes; ++i)
+    {
+        Depot& depot = _state->depots[i];
+        Locker<SpinLock> locker(depot.lock);
+
+        while (depot.full != nullptr)
+        {
+            Magazine* magazine = depot.full;
+            depot.full = magazine->next;
+
+            FlushMagazine(*_state, magazine, i);
+
+            magazine->next = depot.empty;
+            depot.empty = magazine;
+        }
+        depot.full_count = 0;
+
+        if (release)
+        {
+            while (depot.empty != nullptr)
+            {
+                Magazine* magazine = depot.empty;
+                depot.empty = magazine->next;
+                auxiliary.free(magazine, sizeof(Magazine));
+            }
+        }
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,175 @@
+/*!
+    \file heap_profiler.h
+    \brief Sampling heap profiler definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_HEAP_PROFILER_H
+#define CPPCOMMON_MEMORY_HEAP_PROFILER_H
+
+#include "memory/allocator.h"
+#include "system/stack_trace.h"
+
+#include <ostream>
+#include <vector>
+
+namespace CppCommon {
+
+//! Heap profile allocation site
+/*!
+    All bytes values are estimated from samples.
+*/
+struct HeapProfileSite
+{
+    StackTrace stack;       //!< Allocation site stack trace
+    uint64_t samples;       //!< Count of sampled allocations
+    uint64_t allocated;     //!< Total allocated bytes
+    uint64_t live;          //!< Live bytes
+    uint64_t peak;          //!< Peak live bytes
+};
+
+//! Sampling heap profiler static class
+/*!
+    Sampling heap profiler samples about one allocation per the given count
+    of allocated bytes (sampling rate) and keeps estimated total, live and
+    peak bytes per allocation site. Allocation sites are identified by raw
+    stack frames, so the expensive symbolized StackTrace is captured only
+    once per unique allocation site.
+
+    Non-sampled allocations cost a thread-local counter update. Non-sampled
+    deallocations cost a lookup in a lock-free counting filter of sampled
+    blocks. Only sampled allocations and their deallocations take the lock,
+    so the profiler overhead is bounded by the sampling rate.
+
+    Profiler is fed by ProfilerMemoryManager or by global operator new and
+    delete replaced with "memory/heap_profiler_new.h".
+
+    Thread-safe.
+*/
+class HeapProfiler
+{
+public:
+    HeapProfiler() = delete;
+    HeapProfiler(const HeapProfiler&) = delete;
+    HeapProfiler(HeapProfiler&&) = delete;
+    ~HeapProfiler() = delete;
+
+    HeapProfiler& operator=(const HeapProfiler&) = delete;
+    HeapProfiler& operator=(HeapProfiler&&) = delete;
+
+    //! Start heap profiling
+    /*!
+        \param rate - Sampling rate in bytes (default is 512 kilobytes)
+    */
+    static void Start(size_t rate = 512 * 1024);
+    //! Stop heap profiling
+    /*!
+        Collected heap profile is preserved until the next start.
+    */
+    static void Stop();
+
+    //! Is heap profiling running?
+    static bool IsRunning() noexcept;
+    //! Get sampling rate in bytes
+    static size_t GetRate() noexcept;
+
+    //! Record the memory block allocation
+    /*!
+        \param ptr - Pointer to the allocated memory block
+        \param size - Block size
+    */
+    static void RecordAllocation(void* ptr, size_t size) noexcept;
+    //! Record the memory block deallocation
+    /*!
+        \param ptr - Pointer to the deallocated memory block
+    */
+    static void RecordDeallocation(void* ptr) noexcept;
+
+    //! Get estimated live bytes
+    static uint64_t GetLive();
+    //! Get estimated peak live bytes
+    static uint64_t GetPeak();
+
+    //! Get heap profile allocation sites sorted by live bytes
+    /*!
+        \param top - Maximal count of allocation sites (default is unlimited)
+        \return Heap profile allocation sites
+    */
+    static std::vector<HeapProfileSite> GetSites(size_t top = std::numeric_limits<size_t>::max());
+
+    //! Dump top allocation sites into the given output stream
+    /*!
+        \param stream - Output stream
+        \param top - Maximal count of allocation sites (default is 10)
+    */
+    static void Dump(std::ostream& stream, size_t top = 10);
+};
+
+//! Profiler memory manager class
+/*!
+    Profiler memory manager is a decorator over another memory manager
+    which records all allocations and deallocations in the heap profiler.
+
+    Thread-safe if the decorated memory manager is thread-safe.
+*/
+template <class TMemoryManager>
+class ProfilerMemoryManager
+{
+public:
+    //! Initialize profiler memory manager with a decorated memory manager
+    /*!
+        \param manager - Decorated memory manager
+    */
+    explicit ProfilerMemoryManager(TMemoryManager& manager) noexcept : _manager(manager) {}
+    ProfilerMemoryManager(const ProfilerMemoryManager&) = delete;
+    ProfilerMemoryManager(ProfilerMemoryManager&&) = delete;
+    ~ProfilerMemoryManager() = default;
+
+    ProfilerMemoryManager& operator=(const ProfilerMemoryManager&) = delete;
+    ProfilerMemoryManager& operator=(ProfilerMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _manager.allocated(); }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _manager.allocations(); }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _manager.max_size(); }
+
+    //! Decorated memory manager
+    TMemoryManager& manager() noexcept { return _manager; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset() { _manager.reset(); }
+
+private:
+    TMemoryManager& _manager;
+};
+
+//! Profiler memory allocator class
+template <typename T, class TMemoryManager, bool nothrow = false>
+using ProfilerAllocator = Allocator<T, ProfilerMemoryManager<TMemoryManager>, nothrow>;
+
+/*! \example memory_heap_profiler.cpp Sampling heap profiler example */
+
+} // namespace CppCommon
+
+#include "heap_profiler.inl"
+
+#endif // CPPCOMMON_MEMORY_HEAP_PROFILER_H
@@ -0,0 +1,27 @@
+/*!
+    \file heap_profiler.inl
+    \brief Sampling heap profiler inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TMemoryManager>
+inline void* ProfilerMemoryManager<TMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    void* result = _manager.malloc(size, alignment);
+    if (result != nullptr)
+        HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+template <class TMemoryManager>
+inline void ProfilerMemoryManager<TMemoryManager>::free(void* ptr, size_t size)
+{
+    HeapProfiler::RecordDeallocation(ptr);
+    _manager.free(ptr, size);
+}
+
+} // namespace CppCommon
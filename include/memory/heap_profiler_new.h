@@ -0,0 +1,197 @@
+/*!
+    \file heap_profiler_new.h
+    \brief Sampling heap profiler global operator new/delete replacement (including aligned forms). Include this file in exactly one translation unit to profile global operator new/delete.
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_HEAP_PROFILER_NEW_H
+#define CPPCOMMON_MEMORY_HEAP_PROFILER_NEW_H
+
+#include "memory/heap_profiler.h"
+
+#include <cstdlib>
+#include <new>
+#if defined(_WIN32) || defined(_WIN64)
+#include <malloc.h>
+#endif
+
+//! @cond INTERNALS
+
+namespace CppCommon {
+namespace Internals {
+
+inline void* HeapProfilerAlignedMalloc(size_t size, std::align_val_t alignment) noexcept
+{
+    size = (size > 0) ? size : 1;
+#if defined(_WIN32) || defined(_WIN64)
+    return _aligned_malloc(size, (size_t)alignment);
+#else
+    void* result = nullptr;
+    return (posix_memalign(&result, (size_t)alignment, size) == 0) ? result : nullptr;
+#endif
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete" // GCC: warning: 'void free(void*)' called on pointer returned from a mismatched allocation function
+#endif
+
+inline void HeapProfilerAlignedFree(void* ptr) noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+} // namespace Internals
+} // namespace CppCommon
+
+void* operator new(size_t size)
+{
+    void* result = std::malloc((size > 0) ? size : 1);
+    if (result == nullptr)
+        throw std::bad_alloc();
+    CppCommon::HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+void* operator new[](size_t size)
+{
+    void* result = std::malloc((size > 0) ? size : 1);
+    if (result == nullptr)
+        throw std::bad_alloc();
+    CppCommon::HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    void* result = std::malloc((size > 0) ? size : 1);
+    CppCommon::HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    void* result = std::malloc((size > 0) ? size : 1);
+    CppCommon::HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    std::free(ptr);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    void* result = CppCommon::Internals::HeapProfilerAlignedMalloc(size, alignment);
+    if (result == nullptr)
+        throw std::bad_alloc();
+    CppCommon::HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    void* result = CppCommon::Internals::HeapProfilerAlignedMalloc(size, alignment);
+    if (result == nullptr)
+        throw std::bad_alloc();
+    CppCommon::HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    void* result = CppCommon::Internals::HeapProfilerAlignedMalloc(size, alignment);
+    CppCommon::HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    void* result = CppCommon::Internals::HeapProfilerAlignedMalloc(size, alignment);
+    CppCommon::HeapProfiler::RecordAllocation(result, size);
+    return result;
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    CppCommon::Internals::HeapProfilerAlignedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    CppCommon::Internals::HeapProfilerAlignedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    CppCommon::Internals::HeapProfilerAlignedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    CppCommon::Internals::HeapProfilerAlignedFree(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    CppCommon::Internals::HeapProfilerAlignedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    CppCommon::HeapProfiler::RecordDeallocation(ptr);
+    CppCommon::Internals::HeapProfilerAlignedFree(ptr);
+}
+
+//! @endcond
+
+/*! \example memory_heap_profiler.cpp Sampling heap profiler example */
+
+#endif // CPPCOMMON_MEMORY_HEAP_PROFILER_NEW_H
@@ -40,12 +40,23 @@ public:
     Memory& operator=(Memory&&) = delete;
 
     //! Total RAM in bytes
+    /*!
+        Total RAM is read once and cached.
+    */
     static int64_t RamTotal();
     //! Free RAM in bytes
+    /*!
+        Use MemoryTelemetry to poll the process memory usage.
+    */
     static int64_t RamFree();
+    //! Last level cache size in bytes
+    static size_t CacheSize();
 
     //! Is the given memory buffer filled with zeros?
     /*!
+        The best available SIMD implementation (AVX-512, AVX2, SSE2)
+        is selected at runtime.
+
         \param buffer - Memory buffer
         \param size - Size of memory buffer in bytes
         \return 'true' if the given memory buffer is filled with zeros, 'false' if the memory buffer is not filled with zeros
@@ -80,12 +91,18 @@ public:
 
     //! Fill the given memory buffer with zeros
     /*!
+        Buffers larger than the last level cache are filled with
+        non-temporal stores to avoid the cache pollution.
+
         \param buffer - Memory buffer to fill
         \param size - Size of memory buffer in bytes
     */
     static void ZeroFill(void* buffer, size_t size);
     //! Fill the given memory buffer with random bytes
     /*!
+        Fast non-cryptographic random generator (xoshiro256**) is used.
+        Use CryptoFill() for cryptographic strong random bytes.
+
         \param buffer - Memory buffer to fill
         \param size - Size of memory buffer in bytes
     */
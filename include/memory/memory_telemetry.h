@@ -0,0 +1,125 @@
+/*!
+    \file memory_telemetry.h
+    \brief Process memory telemetry definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_MEMORY_TELEMETRY_H
+#define CPPCOMMON_MEMORY_MEMORY_TELEMETRY_H
+
+#include "time/timespan.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Process memory usage snapshot
+/*!
+    All memory values are in bytes. Values that are not available on the
+    current platform are set to -1.
+*/
+struct MemoryUsage
+{
+    uint64_t timestamp;     //!< Snapshot high resolution timestamp (nanoseconds)
+    uint64_t detailed;      //!< Detailed statistics high resolution timestamp (nanoseconds)
+
+    int64_t ram_total;      //!< Total RAM of the host
+    int64_t ram_free;       //!< Free RAM of the host
+
+    int64_t rss;            //!< Resident set size
+    int64_t pss;            //!< Proportional set size
+    int64_t anonymous;      //!< Resident anonymous memory
+    int64_t file;           //!< Resident file-backed memory
+    int64_t shmem;          //!< Resident shared memory
+    int64_t swap;           //!< Swapped out anonymous memory
+    int64_t huge_pages;     //!< Anonymous transparent huge pages
+    int64_t hugetlb;        //!< HugeTLB pages
+
+    int64_t cgroup_limit;   //!< Control group memory limit (-1 if unlimited or not available)
+    int64_t cgroup_usage;   //!< Control group memory usage
+
+    int64_t minor_faults;   //!< Minor page faults count
+    int64_t major_faults;   //!< Major page faults count
+
+    MemoryUsage() noexcept;
+
+    //! Available memory in bytes before the control group memory limit is reached
+    /*!
+        \return Available memory or -1 if the control group memory limit is not set
+    */
+    int64_t cgroup_available() const noexcept
+    { return ((cgroup_limit >= 0) && (cgroup_usage >= 0)) ? std::max(cgroup_limit - cgroup_usage, (int64_t)0) : -1; }
+};
+
+//! Process memory telemetry
+/*!
+    Process memory telemetry collects memory usage of the current process
+    with a low overhead, so it could be polled every few milliseconds
+    (e.g. by admission controllers).
+
+    On Linux procfs and cgroupfs files are opened once and re-read with a
+    single pread() call into the preallocated buffer. Cheap statistics
+    (resident set size, page faults, control group usage) are refreshed
+    not more often than the given update interval. Statistics that require the
+    kernel to walk the process memory map (proportional set size, huge
+    pages, anonymous and file-backed memory, control group limit) are
+    refreshed not more often than the given detailed update interval. Calls
+    within the interval return the cached snapshot.
+
+    Cached procfs descriptors belong to the process which created the
+    telemetry, so the telemetry must be re-created in the forked child.
+
+    On Windows and macOS only the resident set size, anonymous memory and
+    page faults are available.
+
+    Thread-safe.
+*/
+class MemoryTelemetry
+{
+public:
+    //! Initialize process memory telemetry with given update intervals
+    /*!
+        \param interval - Update interval (default is 1 millisecond)
+        \param detailed - Detailed update interval (default is 100 milliseconds)
+    */
+    explicit MemoryTelemetry(const Timespan& interval = Timespan::milliseconds(1), const Timespan& detailed = Timespan::milliseconds(100));
+    MemoryTelemetry(const MemoryTelemetry&) = delete;
+    MemoryTelemetry(MemoryTelemetry&&) = delete;
+    ~MemoryTelemetry();
+
+    MemoryTelemetry& operator=(const MemoryTelemetry&) = delete;
+    MemoryTelemetry& operator=(MemoryTelemetry&&) = delete;
+
+    //! Get the update interval
+    const Timespan& interval() const noexcept;
+    //! Get the detailed update interval
+    const Timespan& detailed() const noexcept;
+
+    //! Get the process memory usage snapshot
+    /*!
+        Refreshes statistics if their update interval is expired.
+
+        \return Process memory usage snapshot
+    */
+    MemoryUsage Usage();
+
+    //! Get the process memory usage snapshot ignoring update intervals
+    /*!
+        \return Process memory usage snapshot
+    */
+    MemoryUsage Refresh();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+};
+
+/*! \example memory_telemetry.cpp Process memory telemetry example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_MEMORY_TELEMETRY_H
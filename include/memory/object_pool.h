@@ -0,0 +1,306 @@
+/*!
+    \file object_pool.h
+    \brief Object pool with generational handles definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_OBJECT_POOL_H
+#define CPPCOMMON_MEMORY_OBJECT_POOL_H
+
+#include "allocator_pool.h"
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+template <typename T, class TMemoryManager, typename THandle>
+class ObjectPoolIterator;
+template <typename T, class TMemoryManager, typename THandle>
+class ObjectPoolConstIterator;
+
+//! Object pool class
+/*!
+    Object pool stores objects of the same type in chunks allocated from
+    the given memory manager (pool memory manager by default). Chunks are
+    never moved or released until the pool is cleared, so pointers to live
+    objects remain stable.
+
+    Each object is referenced by a handle which contains a slot index and
+    a slot generation. The generation is incremented each time the object
+    is destroyed, so stale handles are detected in O(1) and never resolve
+    to a newly created object which reuses the same slot. 32-bit handles
+    use 20 bits of index and 12 bits of generation, 64-bit handles use 32
+    bits of index and 32 bits of generation. The zero handle is invalid.
+
+    When the slot generation is exhausted the slot is retired instead of
+    wrapping its generation around, so a retired slot is never reused until
+    the pool is cleared. With 32-bit handles each slot could be reused about
+    4K times, so long-living pools with high churn should prefer 64-bit handles.
+
+    Live objects are tracked in a dense array of slot indices, so iteration
+    visits only live objects in an unspecified order. Destroying the object
+    under the iterator moves the last live object into its position, so the
+    iterator should not be incremented after such destroy.
+
+    Not thread-safe.
+*/
+template <typename T, class TMemoryManager = PoolMemoryManager<DefaultMemoryManager>, typename THandle = uint64_t>
+class ObjectPool
+{
+    static_assert(std::is_same<THandle, uint32_t>::value || std::is_same<THandle, uint64_t>::value, "Object pool handle must be 32-bit or 64-bit unsigned integer!");
+
+    friend class ObjectPoolIterator<T, TMemoryManager, THandle>;
+    friend class ObjectPoolConstIterator<T, TMemoryManager, THandle>;
+
+public:
+    // Standard container type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef THandle handle_type;
+    typedef ObjectPoolIterator<T, TMemoryManager, THandle> iterator;
+    typedef ObjectPoolConstIterator<T, TMemoryManager, THandle> const_iterator;
+
+    //! Count of handle bits used for the slot index
+    static const size_t IndexBits = (sizeof(THandle) == 4) ? 20 : 32;
+    //! Count of handle bits used for the slot generation
+    static const size_t GenerationBits = (sizeof(THandle) * 8) - IndexBits;
+    //! Invalid handle
+    static const THandle Invalid = 0;
+
+    //! Initialize object pool with a given memory manager
+    /*!
+        \param manager - Memory manager
+        \param chunk - Count of objects in a single chunk, must be a power of two (default is 1024)
+    */
+    explicit ObjectPool(TMemoryManager& manager, size_t chunk = 1024);
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    ~ObjectPool() { clear(); }
+
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+
+    //! Check if the object pool is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the object pool empty?
+    bool empty() const noexcept { return _dense.empty(); }
+
+    //! Get the count of live objects
+    size_t size() const noexcept { return _dense.size(); }
+    //! Get the count of allocated object slots
+    size_t capacity() const noexcept { return _chunks.size() * _chunk; }
+    //! Get the count of objects in a single chunk
+    size_t chunk() const noexcept { return _chunk; }
+    //! Get the count of allocated chunks
+    size_t chunks() const noexcept { return _chunks.size(); }
+    //! Get the count of retired object slots with exhausted generation
+    size_t retired() const noexcept { return _retired; }
+
+    //! Maximum count of objects, that could be stored in the object pool
+    static constexpr size_t max_size() noexcept { return ((size_t)1 << IndexBits) - 1; }
+
+    //! Memory manager
+    TMemoryManager& manager() noexcept { return _manager; }
+
+    //! Get the begin object pool iterator
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    //! Get the end object pool iterator
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    //! Create a new object in the object pool
+    /*!
+        Will throw std::bad_alloc if the memory manager fails to allocate
+        a new chunk or the object pool is full.
+
+        \param args - Object constructor arguments
+        \return Handle of the created object
+    */
+    template <typename... Args>
+    THandle create(Args&&... args);
+    //! Destroy the object with the given handle
+    /*!
+        \param handle - Object handle
+        \return 'true' if the object was destroyed, 'false' if the handle is stale or invalid
+    */
+    bool destroy(THandle handle);
+
+    //! Is the given handle references a live object?
+    bool valid(THandle handle) const noexcept { return find(handle) != nullptr; }
+
+    //! Get the object with the given handle
+    /*!
+        \param handle - Object handle
+        \return Pointer to the object or nullptr if the handle is stale or invalid
+    */
+    T* get(THandle handle) noexcept { return const_cast<T*>(find(handle)); }
+    //! Get the constant object with the given handle
+    /*!
+        \param handle - Object handle
+        \return Pointer to the constant object or nullptr if the handle is stale or invalid
+    */
+    const T* get(THandle handle) const noexcept { return find(handle); }
+
+    //! Clear the object pool
+    /*!
+        Destroys all live objects and releases all chunks including retired
+        slots. Handles created before the clear must not be used after it.
+    */
+    void clear();
+
+    //! Reserve object pool capacity for the given count of objects
+    /*!
+        \param capacity - Object pool capacity
+    */
+    void reserve(size_t capacity);
+
+private:
+    // Object slot
+    struct Slot
+    {
+        alignas(T) uint8_t storage[sizeof(T)];
+        THandle generation;
+        THandle index;      // Dense array index of the live object or the next free slot index
+        bool alive;
+
+        T* object() noexcept { return reinterpret_cast<T*>(storage); }
+        const T* object() const noexcept { return reinterpret_cast<const T*>(storage); }
+    };
+
+    static const THandle IndexMask = (THandle)(((THandle)1 << IndexBits) - 1);
+    static const THandle GenerationMask = (THandle)(((THandle)1 << GenerationBits) - 1);
+    static const THandle NoSlot = IndexMask;
+
+    TMemoryManager& _manager;
+    size_t _chunk;
+    size_t _shift;
+    // Chunks of object slots
+    std::vector<Slot*> _chunks;
+    // Dense array of live object slot indexes
+    std::vector<THandle> _dense;
+    // Free slots list
+    THandle _free;
+    // Count of retired slots
+    size_t _retired;
+
+    Slot& slot(THandle index) noexcept { return _chunks[index >> _shift][index & (_chunk - 1)]; }
+    const Slot& slot(THandle index) const noexcept { return _chunks[index >> _shift][index & (_chunk - 1)]; }
+
+    //! Make a handle from the slot index and generation
+    static THandle MakeHandle(THandle index, THandle generation) noexcept { return (THandle)((generation << IndexBits) | index); }
+
+    //! Find the live object with the given handle
+    const T* find(THandle handle) const noexcept;
+    //! Allocate a new chunk of object slots
+    void AllocateChunk();
+};
+
+//! Object pool iterator
+template <typename T, class TMemoryManager, typename THandle>
+class ObjectPoolIterator
+{
+    friend ObjectPoolConstIterator<T, TMemoryManager, THandle>;
+
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    ObjectPoolIterator() noexcept : _pool(nullptr), _index(0) {}
+    explicit ObjectPoolIterator(ObjectPool<T, TMemoryManager, THandle>* pool, size_t index) noexcept : _pool(pool), _index(index) {}
+    ObjectPoolIterator(const ObjectPoolIterator& it) noexcept = default;
+    ObjectPoolIterator(ObjectPoolIterator&& it) noexcept = default;
+    ~ObjectPoolIterator() noexcept = default;
+
+    ObjectPoolIterator& operator=(const ObjectPoolIterator& it) noexcept = default;
+    ObjectPoolIterator& operator=(ObjectPoolIterator&& it) noexcept = default;
+
+    friend bool operator==(const ObjectPoolIterator& it1, const ObjectPoolIterator& it2) noexcept
+    { return (it1._pool == it2._pool) && (it1._index == it2._index); }
+    friend bool operator!=(const ObjectPoolIterator& it1, const ObjectPoolIterator& it2) noexcept
+    { return !operator==(it1, it2); }
+
+    ObjectPoolIterator& operator++() noexcept { ++_index; return *this; }
+    ObjectPoolIterator operator++(int) noexcept { ObjectPoolIterator result(*this); ++_index; return result; }
+
+    reference operator*() noexcept;
+    pointer operator->() noexcept;
+
+    //! Get the handle of the current object
+    THandle handle() const noexcept;
+
+private:
+    ObjectPool<T, TMemoryManager, THandle>* _pool;
+    size_t _index;
+};
+
+//! Object pool constant iterator
+template <typename T, class TMemoryManager, typename THandle>
+class ObjectPoolConstIterator
+{
+public:
+    // Standard iterator type definitions
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    ObjectPoolConstIterator() noexcept : _pool(nullptr), _index(0) {}
+    explicit ObjectPoolConstIterator(const ObjectPool<T, TMemoryManager, THandle>* pool, size_t index) noexcept : _pool(pool), _index(index) {}
+    ObjectPoolConstIterator(const ObjectPoolIterator<T, TMemoryManager, THandle>& it) noexcept : _pool(it._pool), _index(it._index) {}
+    ObjectPoolConstIterator(const ObjectPoolConstIterator& it) noexcept = default;
+    ObjectPoolConstIterator(ObjectPoolConstIterator&& it) noexcept = default;
+    ~ObjectPoolConstIterator() noexcept = default;
+
+    ObjectPoolConstIterator& operator=(const ObjectPoolConstIterator& it) noexcept = default;
+    ObjectPoolConstIterator& operator=(ObjectPoolConstIterator&& it) noexcept = default;
+
+    friend bool operator==(const ObjectPoolConstIterator& it1, const ObjectPoolConstIterator& it2) noexcept
+    { return (it1._pool == it2._pool) && (it1._index == it2._index); }
+    friend bool operator!=(const ObjectPoolConstIterator& it1, const ObjectPoolConstIterator& it2) noexcept
+    { return !operator==(it1, it2); }
+
+    ObjectPoolConstIterator& operator++() noexcept { ++_index; return *this; }
+    ObjectPoolConstIterator operator++(int) noexcept { ObjectPoolConstIterator result(*this); ++_index; return result; }
+
+    const_reference operator*() const noexcept;
+    const_pointer operator->() const noexcept;
+
+    //! Get the handle of the current object
+    THandle handle() const noexcept;
+
+private:
+    const ObjectPool<T, TMemoryManager, THandle>* _pool;
+    size_t _index;
+};
+
+/*! \example memory_object_pool.cpp Object pool with generational handles example */
+
+} // namespace CppCommon
+
+#include "object_pool.inl"
+
+#endif // CPPCOMMON_MEMORY_OBJECT_POOL_H
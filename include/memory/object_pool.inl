@@ -0,0 +1,246 @@
+/*!
+    \file object_pool.inl
+    \brief Object pool with generational handles inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T, class TMemoryManager, typename THandle>
+inline ObjectPool<T, TMemoryManager, THandle>::ObjectPool(TMemoryManager& manager, size_t chunk)
+    : _manager(manager),
+      _chunk(chunk),
+      _shift(0),
+      _free(NoSlot),
+      _retired(0)
+{
+    assert((chunk > 0) && ((chunk & (chunk - 1)) == 0) && "Object pool chunk size must be a power of two!");
+
+    while (((size_t)1 << _shift) < _chunk)
+        ++_shift;
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPool<T, TMemoryManager, THandle>::iterator ObjectPool<T, TMemoryManager, THandle>::begin() noexcept
+{
+    return iterator(this, 0);
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPool<T, TMemoryManager, THandle>::const_iterator ObjectPool<T, TMemoryManager, THandle>::begin() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPool<T, TMemoryManager, THandle>::const_iterator ObjectPool<T, TMemoryManager, THandle>::cbegin() const noexcept
+{
+    return const_iterator(this, 0);
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPool<T, TMemoryManager, THandle>::iterator ObjectPool<T, TMemoryManager, THandle>::end() noexcept
+{
+    return iterator(this, _dense.size());
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPool<T, TMemoryManager, THandle>::const_iterator ObjectPool<T, TMemoryManager, THandle>::end() const noexcept
+{
+    return const_iterator(this, _dense.size());
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPool<T, TMemoryManager, THandle>::const_iterator ObjectPool<T, TMemoryManager, THandle>::cend() const noexcept
+{
+    return const_iterator(this, _dense.size());
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+template <typename... Args>
+inline THandle ObjectPool<T, TMemoryManager, THandle>::create(Args&&... args)
+{
+    // Allocate a new chunk if there are no free slots
+    if (_free == NoSlot)
+        AllocateChunk();
+
+    THandle index = _free;
+    Slot& current = slot(index);
+
+    // Reserve the dense array entry before the object construction
+    _dense.push_back(index);
+
+    try
+    {
+        new (current.object()) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        _dense.pop_back();
+        throw;
+    }
+
+    // Unlink the slot from the free list
+    _free = current.index;
+
+    current.index = (THandle)(_dense.size() - 1);
+    current.alive = true;
+
+    return MakeHandle(index, current.generation);
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline bool ObjectPool<T, TMemoryManager, THandle>::destroy(THandle handle)
+{
+    if (find(handle) == nullptr)
+        return false;
+
+    THandle index = handle & IndexMask;
+    Slot& current = slot(index);
+
+    // Destroy the object
+    current.object()->~T();
+
+    // Remove the slot index from the dense array with the last entry swap
+    THandle dense = current.index;
+    THandle last = _dense.back();
+    _dense[dense] = last;
+    slot(last).index = dense;
+    _dense.pop_back();
+
+    current.alive = false;
+
+    // Retire the slot with exhausted generation, so stale handles never resolve
+    if (current.generation == GenerationMask)
+    {
+        ++_retired;
+        return true;
+    }
+
+    // Invalidate all handles of the slot and link it into the free list
+    ++current.generation;
+    current.index = _free;
+    _free = index;
+
+    return true;
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline void ObjectPool<T, TMemoryManager, THandle>::clear()
+{
+    // Destroy all live objects
+    for (THandle index : _dense)
+        slot(index).object()->~T();
+    _dense.clear();
+
+    // Release all chunks
+    for (Slot* chunk : _chunks)
+        _manager.free(chunk, _chunk * sizeof(Slot));
+    _chunks.clear();
+
+    _free = NoSlot;
+    _retired = 0;
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline void ObjectPool<T, TMemoryManager, THandle>::reserve(size_t capacity)
+{
+    while (this->capacity() < capacity)
+        AllocateChunk();
+    _dense.reserve(capacity);
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline const T* ObjectPool<T, TMemoryManager, THandle>::find(THandle handle) const noexcept
+{
+    THandle index = handle & IndexMask;
+    if ((index >> _shift) >= _chunks.size())
+        return nullptr;
+
+    const Slot& current = slot(index);
+    if (!current.alive || (current.generation != (handle >> IndexBits)))
+        return nullptr;
+
+    return current.object();
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline void ObjectPool<T, TMemoryManager, THandle>::AllocateChunk()
+{
+    size_t first = capacity();
+    if ((first + _chunk) > max_size())
+        throw std::bad_alloc();
+
+    Slot* chunk = (Slot*)_manager.malloc(_chunk * sizeof(Slot), alignof(Slot));
+    if (chunk == nullptr)
+        throw std::bad_alloc();
+
+    try
+    {
+        _chunks.push_back(chunk);
+    }
+    catch (...)
+    {
+        _manager.free(chunk, _chunk * sizeof(Slot));
+        throw;
+    }
+
+    // Link all chunk slots into the free list in the ascending order
+    for (size_t i = 0; i < _chunk; ++i)
+    {
+        chunk[i].generation = 1;
+        chunk[i].index = ((i + 1) < _chunk) ? (THandle)(first + i + 1) : _free;
+        chunk[i].alive = false;
+    }
+    _free = (THandle)first;
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPoolIterator<T, TMemoryManager, THandle>::reference ObjectPoolIterator<T, TMemoryManager, THandle>::operator*() noexcept
+{
+    assert((_pool != nullptr) && (_index < _pool->_dense.size()) && "Iterator must be valid!");
+
+    return *_pool->slot(_pool->_dense[_index]).object();
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPoolIterator<T, TMemoryManager, THandle>::pointer ObjectPoolIterator<T, TMemoryManager, THandle>::operator->() noexcept
+{
+    return ((_pool != nullptr) && (_index < _pool->_dense.size())) ? _pool->slot(_pool->_dense[_index]).object() : nullptr;
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline THandle ObjectPoolIterator<T, TMemoryManager, THandle>::handle() const noexcept
+{
+    assert((_pool != nullptr) && (_index < _pool->_dense.size()) && "Iterator must be valid!");
+
+    THandle index = _pool->_dense[_index];
+    return ObjectPool<T, TMemoryManager, THandle>::MakeHandle(index, _pool->slot(index).generation);
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPoolConstIterator<T, TMemoryManager, THandle>::const_reference ObjectPoolConstIterator<T, TMemoryManager, THandle>::operator*() const noexcept
+{
+    assert((_pool != nullptr) && (_index < _pool->_dense.size()) && "Iterator must be valid!");
+
+    return *_pool->slot(_pool->_dense[_index]).object();
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline typename ObjectPoolConstIterator<T, TMemoryManager, THandle>::const_pointer ObjectPoolConstIterator<T, TMemoryManager, THandle>::operator->() const noexcept
+{
+    return ((_pool != nullptr) && (_index < _pool->_dense.size())) ? _pool->slot(_pool->_dense[_index]).object() : nullptr;
+}
+
+template <typename T, class TMemoryManager, typename THandle>
+inline THandle ObjectPoolConstIterator<T, TMemoryManager, THandle>::handle() const noexcept
+{
+    assert((_pool != nullptr) && (_index < _pool->_dense.size()) && "Iterator must be valid!");
+
+    THandle index = _pool->_dense[_index];
+    return ObjectPool<T, TMemoryManager, THandle>::MakeHandle(index, _pool->slot(index).generation);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,107 @@
+/*!
+    \file async_event_auto_reset.h
+    \brief Coroutine auto-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
+#define CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
+
+#include "threads/async_task.h"
+
+namespace CppCommon {
+
+//! Coroutine auto-reset event synchronization primitive
+/*!
+    Coroutine auto-reset event is a counterpart of EventAutoReset which
+    suspends awaiting coroutines instead of blocking threads. Each signal
+    resumes exactly one suspended coroutine with its executor in FIFO order.
+    If there are no suspended coroutines the event stays signaled until the
+    next await.
+
+    Usage: co_await event or co_await event.Wait(executor)
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
+*/
+class AsyncEventAutoReset
+{
+public:
+    //! Event awaiter
+    class Awaiter : private Internals::AsyncWaiter
+    {
+        friend class AsyncEventAutoReset;
+
+    public:
+        Awaiter(const Awaiter&) = delete;
+        Awaiter(Awaiter&&) = delete;
+
+        Awaiter& operator=(const Awaiter&) = delete;
+        Awaiter& operator=(Awaiter&&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const noexcept {}
+
+    private:
+        AsyncEventAutoReset& _event;
+
+        Awaiter(AsyncEventAutoReset& event, Executor& exec) noexcept : Internals::AsyncWaiter(exec), _event(event) {}
+    };
+
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit AsyncEventAutoReset(bool signaled = false) noexcept : _signaled(signaled) {}
+    AsyncEventAutoReset(const AsyncEventAutoReset&) = delete;
+    AsyncEventAutoReset(AsyncEventAutoReset&&) = delete;
+    ~AsyncEventAutoReset() = default;
+
+    AsyncEventAutoReset& operator=(const AsyncEventAutoReset&) = delete;
+    AsyncEventAutoReset& operator=(AsyncEventAutoReset&&) = delete;
+
+    //! Signal one of awaiting coroutines about event occurred
+    /*!
+        If some coroutines are suspended on the event one of them will be
+        resumed with its executor.
+
+        Will not block, except for inline resumed coroutine.
+    */
+    void Signal();
+
+    //! Try to take the event without suspension
+    /*!
+        Will not block.
+
+        \return 'true' if the event was occurred before, 'false' if the event was not occurred before
+    */
+    bool TryWait();
+
+    //! Await the event
+    /*!
+        Will suspend the coroutine.
+
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Event awaiter
+    */
+    Awaiter Wait(Executor& executor = Executor::Inline()) noexcept { return Awaiter(*this, executor); }
+    //! Await the event with the inline executor
+    Awaiter operator co_await() noexcept { return Wait(); }
+
+private:
+    CriticalSection _cs;
+    bool _signaled;
+    Internals::AsyncWaiterList _waiters;
+};
+
+/*! \example threads_async_event_auto_reset.cpp Coroutine auto-reset event synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "async_event_auto_reset.inl"
+
+#endif // CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
@@ -0,0 +1,55 @@
+/*!
+    \file async_event_auto_reset.inl
+    \brief Coroutine auto-reset event synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool AsyncEventAutoReset::Awaiter::await_suspend(std::coroutine_handle<> h)
+{
+    handle = h;
+
+    Locker<CriticalSection> locker(_event._cs);
+
+    // Take the pending signal without suspension
+    if (_event._signaled)
+    {
+        _event._signaled = false;
+        return false;
+    }
+
+    _event._waiters.Push(this);
+    return true;
+}
+
+inline void AsyncEventAutoReset::Signal()
+{
+    Internals::AsyncWaiter* waiter;
+
+    {
+        Locker<CriticalSection> locker(_cs);
+        waiter = _waiters.Pop();
+        if (waiter == nullptr)
+            _signaled = true;
+    }
+
+    // Resume the waiter without holding the lock
+    if (waiter != nullptr)
+        waiter->Resume();
+}
+
+inline bool AsyncEventAutoReset::TryWait()
+{
+    Locker<CriticalSection> locker(_cs);
+
+    if (!_signaled)
+        return false;
+
+    _signaled = false;
+    return true;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,108 @@
+/*!
+    \file async_event_manual_reset.h
+    \brief Coroutine manual-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_EVENT_MANUAL_RESET_H
+#define CPPCOMMON_THREADS_ASYNC_EVENT_MANUAL_RESET_H
+
+#include "threads/async_task.h"
+
+namespace CppCommon {
+
+//! Coroutine manual-reset event synchronization primitive
+/*!
+    Coroutine manual-reset event is a counterpart of EventManualReset which
+    suspends awaiting coroutines instead of blocking threads. All suspended
+    coroutines are resumed with their executors when the event is signaled.
+
+    Usage: co_await event or co_await event.Wait(executor)
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
+*/
+class AsyncEventManualReset
+{
+public:
+    //! Event awaiter
+    class Awaiter : private Internals::AsyncWaiter
+    {
+        friend class AsyncEventManualReset;
+
+    public:
+        Awaiter(const Awaiter&) = delete;
+        Awaiter(Awaiter&&) = delete;
+
+        Awaiter& operator=(const Awaiter&) = delete;
+        Awaiter& operator=(Awaiter&&) = delete;
+
+        bool await_ready() const noexcept { return _event.signaled(); }
+        bool await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const noexcept {}
+
+    private:
+        AsyncEventManualReset& _event;
+
+        Awaiter(AsyncEventManualReset& event, Executor& exec) noexcept : Internals::AsyncWaiter(exec), _event(event) {}
+    };
+
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit AsyncEventManualReset(bool signaled = false) noexcept : _signaled(signaled) {}
+    AsyncEventManualReset(const AsyncEventManualReset&) = delete;
+    AsyncEventManualReset(AsyncEventManualReset&&) = delete;
+    ~AsyncEventManualReset() = default;
+
+    AsyncEventManualReset& operator=(const AsyncEventManualReset&) = delete;
+    AsyncEventManualReset& operator=(AsyncEventManualReset&&) = delete;
+
+    //! Is the event signaled?
+    bool signaled() const noexcept { return _signaled.load(std::memory_order_acquire); }
+
+    //! Reset the event
+    /*!
+        If the event is in the signaled state then it will be reset to non signaled state.
+        As the result other coroutines that await the event will be suspended.
+
+        Will not block.
+    */
+    void Reset();
+
+    //! Signal all awaiting coroutines about event occurred
+    /*!
+        All suspended coroutines are resumed with their executors.
+
+        Will not block, except for inline resumed coroutines.
+    */
+    void Signal();
+
+    //! Await the event
+    /*!
+        Will suspend the coroutine.
+
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Event awaiter
+    */
+    Awaiter Wait(Executor& executor = Executor::Inline()) noexcept { return Awaiter(*this, executor); }
+    //! Await the event with the inline executor
+    Awaiter operator co_await() noexcept { return Wait(); }
+
+private:
+    CriticalSection _cs;
+    std::atomic<bool> _signaled;
+    Internals::AsyncWaiterList _waiters;
+};
+
+/*! \example threads_async_event_manual_reset.cpp Coroutine manual-reset event synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "async_event_manual_reset.inl"
+
+#endif // CPPCOMMON_THREADS_ASYNC_EVENT_MANUAL_RESET_H
@@ -0,0 +1,45 @@
+/*!
+    \file async_event_manual_reset.inl
+    \brief Coroutine manual-reset event synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool AsyncEventManualReset::Awaiter::await_suspend(std::coroutine_handle<> h)
+{
+    handle = h;
+
+    Locker<CriticalSection> locker(_event._cs);
+
+    // Do not suspend if the event was signaled meanwhile
+    if (_event._signaled.load(std::memory_order_relaxed))
+        return false;
+
+    _event._waiters.Push(this);
+    return true;
+}
+
+inline void AsyncEventManualReset::Reset()
+{
+    Locker<CriticalSection> locker(_cs);
+    _signaled.store(false, std::memory_order_relaxed);
+}
+
+inline void AsyncEventManualReset::Signal()
+{
+    Internals::AsyncWaiter* waiters;
+
+    {
+        Locker<CriticalSection> locker(_cs);
+        _signaled.store(true, std::memory_order_release);
+        waiters = _waiters.Detach();
+    }
+
+    // Resume all waiters without holding the lock
+    Internals::AsyncWaiterList::ResumeAll(waiters, true);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,104 @@
+/*!
+    \file async_latch.h
+    \brief Coroutine latch synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_LATCH_H
+#define CPPCOMMON_THREADS_ASYNC_LATCH_H
+
+#include "threads/async_task.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+//! Coroutine latch synchronization primitive
+/*!
+    Coroutine latch is a counterpart of Latch which suspends awaiting
+    coroutines instead of blocking threads. All suspended coroutines are
+    resumed with their executors when the latch counter reaches zero.
+
+    Usage: co_await latch or co_await latch.Wait(executor)
+
+    Thread-safe.
+*/
+class AsyncLatch
+{
+public:
+    //! Latch awaiter
+    class Awaiter : private Internals::AsyncWaiter
+    {
+        friend class AsyncLatch;
+
+    public:
+        Awaiter(const Awaiter&) = delete;
+        Awaiter(Awaiter&&) = delete;
+
+        Awaiter& operator=(const Awaiter&) = delete;
+        Awaiter& operator=(Awaiter&&) = delete;
+
+        bool await_ready() const noexcept { return _latch.ready(); }
+        bool await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const noexcept {}
+
+    private:
+        AsyncLatch& _latch;
+
+        Awaiter(AsyncLatch& latch, Executor& exec) noexcept : Internals::AsyncWaiter(exec), _latch(latch) {}
+    };
+
+    //! Default class constructor
+    /*!
+        \param counter - Latch counter initial value
+    */
+    explicit AsyncLatch(size_t counter) noexcept : _counter(counter) {}
+    AsyncLatch(const AsyncLatch&) = delete;
+    AsyncLatch(AsyncLatch&&) = delete;
+    ~AsyncLatch() = default;
+
+    AsyncLatch& operator=(const AsyncLatch&) = delete;
+    AsyncLatch& operator=(AsyncLatch&&) = delete;
+
+    //! Get the latch counter value
+    size_t counter() const noexcept { return _counter.load(std::memory_order_acquire); }
+    //! Is the latch counter reached zero?
+    bool ready() const noexcept { return (counter() == 0); }
+
+    //! Count down the latch counter
+    /*!
+        All suspended coroutines are resumed with their executors when the
+        latch counter reaches zero.
+
+        Will not block, except for inline resumed coroutines.
+
+        \param count - Count to decrease the latch counter (default is 1)
+    */
+    void CountDown(size_t count = 1);
+
+    //! Await the latch counter reaches zero
+    /*!
+        Will suspend the coroutine.
+
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Latch awaiter
+    */
+    Awaiter Wait(Executor& executor = Executor::Inline()) noexcept { return Awaiter(*this, executor); }
+    //! Await the latch with the inline executor
+    Awaiter operator co_await() noexcept { return Wait(); }
+
+private:
+    CriticalSection _cs;
+    std::atomic<size_t> _counter;
+    Internals::AsyncWaiterList _waiters;
+};
+
+/*! \example threads_async_latch.cpp Coroutine latch synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "async_latch.inl"
+
+#endif // CPPCOMMON_THREADS_ASYNC_LATCH_H
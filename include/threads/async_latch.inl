@@ -0,0 +1,45 @@
+/*!
+    \file async_latch.inl
+    \brief Coroutine latch synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool AsyncLatch::Awaiter::await_suspend(std::coroutine_handle<> h)
+{
+    handle = h;
+
+    Locker<CriticalSection> locker(_latch._cs);
+
+    // Do not suspend if the latch counter reached zero meanwhile
+    if (_latch._counter.load(std::memory_order_relaxed) == 0)
+        return false;
+
+    _latch._waiters.Push(this);
+    return true;
+}
+
+inline void AsyncLatch::CountDown(size_t count)
+{
+    Internals::AsyncWaiter* waiters = nullptr;
+
+    {
+        Locker<CriticalSection> locker(_cs);
+
+        size_t counter = _counter.load(std::memory_order_relaxed);
+        assert((count <= counter) && "Latch counter must not be decreased below zero!");
+
+        counter -= std::min(count, counter);
+        _counter.store(counter, std::memory_order_release);
+        if (counter == 0)
+            waiters = _waiters.Detach();
+    }
+
+    // Resume all waiters without holding the lock
+    Internals::AsyncWaiterList::ResumeAll(waiters, true);
+}
+
+} // namespace CppCommon
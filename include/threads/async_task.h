@@ -0,0 +1,273 @@
+/*!
+    \file async_task.h
+    \brief Coroutine task and executors definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_TASK_H
+#define CPPCOMMON_THREADS_ASYNC_TASK_H
+
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+//! Coroutine executor
+/*!
+    Executor decides where the suspended coroutine is resumed when the
+    awaited asynchronous primitive becomes ready.
+
+    Thread-safe.
+*/
+class Executor
+{
+public:
+    virtual ~Executor() = default;
+
+    //! Resume the given coroutine
+    /*!
+        \param handle - Coroutine handle to resume
+    */
+    virtual void Execute(std::coroutine_handle<> handle) = 0;
+
+    //! Get the inline executor
+    static Executor& Inline() noexcept;
+};
+
+//! Inline coroutine executor
+/*!
+    Inline executor resumes the coroutine immediately in the thread which
+    makes the awaited primitive ready (e.g. the thread which signals the
+    event or enqueues the item).
+
+    Thread-safe.
+*/
+class InlineExecutor : public Executor
+{
+public:
+    void Execute(std::coroutine_handle<> handle) override { handle.resume(); }
+};
+
+//! Thread pool coroutine executor
+/*!
+    Thread pool executor posts the coroutine resumption into the given
+    thread pool. Works with any thread pool which provides 'void Post(Fn&& fn)'
+    method, e.g. ThreadPool.
+
+    Thread-safe.
+*/
+template <class TPool>
+class PoolExecutor : public Executor
+{
+public:
+    //! Initialize thread pool executor
+    /*!
+        \param pool - Thread pool
+    */
+    explicit PoolExecutor(TPool& pool) noexcept : _pool(pool) {}
+
+    void Execute(std::coroutine_handle<> handle) override { _pool.Post([handle]() { handle.resume(); }); }
+
+private:
+    TPool& _pool;
+};
+
+template <typename T>
+class Task;
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Suspended coroutine waiting for the asynchronous primitive
+struct AsyncWaiter
+{
+    std::coroutine_handle<> handle;
+    Executor* executor;
+    AsyncWaiter* next;
+    bool result;
+
+    explicit AsyncWaiter(Executor& exec) noexcept : executor(&exec), next(nullptr), result(false) {}
+
+    //! Resume the waiter with its executor
+    void Resume() { executor->Execute(handle); }
+};
+
+//! FIFO list of suspended coroutines
+class AsyncWaiterList
+{
+public:
+    AsyncWaiterList() noexcept : _head(nullptr), _tail(nullptr) {}
+
+    bool empty() const noexcept { return (_head == nullptr); }
+
+    //! Push the waiter at the end of the list
+    void Push(AsyncWaiter* waiter) noexcept;
+    //! Pop the waiter from the front of the list
+    AsyncWaiter* Pop() noexcept;
+    //! Detach all waiters from the list
+    AsyncWaiter* Detach() noexcept;
+
+    //! Resume all detached waiters with the given result
+    static void ResumeAll(AsyncWaiter* waiters, bool result);
+
+private:
+    AsyncWaiter* _head;
+    AsyncWaiter* _tail;
+};
+
+//! Coroutine task promise base
+class TaskPromiseBase
+{
+public:
+    //! Final awaiter transfers the control to the continuation
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept;
+        void await_resume() noexcept {}
+    };
+
+    TaskPromiseBase() noexcept : _completed(false) {}
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() noexcept { _exception = std::current_exception(); }
+
+    bool completed() const noexcept { return _completed.load(std::memory_order_acquire); }
+    void continuation(std::coroutine_handle<> handle) noexcept { _continuation = handle; }
+
+protected:
+    std::coroutine_handle<> _continuation;
+    std::atomic<bool> _completed;
+    std::exception_ptr _exception;
+};
+
+//! Coroutine task promise
+template <typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U&& value) { _value.emplace(std::forward<U>(value)); }
+
+    //! Take the result value or rethrow the result exception
+    T Result();
+
+private:
+    std::optional<T> _value;
+};
+
+//! Coroutine task promise without result
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    //! Rethrow the result exception
+    void Result();
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Coroutine task
+/*!
+    Coroutine task is a lazily started coroutine which returns the result
+    of the given type. The task is started when it is awaited by another
+    coroutine (co_await task), started explicitly with Start() method or
+    waited from the regular thread with SyncWait() function. The exception
+    thrown by the coroutine is re-thrown to the awaiter.
+
+    The task owns the coroutine frame, so it must outlive the coroutine.
+
+    Not thread-safe.
+*/
+template <typename T = void>
+class Task
+{
+    friend class Internals::TaskPromise<T>;
+
+public:
+    typedef Internals::TaskPromise<T> promise_type;
+
+    Task() noexcept = default;
+    Task(const Task&) = delete;
+    Task(Task&& task) noexcept : _handle(std::exchange(task._handle, nullptr)) {}
+    ~Task() { if (_handle) _handle.destroy(); }
+
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&& task) noexcept;
+
+    //! Check if the task is valid
+    explicit operator bool() const noexcept { return valid(); }
+
+    //! Is the task valid?
+    bool valid() const noexcept { return (bool)_handle; }
+    //! Is the task completed?
+    bool done() const noexcept { return _handle && _handle.promise().completed(); }
+
+    //! Start the task without awaiting it
+    /*!
+        The task runs in the current thread until its first suspension point.
+        Use done() to check the task completion and Get() to get its result.
+    */
+    void Start();
+
+    //! Get the result of the completed task
+    /*!
+        The exception thrown by the coroutine is re-thrown.
+
+        \return Task result
+    */
+    T Get();
+
+    //! Await the task from another coroutine
+    auto operator co_await() && noexcept;
+    auto operator co_await() & noexcept;
+
+    //! Await the task completion without taking its result
+    auto Completion() noexcept;
+
+private:
+    std::coroutine_handle<promise_type> _handle;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+};
+
+//! Wait for the coroutine task from the regular thread
+/*!
+    Starts the task and blocks the current thread until the task is
+    completed. The exception thrown by the coroutine is re-thrown.
+
+    Will block.
+
+    \param task - Coroutine task (must not be started)
+    \return Task result
+*/
+template <typename T>
+T SyncWait(Task<T> task);
+
+/*! \example threads_async_task.cpp Coroutine task and executors example */
+
+} // namespace CppCommon
+
+#include "async_task.inl"
+
+#endif // CPPCOMMON_THREADS_ASYNC_TASK_H
@@ -0,0 +1,236 @@
+/*!
+    \file async_task.inl
+    \brief Coroutine task and executors inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline Executor& Executor::Inline() noexcept
+{
+    static InlineExecutor executor;
+    return executor;
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+inline void AsyncWaiterList::Push(AsyncWaiter* waiter) noexcept
+{
+    waiter->next = nullptr;
+    if (_tail != nullptr)
+        _tail->next = waiter;
+    else
+        _head = waiter;
+    _tail = waiter;
+}
+
+inline AsyncWaiter* AsyncWaiterList::Pop() noexcept
+{
+    AsyncWaiter* waiter = _head;
+    if (waiter != nullptr)
+    {
+        _head = waiter->next;
+        if (_head == nullptr)
+            _tail = nullptr;
+    }
+    return waiter;
+}
+
+inline AsyncWaiter* AsyncWaiterList::Detach() noexcept
+{
+    AsyncWaiter* waiters = _head;
+    _head = nullptr;
+    _tail = nullptr;
+    return waiters;
+}
+
+inline void AsyncWaiterList::ResumeAll(AsyncWaiter* waiters, bool result)
+{
+    while (waiters != nullptr)
+    {
+        // Resumed waiter might be destroyed, so take the next one before
+        AsyncWaiter* waiter = waiters;
+        waiters = waiters->next;
+        waiter->result = result;
+        waiter->Resume();
+    }
+}
+
+template <typename TPromise>
+inline std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<TPromise> handle) noexcept
+{
+    TaskPromiseBase& promise = handle.promise();
+
+    // The task might be destroyed right after it is marked as completed,
+    // so the continuation must be taken before
+    std::coroutine_handle<> continuation = promise._continuation;
+    promise._completed.store(true, std::memory_order_release);
+
+    return continuation ? continuation : std::noop_coroutine();
+}
+
+template <typename T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+template <typename T>
+inline T TaskPromise<T>::Result()
+{
+    if (_exception)
+        std::rethrow_exception(_exception);
+
+    return std::move(*_value);
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+inline void TaskPromise<void>::Result()
+{
+    if (_exception)
+        std::rethrow_exception(_exception);
+}
+
+//! Awaiter of the coroutine task
+template <typename T, bool Result>
+class TaskAwaiter
+{
+public:
+    explicit TaskAwaiter(std::coroutine_handle<TaskPromise<T>> handle) noexcept : _handle(handle) {}
+
+    bool await_ready() const noexcept { return !_handle || _handle.promise().completed(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+    {
+        // Start the task and resume the awaiter when it is completed
+        _handle.promise().continuation(continuation);
+        return _handle;
+    }
+    decltype(auto) await_resume()
+    {
+        assert(_handle && "Awaited task must be valid!");
+
+        if constexpr (Result)
+            return _handle.promise().Result();
+    }
+
+private:
+    std::coroutine_handle<TaskPromise<T>> _handle;
+};
+
+//! Coroutine which notifies the blocked thread about the task completion
+class SyncWaitDriver
+{
+public:
+    struct promise_type
+    {
+        SyncWaitDriver get_return_object() noexcept { return SyncWaitDriver(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    //! Blocked thread state
+    struct State
+    {
+        CriticalSection cs;
+        ConditionVariable cv;
+        bool done = false;
+    };
+
+    explicit SyncWaitDriver(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+
+    //! Start the driver coroutine
+    void Start() { _handle.resume(); }
+
+private:
+    std::coroutine_handle<promise_type> _handle;
+};
+
+template <typename T>
+inline SyncWaitDriver SyncWaitRun(Task<T>& task, SyncWaitDriver::State& state)
+{
+    co_await task.Completion();
+
+    // Notify the blocked thread under the lock, because the state will be
+    // destroyed as soon as the blocked thread sees the completion
+    Locker<CriticalSection> locker(state.cs);
+    state.done = true;
+    state.cv.NotifyOne();
+}
+
+} // namespace Internals
+//! @endcond
+
+template <typename T>
+inline Task<T>& Task<T>::operator=(Task&& task) noexcept
+{
+    if (this != &task)
+    {
+        if (_handle)
+            _handle.destroy();
+        _handle = std::exchange(task._handle, nullptr);
+    }
+    return *this;
+}
+
+template <typename T>
+inline void Task<T>::Start()
+{
+    assert(_handle && "Task must be valid!");
+    assert(!_handle.done() && "Task must not be completed!");
+
+    _handle.resume();
+}
+
+template <typename T>
+inline T Task<T>::Get()
+{
+    assert(done() && "Task must be completed!");
+
+    return _handle.promise().Result();
+}
+
+template <typename T>
+inline auto Task<T>::operator co_await() && noexcept
+{
+    return Internals::TaskAwaiter<T, true>(_handle);
+}
+
+template <typename T>
+inline auto Task<T>::operator co_await() & noexcept
+{
+    return Internals::TaskAwaiter<T, true>(_handle);
+}
+
+template <typename T>
+inline auto Task<T>::Completion() noexcept
+{
+    return Internals::TaskAwaiter<T, false>(_handle);
+}
+
+template <typename T>
+inline T SyncWait(Task<T> task)
+{
+    Internals::SyncWaitDriver::State state;
+
+    // Start the task with the driver coroutine as its continuation
+    Internals::SyncWaitRun(task, state).Start();
+
+    // Wait for the task completion
+    {
+        Locker<CriticalSection> locker(state.cs);
+        state.cv.Wait(state.cs, [&state]() { return state.done; });
+    }
+
+    return task.Get();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,173 @@
+/*!
+    \file async_wait_queue.h
+    \brief Multiple producers / multiple consumers coroutine wait queue definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_WAIT_QUEUE_H
+#define CPPCOMMON_THREADS_ASYNC_WAIT_QUEUE_H
+
+#include "threads/async_task.h"
+
+#include <queue>
+
+namespace CppCommon {
+
+//! Multiple producers / multiple consumers coroutine wait queue
+/*!
+    Multiple producers / multiple consumers coroutine wait queue is a
+    counterpart of WaitQueue which suspends coroutines instead of blocking
+    threads. Consumer is suspended while the queue is empty and producer is
+    suspended while the queue is full. Suspended coroutines are resumed with
+    their executors. The item is handed over directly to the suspended
+    consumer without passing through the queue.
+
+    Usage: co_await queue.Enqueue(item) and co_await queue.Dequeue(item)
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Producer%E2%80%93consumer_problem
+*/
+template<typename T>
+class AsyncWaitQueue
+{
+public:
+    class DequeueAwaiter;
+
+    //! Enqueue awaiter
+    class EnqueueAwaiter : private Internals::AsyncWaiter
+    {
+        friend class AsyncWaitQueue;
+        friend class DequeueAwaiter;
+
+    public:
+        EnqueueAwaiter(const EnqueueAwaiter&) = delete;
+        EnqueueAwaiter(EnqueueAwaiter&&) = delete;
+
+        EnqueueAwaiter& operator=(const EnqueueAwaiter&) = delete;
+        EnqueueAwaiter& operator=(EnqueueAwaiter&&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        bool await_resume() const noexcept { return result; }
+
+    private:
+        AsyncWaitQueue& _queue;
+        T _item;
+
+        template <typename U>
+        EnqueueAwaiter(AsyncWaitQueue& queue, U&& item, Executor& exec) : Internals::AsyncWaiter(exec), _queue(queue), _item(std::forward<U>(item)) {}
+    };
+
+    //! Dequeue awaiter
+    class DequeueAwaiter : private Internals::AsyncWaiter
+    {
+        friend class AsyncWaitQueue;
+        friend class EnqueueAwaiter;
+
+    public:
+        DequeueAwaiter(const DequeueAwaiter&) = delete;
+        DequeueAwaiter(DequeueAwaiter&&) = delete;
+
+        DequeueAwaiter& operator=(const DequeueAwaiter&) = delete;
+        DequeueAwaiter& operator=(DequeueAwaiter&&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        bool await_resume() const noexcept { return result; }
+
+    private:
+        AsyncWaitQueue& _queue;
+        T& _item;
+
+        DequeueAwaiter(AsyncWaitQueue& queue, T& item, Executor& exec) noexcept : Internals::AsyncWaiter(exec), _queue(queue), _item(item) {}
+    };
+
+    //! Default class constructor
+    /*!
+        \param capacity - Wait queue capacity (default is 0 for unlimited capacity)
+    */
+    explicit AsyncWaitQueue(size_t capacity = 0);
+    AsyncWaitQueue(const AsyncWaitQueue&) = delete;
+    AsyncWaitQueue(AsyncWaitQueue&&) = delete;
+    ~AsyncWaitQueue();
+
+    AsyncWaitQueue& operator=(const AsyncWaitQueue&) = delete;
+    AsyncWaitQueue& operator=(AsyncWaitQueue&&) = delete;
+
+    //! Check if the wait queue is not empty
+    explicit operator bool() const noexcept { return !closed() && !empty(); }
+
+    //! Is wait queue closed?
+    bool closed() const;
+
+    //! Is wait queue empty?
+    bool empty() const { return (size() == 0); }
+    //! Get wait queue capacity
+    size_t capacity() const { return _capacity; }
+    //! Get wait queue size
+    size_t size() const;
+
+    //! Enqueue an item into the wait queue
+    /*!
+        The item will be copied into the wait queue.
+
+        Will suspend the coroutine while the wait queue is full.
+
+        \param item - Item to enqueue
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Awaiter which returns 'true' if the item was successfully enqueue, 'false' if the wait queue is closed
+    */
+    EnqueueAwaiter Enqueue(const T& item, Executor& executor = Executor::Inline()) { return EnqueueAwaiter(*this, item, executor); }
+    //! Enqueue an item into the wait queue
+    /*!
+        The item will be moved into the wait queue.
+
+        Will suspend the coroutine while the wait queue is full.
+
+        \param item - Item to enqueue
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Awaiter which returns 'true' if the item was successfully enqueue, 'false' if the wait queue is closed
+    */
+    EnqueueAwaiter Enqueue(T&& item, Executor& executor = Executor::Inline()) { return EnqueueAwaiter(*this, std::move(item), executor); }
+
+    //! Dequeue an item from the wait queue
+    /*!
+        The item will be moved from the wait queue.
+
+        Will suspend the coroutine while the wait queue is empty.
+
+        \param item - Item to dequeue
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Awaiter which returns 'true' if the item was successfully dequeue, 'false' if the wait queue is closed
+    */
+    DequeueAwaiter Dequeue(T& item, Executor& executor = Executor::Inline()) noexcept { return DequeueAwaiter(*this, item, executor); }
+
+    //! Close the wait queue
+    /*!
+        All suspended coroutines are resumed with 'false' result.
+
+        Will not block, except for inline resumed coroutines.
+    */
+    void Close();
+
+private:
+    bool _closed;
+    const size_t _capacity;
+    mutable CriticalSection _cs;
+    std::queue<T> _queue;
+    Internals::AsyncWaiterList _consumers;
+    Internals::AsyncWaiterList _producers;
+};
+
+/*! \example threads_async_wait_queue.cpp Multiple producers / multiple consumers coroutine wait queue example */
+
+} // namespace CppCommon
+
+#include "async_wait_queue.inl"
+
+#endif // CPPCOMMON_THREADS_ASYNC_WAIT_QUEUE_H
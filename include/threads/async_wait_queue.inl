@@ -0,0 +1,140 @@
+/*!
+    \file async_wait_queue.inl
+    \brief Multiple producers / multiple consumers coroutine wait queue inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline AsyncWaitQueue<T>::AsyncWaitQueue(size_t capacity) : _closed(false), _capacity(capacity)
+{
+}
+
+template<typename T>
+inline AsyncWaitQueue<T>::~AsyncWaitQueue()
+{
+    Close();
+}
+
+template<typename T>
+inline bool AsyncWaitQueue<T>::closed() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _closed;
+}
+
+template<typename T>
+inline size_t AsyncWaitQueue<T>::size() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _queue.size();
+}
+
+template<typename T>
+inline bool AsyncWaitQueue<T>::EnqueueAwaiter::await_suspend(std::coroutine_handle<> h)
+{
+    handle = h;
+
+    Internals::AsyncWaiter* consumer;
+
+    {
+        Locker<CriticalSection> locker(_queue._cs);
+
+        if (_queue._closed)
+        {
+            result = false;
+            return false;
+        }
+
+        // Hand over the item directly to the suspended consumer
+        consumer = _queue._consumers.Pop();
+        if (consumer != nullptr)
+            static_cast<DequeueAwaiter*>(consumer)->_item = std::move(_item);
+        else if ((_queue._capacity == 0) || (_queue._queue.size() < _queue._capacity))
+            _queue._queue.push(std::move(_item));
+        else
+        {
+            // Suspend the producer while the wait queue is full
+            _queue._producers.Push(this);
+            return true;
+        }
+    }
+
+    result = true;
+
+    // Resume the consumer without holding the lock
+    if (consumer != nullptr)
+    {
+        consumer->result = true;
+        consumer->Resume();
+    }
+
+    return false;
+}
+
+template<typename T>
+inline bool AsyncWaitQueue<T>::DequeueAwaiter::await_suspend(std::coroutine_handle<> h)
+{
+    handle = h;
+
+    Internals::AsyncWaiter* producer = nullptr;
+
+    {
+        Locker<CriticalSection> locker(_queue._cs);
+
+        if (_queue._queue.empty())
+        {
+            if (_queue._closed)
+            {
+                result = false;
+                return false;
+            }
+
+            // Suspend the consumer while the wait queue is empty
+            _queue._consumers.Push(this);
+            return true;
+        }
+
+        _item = std::move(_queue._queue.front());
+        _queue._queue.pop();
+
+        // Move the item of the suspended producer into the freed slot
+        producer = _queue._producers.Pop();
+        if (producer != nullptr)
+            _queue._queue.push(std::move(static_cast<EnqueueAwaiter*>(producer)->_item));
+    }
+
+    result = true;
+
+    // Resume the producer without holding the lock
+    if (producer != nullptr)
+    {
+        producer->result = true;
+        producer->Resume();
+    }
+
+    return false;
+}
+
+template<typename T>
+inline void AsyncWaitQueue<T>::Close()
+{
+    Internals::AsyncWaiter* consumers;
+    Internals::AsyncWaiter* producers;
+
+    {
+        Locker<CriticalSection> locker(_cs);
+        _closed = true;
+        consumers = _consumers.Detach();
+        producers = _producers.Detach();
+    }
+
+    // Resume all waiters without holding the lock
+    Internals::AsyncWaiterList::ResumeAll(consumers, false);
+    Internals::AsyncWaiterList::ResumeAll(producers, false);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,176 @@
+/*!
+    \file async_wait_ring.h
+    \brief Multiple producers / multiple consumers coroutine wait ring definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_WAIT_RING_H
+#define CPPCOMMON_THREADS_ASYNC_WAIT_RING_H
+
+#include "threads/async_task.h"
+
+#include <vector>
+
+namespace CppCommon {
+
+//! Multiple producers / multiple consumers coroutine wait ring
+/*!
+    Multiple producers / multiple consumers coroutine wait ring is a
+    counterpart of WaitRing which suspends coroutines instead of blocking
+    threads. Items are stored in the fixed ring, so there are no memory
+    allocations after construction. Consumer is suspended while the ring is
+    empty and producer is suspended while the ring is full. Suspended
+    coroutines are resumed with their executors.
+
+    Usage: co_await ring.Enqueue(item) and co_await ring.Dequeue(item)
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Producer%E2%80%93consumer_problem
+*/
+template<typename T>
+class AsyncWaitRing
+{
+public:
+    class DequeueAwaiter;
+
+    //! Enqueue awaiter
+    class EnqueueAwaiter : private Internals::AsyncWaiter
+    {
+        friend class AsyncWaitRing;
+        friend class DequeueAwaiter;
+
+    public:
+        EnqueueAwaiter(const EnqueueAwaiter&) = delete;
+        EnqueueAwaiter(EnqueueAwaiter&&) = delete;
+
+        EnqueueAwaiter& operator=(const EnqueueAwaiter&) = delete;
+        EnqueueAwaiter& operator=(EnqueueAwaiter&&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        bool await_resume() const noexcept { return result; }
+
+    private:
+        AsyncWaitRing& _ring;
+        T _item;
+
+        template <typename U>
+        EnqueueAwaiter(AsyncWaitRing& ring, U&& item, Executor& exec) : Internals::AsyncWaiter(exec), _ring(ring), _item(std::forward<U>(item)) {}
+    };
+
+    //! Dequeue awaiter
+    class DequeueAwaiter : private Internals::AsyncWaiter
+    {
+        friend class AsyncWaitRing;
+        friend class EnqueueAwaiter;
+
+    public:
+        DequeueAwaiter(const DequeueAwaiter&) = delete;
+        DequeueAwaiter(DequeueAwaiter&&) = delete;
+
+        DequeueAwaiter& operator=(const DequeueAwaiter&) = delete;
+        DequeueAwaiter& operator=(DequeueAwaiter&&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle);
+        bool await_resume() const noexcept { return result; }
+
+    private:
+        AsyncWaitRing& _ring;
+        T& _item;
+
+        DequeueAwaiter(AsyncWaitRing& ring, T& item, Executor& exec) noexcept : Internals::AsyncWaiter(exec), _ring(ring), _item(item) {}
+    };
+
+    //! Default class constructor
+    /*!
+        \param capacity - Wait queue capacity (default is 0 for unlimited capacity)
+    */
+    explicit AsyncWaitRing(size_t capacity = 0);
+    AsyncWaitRing(const AsyncWaitRing&) = delete;
+    AsyncWaitRing(AsyncWaitRing&&) = delete;
+    ~AsyncWaitRing();
+
+    AsyncWaitRing& operator=(const AsyncWaitRing&) = delete;
+    AsyncWaitRing& operator=(AsyncWaitRing&&) = delete;
+
+    //! Check if the wait ring is not empty
+    explicit operator bool() const noexcept { return !closed() && !empty(); }
+
+    //! Is wait ring closed?
+    bool closed() const;
+
+    //! Is wait ring empty?
+    bool empty() const { return (size() == 0); }
+    //! Get wait ring capacity
+    size_t capacity() const { return _capacity; }
+    //! Get wait ring size
+    size_t size() const;
+
+    //! Enqueue an item into the wait ring
+    /*!
+        The item will be copied into the wait ring.
+
+        Will suspend the coroutine while the wait ring is full.
+
+        \param item - Item to enqueue
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Awaiter which returns 'true' if the item was successfully enqueue, 'false' if the wait ring is closed
+    */
+    EnqueueAwaiter Enqueue(const T& item, Executor& executor = Executor::Inline()) { return EnqueueAwaiter(*this, item, executor); }
+    //! Enqueue an item into the wait ring
+    /*!
+        The item will be moved into the wait ring.
+
+        Will suspend the coroutine while the wait ring is full.
+
+        \param item - Item to enqueue
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Awaiter which returns 'true' if the item was successfully enqueue, 'false' if the wait ring is closed
+    */
+    EnqueueAwaiter Enqueue(T&& item, Executor& executor = Executor::Inline()) { return EnqueueAwaiter(*this, std::move(item), executor); }
+
+    //! Dequeue an item from the wait ring
+    /*!
+        The item will be moved from the wait ring.
+
+        Will suspend the coroutine while the wait ring is empty.
+
+        \param item - Item to dequeue
+        \param executor - Executor to resume the coroutine (default is Executor::Inline())
+        \return Awaiter which returns 'true' if the item was successfully dequeue, 'false' if the wait ring is closed
+    */
+    DequeueAwaiter Dequeue(T& item, Executor& executor = Executor::Inline()) noexcept { return DequeueAwaiter(*this, item, executor); }
+
+    //! Close the wait ring
+    /*!
+        All suspended coroutines are resumed with 'false' result.
+
+        Will not block, except for inline resumed coroutines.
+    */
+    void Close();
+
+private:
+    bool _closed;
+    const size_t _capacity;
+    const size_t _mask;
+    mutable CriticalSection _cs;
+    size_t _head;
+    size_t _tail;
+    std::vector<T> _buffer;
+    Internals::AsyncWaiterList _consumers;
+    Internals::AsyncWaiterList _producers;
+};
+
+/*! \example threads_async_wait_ring.cpp Multiple producers / multiple consumers coroutine wait ring example */
+
+} // namespace CppCommon
+
+#include "async_wait_ring.inl"
+
+#endif // CPPCOMMON_THREADS_ASYNC_WAIT_RING_H
@@ -0,0 +1,141 @@
+/*!
+    \file async_wait_ring.inl
+    \brief Multiple producers / multiple consumers coroutine wait ring inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline AsyncWaitRing<T>::AsyncWaitRing(size_t capacity) : _closed(false), _capacity(capacity), _mask(capacity - 1), _head(0), _tail(0), _buffer(capacity)
+{
+    assert((capacity > 0) && "Ring capacity must be greater than zero!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring capacity must be a power of two!");
+}
+
+template<typename T>
+inline AsyncWaitRing<T>::~AsyncWaitRing()
+{
+    Close();
+}
+
+template<typename T>
+inline bool AsyncWaitRing<T>::closed() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _closed;
+}
+
+template<typename T>
+inline size_t AsyncWaitRing<T>::size() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _head - _tail;
+}
+
+template<typename T>
+inline bool AsyncWaitRing<T>::EnqueueAwaiter::await_suspend(std::coroutine_handle<> h)
+{
+    handle = h;
+
+    Internals::AsyncWaiter* consumer;
+
+    {
+        Locker<CriticalSection> locker(_ring._cs);
+
+        if (_ring._closed)
+        {
+            result = false;
+            return false;
+        }
+
+        // Hand over the item directly to the suspended consumer
+        consumer = _ring._consumers.Pop();
+        if (consumer != nullptr)
+            static_cast<DequeueAwaiter*>(consumer)->_item = std::move(_item);
+        else if ((_ring._head - _ring._tail) < _ring._capacity)
+            _ring._buffer[_ring._head++ & _ring._mask] = std::move(_item);
+        else
+        {
+            // Suspend the producer while the wait ring is full
+            _ring._producers.Push(this);
+            return true;
+        }
+    }
+
+    result = true;
+
+    // Resume the consumer without holding the lock
+    if (consumer != nullptr)
+    {
+        consumer->result = true;
+        consumer->Resume();
+    }
+
+    return false;
+}
+
+template<typename T>
+inline bool AsyncWaitRing<T>::DequeueAwaiter::await_suspend(std::coroutine_handle<> h)
+{
+    handle = h;
+
+    Internals::AsyncWaiter* producer = nullptr;
+
+    {
+        Locker<CriticalSection> locker(_ring._cs);
+
+        if (_ring._head == _ring._tail)
+        {
+            if (_ring._closed)
+            {
+                result = false;
+                return false;
+            }
+
+            // Suspend the consumer while the wait ring is empty
+            _ring._consumers.Push(this);
+            return true;
+        }
+
+        _item = std::move(_ring._buffer[_ring._tail++ & _ring._mask]);
+
+        // Move the item of the suspended producer into the freed slot
+        producer = _ring._producers.Pop();
+        if (producer != nullptr)
+            _ring._buffer[_ring._head++ & _ring._mask] = std::move(static_cast<EnqueueAwaiter*>(producer)->_item);
+    }
+
+    result = true;
+
+    // Resume the producer without holding the lock
+    if (producer != nullptr)
+    {
+        producer->result = true;
+        producer->Resume();
+    }
+
+    return false;
+}
+
+template<typename T>
+inline void AsyncWaitRing<T>::Close()
+{
+    Internals::AsyncWaiter* consumers;
+    Internals::AsyncWaiter* producers;
+
+    {
+        Locker<CriticalSection> locker(_cs);
+        _closed = true;
+        consumers = _consumers.Detach();
+        producers = _producers.Detach();
+    }
+
+    // Resume all waiters without holding the lock
+    Internals::AsyncWaiterList::ResumeAll(consumers, false);
+    Internals::AsyncWaiterList::ResumeAll(producers, false);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,146 @@
+/*!
+    \file clh_spin_lock.h
+    \brief CLH queue spin-lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_CLH_SPIN_LOCK_H
+#define CPPCOMMON_THREADS_CLH_SPIN_LOCK_H
+
+#include "threads/futex.h"
+#include "threads/locker.h"
+#include "threads/thread.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace CppCommon {
+
+//! CLH queue spin-lock synchronization primitive
+/*!
+    CLH spin-lock links waiting threads into the implicit queue of nodes.
+    Each waiter spins on the flag of its predecessor node, so waiters do not
+    hammer the shared cache line and the lock is granted in the strict FIFO
+    order. The lock owner releases its node to the successor and adopts the
+    predecessor node for the next acquisition. Queue nodes are kept in the
+    thread-local cache and are recycled, but never returned to the heap
+    while the program is running.
+
+    Timed and spin-limited attempts do not join the queue: they only try to
+    acquire the free lock.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Lock_(computer_science)
+*/
+class CLHSpinLock
+{
+public:
+    CLHSpinLock();
+    CLHSpinLock(const CLHSpinLock&) = delete;
+    CLHSpinLock(CLHSpinLock&&) = delete;
+    ~CLHSpinLock();
+
+    CLHSpinLock& operator=(const CLHSpinLock&) = delete;
+    CLHSpinLock& operator=(CLHSpinLock&&) = delete;
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the spin-lock is already locked, 'false' if the spin-lock is released
+    */
+    bool IsLocked() noexcept;
+
+    //! Try to acquire spin-lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire spin-lock for the given spin count
+    /*!
+        Will block for the given spin count in the worst case.
+
+        \param spin - Spin count
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockSpin(int64_t spin) noexcept;
+
+    //! Try to acquire spin-lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the spin-lock
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockFor(const Timespan& timespan) noexcept;
+    //! Try to acquire spin-lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the spin-lock
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire spin-lock with block
+    /*!
+        Will block in a spin loop.
+    */
+    void Lock() noexcept;
+
+    //! Release spin-lock
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Queue node
+    struct Node
+    {
+        std::atomic<bool> locked;
+        cache_line_pad pad;
+    };
+
+    // Thread-local cache of queue nodes
+    struct NodeCache
+    {
+        std::vector<Node*> nodes;
+
+        ~NodeCache();
+    };
+
+    std::atomic<Node*> _tail;
+    Node* _owner;
+    Node* _predecessor;
+
+    //! Get the free queue node from the thread-local cache
+    static Node* Allocate();
+    //! Return the queue node into the thread-local cache
+    static void Free(Node* node);
+    //! Get the thread-local cache of queue nodes
+    static NodeCache& Cache();
+    //! Get the global cache of queue nodes released by exited threads
+    static NodeCache& Global(std::mutex*& mutex);
+};
+
+/*! \example threads_clh_spin_lock.cpp CLH queue spin-lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "clh_spin_lock.inl"
+
+#endif // CPPCOMMON_THREADS_CLH_SPIN_LOCK_H
@@ -0,0 +1,171 @@
+/*!
+    \file clh_spin_lock.inl
+    \brief CLH queue spin-lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline CLHSpinLock::CLHSpinLock() : _owner(nullptr), _predecessor(nullptr)
+{
+    // Start the queue with the released dummy node
+    Node* node = Allocate();
+    node->locked.store(false, std::memory_order_relaxed);
+    _tail.store(node, std::memory_order_relaxed);
+}
+
+inline CLHSpinLock::~CLHSpinLock()
+{
+    // The tail node is owned by the lock
+    Free(_tail.load(std::memory_order_relaxed));
+}
+
+inline CLHSpinLock::NodeCache::~NodeCache()
+{
+    // Nodes might still be observed by other threads, so keep them in the global cache
+    std::mutex* mutex;
+    NodeCache& global = Global(mutex);
+    if (&global == this)
+    {
+        for (auto node : nodes)
+            delete node;
+        return;
+    }
+
+    std::scoped_lock lock(*mutex);
+    global.nodes.insert(global.nodes.end(), nodes.begin(), nodes.end());
+}
+
+inline CLHSpinLock::NodeCache& CLHSpinLock::Global(std::mutex*& mutex)
+{
+    static std::mutex global_mutex;
+    static NodeCache global;
+    mutex = &global_mutex;
+    return global;
+}
+
+inline CLHSpinLock::NodeCache& CLHSpinLock::Cache()
+{
+    static thread_local NodeCache cache;
+    return cache;
+}
+
+inline CLHSpinLock::Node* CLHSpinLock::Allocate()
+{
+    NodeCache& cache = Cache();
+    if (cache.nodes.empty())
+    {
+        // Reuse nodes released by exited threads
+        std::mutex* mutex;
+        NodeCache& global = Global(mutex);
+        std::scoped_lock lock(*mutex);
+        if (global.nodes.empty())
+            return new Node();
+
+        Node* node = global.nodes.back();
+        global.nodes.pop_back();
+        return node;
+    }
+
+    Node* node = cache.nodes.back();
+    cache.nodes.pop_back();
+    return node;
+}
+
+inline void CLHSpinLock::Free(Node* node)
+{
+    Cache().nodes.push_back(node);
+}
+
+inline bool CLHSpinLock::IsLocked() noexcept
+{
+    return _tail.load(std::memory_order_acquire)->locked.load(std::memory_order_acquire);
+}
+
+inline bool CLHSpinLock::TryLock() noexcept
+{
+    // Fast check to avoid taking the node for the busy lock
+    Node* predecessor = _tail.load(std::memory_order_acquire);
+    if (predecessor->locked.load(std::memory_order_acquire))
+        return false;
+
+    Node* node = Allocate();
+    node->locked.store(true, std::memory_order_relaxed);
+    if (!_tail.compare_exchange_strong(predecessor, node, std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+        Free(node);
+        return false;
+    }
+
+    // The released predecessor node might be recycled and enqueued again
+    // between the check and the swap, so wait for it in this rare case
+    while (predecessor->locked.load(std::memory_order_acquire))
+        Thread::Yield();
+
+    _owner = node;
+    _predecessor = predecessor;
+    return true;
+}
+
+inline bool CLHSpinLock::TryLockSpin(int64_t spin) noexcept
+{
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+    } while (spin-- > 0);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline bool CLHSpinLock::TryLockFor(const Timespan& timespan) noexcept
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+    } while (NanoTimestamp() < finish);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline void CLHSpinLock::Lock() noexcept
+{
+    Node* node = Allocate();
+    node->locked.store(true, std::memory_order_relaxed);
+
+    // Enqueue the node and spin on the predecessor node
+    Node* predecessor = _tail.exchange(node, std::memory_order_acq_rel);
+    const uint32_t limit = Futex::SpinCount();
+    uint32_t attempts = 0;
+    while (predecessor->locked.load(std::memory_order_acquire))
+    {
+        if (attempts++ < limit)
+            BackoffWait::Pause();
+        else
+            Thread::Yield();
+    }
+
+    _owner = node;
+    _predecessor = predecessor;
+}
+
+inline void CLHSpinLock::Unlock() noexcept
+{
+    // Adopt the predecessor node and release the own node to the successor
+    Node* node = _owner;
+    Node* predecessor = _predecessor;
+    node->locked.store(false, std::memory_order_release);
+    Free(predecessor);
+}
+
+} // namespace CppCommon
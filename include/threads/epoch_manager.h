@@ -0,0 +1,192 @@
+/*!
+    \file epoch_manager.h
+    \brief Epoch-based memory reclamation manager definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_EPOCH_MANAGER_H
+#define CPPCOMMON_THREADS_EPOCH_MANAGER_H
+
+#include "threads/thread.h"
+#include "threads/thread_records.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace CppCommon {
+
+//! Epoch-based memory reclamation manager
+/*!
+    Epoch-based memory reclamation allows lock-free data structures to free
+    unlinked nodes safely while other threads might still read them. Readers
+    access shared data inside read-side critical sections which only announce
+    the current global epoch in the thread record. Writers retire unlinked
+    objects tagged with the current global epoch. The global epoch advances
+    only when all threads inside critical sections have observed it, so the
+    object retired in epoch 'e' is not reachable by any reader once the global
+    epoch reaches 'e + 2' and is freed in batches.
+
+    Threads are registered on the first access and could be registered and
+    unregistered explicitly. Objects retired by exited threads are freed by
+    other threads during the reclamation.
+
+    Read-side critical section must be short, because a stalled reader blocks
+    the reclamation of all retired objects. Use HazardPointers if readers
+    might be blocked for an unbounded time.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Read-copy-update
+*/
+class EpochManager
+{
+public:
+    //! Read-side critical section guard
+    class Guard
+    {
+    public:
+        //! Enter read-side critical section
+        /*!
+            \param manager - Epoch manager
+        */
+        explicit Guard(EpochManager& manager) : _manager(manager) { _manager.Enter(); }
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        ~Guard() { _manager.Leave(); }
+
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+    private:
+        EpochManager& _manager;
+    };
+
+    //! Default class constructor
+    /*!
+        \param threshold - Count of retired objects in the thread record to start the reclamation (default is 64)
+    */
+    explicit EpochManager(size_t threshold = 64);
+    EpochManager(const EpochManager&) = delete;
+    EpochManager(EpochManager&&) = delete;
+    ~EpochManager();
+
+    EpochManager& operator=(const EpochManager&) = delete;
+    EpochManager& operator=(EpochManager&&) = delete;
+
+    //! Get the current global epoch
+    uint64_t epoch() const noexcept { return _epoch.load(std::memory_order_acquire); }
+    //! Get the count of retired objects to start the reclamation
+    size_t threshold() const noexcept { return _threshold; }
+
+    //! Register the current thread
+    /*!
+        Registration is performed automatically on the first access from the thread.
+    */
+    void RegisterThread();
+    //! Unregister the current thread
+    /*!
+        Current thread must not be inside the read-side critical section.
+        Not freed objects are left for other threads.
+    */
+    void UnregisterThread();
+
+    //! Enter read-side critical section
+    /*!
+        Critical sections could be nested.
+
+        Will not block.
+    */
+    void Enter();
+    //! Leave read-side critical section
+    /*!
+        Will not block.
+    */
+    void Leave();
+
+    //! Retire the object to be deleted when no reader could access it
+    /*!
+        The object must be already unlinked from the shared data structure.
+
+        \param ptr - Pointer to the object to retire
+    */
+    template <typename T>
+    void Retire(T* ptr);
+    //! Retire the memory to be freed with the given deleter when no reader could access it
+    /*!
+        \param ptr - Pointer to the memory to retire
+        \param deleter - Deleter function
+    */
+    void Retire(void* ptr, void (*deleter)(void*));
+
+    //! Try to advance the global epoch
+    /*!
+        Will not block.
+
+        \return 'true' if the global epoch was advanced, 'false' if some reader has not observed the current epoch yet
+    */
+    bool TryAdvance();
+
+    //! Free retired objects which are not accessible by readers anymore
+    /*!
+        Frees retired objects of the current thread and of exited threads.
+
+        Will not block.
+    */
+    void Reclaim();
+
+    //! Wait for the grace period and free all objects retired before
+    /*!
+        Current thread must not be inside the read-side critical section.
+
+        Will block until all readers leave their current critical sections.
+    */
+    void Synchronize();
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Retired object
+    struct Retired
+    {
+        void* ptr;
+        void (*deleter)(void*);
+        uint64_t epoch;
+    };
+
+    // Thread state
+    struct State
+    {
+        cache_line_pad pad0;
+        std::atomic<uint64_t> epoch;
+        uint32_t nesting;
+        std::vector<Retired> retired;
+        cache_line_pad pad1;
+
+        State() : epoch(0), nesting(0) { memset(pad0, 0, sizeof(cache_line_pad)); memset(pad1, 0, sizeof(cache_line_pad)); }
+
+        // Leave the read-side critical section of the released thread record
+        void Release() noexcept { nesting = 0; epoch.store(0, std::memory_order_release); }
+    };
+
+    cache_line_pad _pad0;
+    std::atomic<uint64_t> _epoch;
+    cache_line_pad _pad1;
+    size_t _threshold;
+    Internals::ThreadRecords<State> _records;
+
+    //! Free retired objects of the given thread state
+    void Collect(State& state);
+};
+
+/*! \example threads_epoch_manager.cpp Epoch-based memory reclamation manager example */
+
+} // namespace CppCommon
+
+#include "epoch_manager.inl"
+
+#endif // CPPCOMMON_THREADS_EPOCH_MANAGER_H
@@ -0,0 +1,151 @@
+/*!
+    \file epoch_manager.inl
+    \brief Epoch-based memory reclamation manager inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline EpochManager::EpochManager(size_t threshold) : _epoch(1), _threshold(threshold)
+{
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+}
+
+inline EpochManager::~EpochManager()
+{
+    // Free all retired objects, no reader must be active at this point
+    for (auto record = _records.head(); record != nullptr; record = record->next)
+    {
+        assert((record->data.nesting == 0) && "Epoch manager is destroyed while some thread is inside the read-side critical section!");
+        for (auto& retired : record->data.retired)
+            retired.deleter(retired.ptr);
+        record->data.retired.clear();
+    }
+}
+
+inline void EpochManager::RegisterThread()
+{
+    _records.Current();
+}
+
+inline void EpochManager::UnregisterThread()
+{
+    State& state = _records.Current().data;
+    assert((state.nesting == 0) && "Cannot unregister the thread inside the read-side critical section!");
+
+    TryAdvance();
+    Collect(state);
+    _records.Release();
+}
+
+inline void EpochManager::Enter()
+{
+    State& state = _records.Current().data;
+    if (state.nesting++ == 0)
+    {
+        // Announce the observed global epoch before accessing shared data
+        state.epoch.store(_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+inline void EpochManager::Leave()
+{
+    State& state = _records.Current().data;
+    assert((state.nesting > 0) && "Leave the read-side critical section without enter!");
+    if (--state.nesting == 0)
+        state.epoch.store(0, std::memory_order_release);
+}
+
+template <typename T>
+inline void EpochManager::Retire(T* ptr)
+{
+    Retire(ptr, [](void* p) { delete static_cast<T*>(p); });
+}
+
+inline void EpochManager::Retire(void* ptr, void (*deleter)(void*))
+{
+    if (ptr == nullptr)
+        return;
+
+    State& state = _records.Current().data;
+
+    // Tag the unlinked object with the current global epoch
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    state.retired.push_back(Retired{ ptr, deleter, _epoch.load(std::memory_order_relaxed) });
+
+    // Free retired objects in batches
+    if (state.retired.size() >= _threshold)
+    {
+        TryAdvance();
+        Collect(state);
+    }
+}
+
+inline bool EpochManager::TryAdvance()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t epoch = _epoch.load(std::memory_order_relaxed);
+
+    // All threads inside critical sections must observe the current epoch
+    for (auto record = _records.head(); record != nullptr; record = record->next)
+    {
+        uint64_t announced = record->data.epoch.load(std::memory_order_acquire);
+        if ((announced != 0) && (announced != epoch))
+            return false;
+    }
+
+    return _epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+inline void EpochManager::Collect(State& state)
+{
+    const uint64_t epoch = _epoch.load(std::memory_order_acquire);
+
+    // Objects retired two epochs ago are not reachable by any reader
+    size_t kept = 0;
+    for (size_t i = 0; i < state.retired.size(); ++i)
+    {
+        Retired& retired = state.retired[i];
+        if ((retired.epoch + 2) <= epoch)
+            retired.deleter(retired.ptr);
+        else
+            state.retired[kept++] = retired;
+    }
+    state.retired.resize(kept);
+}
+
+inline void EpochManager::Reclaim()
+{
+    TryAdvance();
+    Collect(_records.Current().data);
+
+    // Free objects retired by exited threads
+    for (auto record = _records.head(); record != nullptr; record = record->next)
+    {
+        bool owned = false;
+        if (!record->owned.load(std::memory_order_relaxed) && record->owned.compare_exchange_strong(owned, true, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            Collect(record->data);
+            record->owned.store(false, std::memory_order_release);
+        }
+    }
+}
+
+inline void EpochManager::Synchronize()
+{
+    assert((_records.Current().data.nesting == 0) && "Cannot synchronize inside the read-side critical section!");
+
+    // Wait until the global epoch is advanced twice
+    const uint64_t target = _epoch.load(std::memory_order_acquire) + 2;
+    while (_epoch.load(std::memory_order_acquire) < target)
+        if (!TryAdvance())
+            Thread::Yield();
+
+    Reclaim();
+}
+
+} // namespace CppCommon
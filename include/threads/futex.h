@@ -0,0 +1,92 @@
+/*!
+    \file futex.h
+    \brief Futex synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_H
+#define CPPCOMMON_THREADS_FUTEX_H
+
+#include "time/timespan.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Futex synchronization primitive
+/*!
+    Futex allows to block the current thread while the 32-bit atomic value
+    is equal to the expected one, and to wake threads blocked on the value.
+    It is the building block for synchronization primitives which perform
+    uncontended operations in user space with a single atomic operation and
+    enter the kernel only to block or to wake up waiters.
+
+    Waiting could be spuriously interrupted, so the caller must re-check its
+    condition after each wait.
+
+    On Linux futex system calls are used, on Windows WaitOnAddress() family
+    of functions is used, on other platforms C++20 atomic waiting is used.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Futex
+*/
+class Futex
+{
+public:
+    Futex() = delete;
+    Futex(const Futex&) = delete;
+    Futex(Futex&&) = delete;
+    ~Futex() = delete;
+
+    Futex& operator=(const Futex&) = delete;
+    Futex& operator=(Futex&&) = delete;
+
+    //! Block while the value is equal to the expected one
+    /*!
+        Will block until woken up or spuriously interrupted.
+
+        \param value - Atomic value
+        \param expected - Expected value
+    */
+    static void Wait(std::atomic<uint32_t>& value, uint32_t expected) noexcept;
+
+    //! Block while the value is equal to the expected one for the given timespan
+    /*!
+        Will block until woken up, spuriously interrupted or the given timespan is expired.
+
+        \param value - Atomic value
+        \param expected - Expected value
+        \param timespan - Timespan to wait
+        \return 'false' if the given timespan is expired, 'true' otherwise
+    */
+    static bool WaitFor(std::atomic<uint32_t>& value, uint32_t expected, const Timespan& timespan) noexcept;
+
+    //! Wake one thread blocked on the value
+    /*!
+        \param value - Atomic value
+    */
+    static void WakeOne(std::atomic<uint32_t>& value) noexcept;
+
+    //! Wake all threads blocked on the value
+    /*!
+        \param value - Atomic value
+    */
+    static void WakeAll(std::atomic<uint32_t>& value) noexcept;
+
+    //! Get the maximal spin count before blocking on the futex
+    /*!
+        Spinning is useless on single CPU systems where it only delays the
+        thread which could release the resource, so zero is returned there.
+
+        \return Maximal spin count
+    */
+    static uint32_t SpinCount() noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_FUTEX_H
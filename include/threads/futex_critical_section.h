@@ -0,0 +1,106 @@
+/*!
+    \file futex_critical_section.h
+    \brief Futex-based critical section synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_CRITICAL_SECTION_H
+#define CPPCOMMON_THREADS_FUTEX_CRITICAL_SECTION_H
+
+#include "threads/futex.h"
+#include "threads/locker.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Futex-based critical section synchronization primitive
+/*!
+    Futex-based critical section keeps its whole state in a single 32-bit
+    word: unlocked, locked or locked with waiters. Uncontended lock and unlock
+    are a single atomic operation each and never enter the kernel. Contended
+    lock spins for the adaptive count of attempts tuned by previous contended
+    acquisitions and then parks the thread on the futex. Unlock enters the
+    kernel only if there are parked waiters.
+
+    Unlike CriticalSection it cannot be used with ConditionVariable.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Futex
+*/
+class FutexCriticalSection
+{
+public:
+    FutexCriticalSection() noexcept : _state(Unlocked), _spin(0) {}
+    FutexCriticalSection(const FutexCriticalSection&) = delete;
+    FutexCriticalSection(FutexCriticalSection&&) = delete;
+    ~FutexCriticalSection() = default;
+
+    FutexCriticalSection& operator=(const FutexCriticalSection&) = delete;
+    FutexCriticalSection& operator=(FutexCriticalSection&&) = delete;
+
+    //! Is critical section locked?
+    bool IsLocked() const noexcept { return _state.load(std::memory_order_acquire) != Unlocked; }
+
+    //! Try to acquire critical section without block
+    /*!
+        Will not block.
+
+        \return 'true' if the critical section was successfully acquired, 'false' if the critical section is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire critical section for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the critical section
+        \return 'true' if the critical section was successfully acquired, 'false' if the critical section is busy
+    */
+    bool TryLockFor(const Timespan& timespan) noexcept;
+    //! Try to acquire critical section until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the critical section
+        \return 'true' if the critical section was successfully acquired, 'false' if the critical section is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire critical section with block
+    /*!
+        Will block.
+    */
+    void Lock() noexcept;
+
+    //! Release critical section
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    enum : uint32_t { Unlocked = 0, Locked = 1, Contended = 2 };
+
+    std::atomic<uint32_t> _state;
+    std::atomic<uint32_t> _spin;
+
+    //! Spin for the adaptive count of attempts trying to acquire critical section
+    bool Spin() noexcept;
+};
+
+/*! \example threads_futex_critical_section.cpp Futex-based critical section synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "futex_critical_section.inl"
+
+#endif // CPPCOMMON_THREADS_FUTEX_CRITICAL_SECTION_H
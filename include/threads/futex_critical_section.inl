@@ -0,0 +1,73 @@
+/*!
+    \file futex_critical_section.inl
+    \brief Futex-based critical section synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool FutexCriticalSection::TryLock() noexcept
+{
+    uint32_t expected = Unlocked;
+    return _state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline bool FutexCriticalSection::Spin() noexcept
+{
+    const uint32_t limit = Futex::SpinCount();
+    if (limit == 0)
+        return false;
+
+    // Spin up to twice the average count of previous successful spins
+    const uint32_t spin = _spin.load(std::memory_order_relaxed);
+    const uint32_t attempts = std::min(limit, 2 * spin + 10);
+    for (uint32_t i = 0; i < attempts; ++i)
+    {
+        if ((_state.load(std::memory_order_relaxed) == Unlocked) && TryLock())
+        {
+            // Adapt the spin count to the current contention
+            _spin.store(spin + ((int32_t)(i - spin) / 8), std::memory_order_relaxed);
+            return true;
+        }
+        BackoffWait::Pause();
+    }
+
+    _spin.store(spin + ((int32_t)(attempts - spin) / 8), std::memory_order_relaxed);
+    return false;
+}
+
+inline bool FutexCriticalSection::TryLockFor(const Timespan& timespan) noexcept
+{
+    if (TryLock() || Spin())
+        return true;
+
+    const uint64_t deadline = Timestamp::nano() + std::max<int64_t>(timespan.nanoseconds(), 0);
+    while (_state.exchange(Contended, std::memory_order_acquire) != Unlocked)
+    {
+        const uint64_t current = Timestamp::nano();
+        if (current >= deadline)
+            return false;
+        Futex::WaitFor(_state, Contended, Timespan((int64_t)(deadline - current)));
+    }
+    return true;
+}
+
+inline void FutexCriticalSection::Lock() noexcept
+{
+    if (TryLock() || Spin())
+        return;
+
+    // Mark the critical section as contended, so the owner will wake us up
+    while (_state.exchange(Contended, std::memory_order_acquire) != Unlocked)
+        Futex::Wait(_state, Contended);
+}
+
+inline void FutexCriticalSection::Unlock() noexcept
+{
+    if (_state.exchange(Unlocked, std::memory_order_release) == Contended)
+        Futex::WakeOne(_state);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,109 @@
+/*!
+    \file futex_event_auto_reset.h
+    \brief Futex-based auto-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_EVENT_AUTO_RESET_H
+#define CPPCOMMON_THREADS_FUTEX_EVENT_AUTO_RESET_H
+
+#include "threads/futex.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Futex-based auto-reset event synchronization primitive
+/*!
+    Futex-based auto-reset event keeps its whole state in a single 32-bit
+    word: the low half is the count of pending signals and the high half is
+    the count of registered waiters. Each signal releases one waiter and
+    signals without waiters are coalesced into the single signaled state.
+    Signal and wait never enter the kernel when there is no thread waiting
+    for the event. Waiting thread spins for a short while before parking
+    on the futex.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
+*/
+class FutexEventAutoReset
+{
+public:
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit FutexEventAutoReset(bool signaled = false) noexcept : _state(signaled ? 1 : 0) {}
+    FutexEventAutoReset(const FutexEventAutoReset&) = delete;
+    FutexEventAutoReset(FutexEventAutoReset&&) = delete;
+    ~FutexEventAutoReset() = default;
+
+    FutexEventAutoReset& operator=(const FutexEventAutoReset&) = delete;
+    FutexEventAutoReset& operator=(FutexEventAutoReset&&) = delete;
+
+    //! Signal one of waiting thread about event occurred
+    /*!
+        If some threads are waiting for the event one of them will be signaled and continued.
+
+        Will not block.
+    */
+    void Signal() noexcept;
+
+    //! Try to wait the event without block
+    /*!
+        Will not block.
+
+        \return 'true' if the event was occurred before and no other threads were signaled, 'false' if the event was not occurred before
+    */
+    bool TryWait() noexcept;
+
+    //! Try to wait the event for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the event
+        \return 'true' if the event was occurred, 'false' if the event was not occurred
+    */
+    bool TryWaitFor(const Timespan& timespan) noexcept;
+    //! Try to wait the event until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the event
+        \return 'true' if the event was occurred, 'false' if the event was not occurred
+    */
+    bool TryWaitUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryWaitFor(timestamp - UtcTimestamp()); }
+
+    //! Try to wait the event with block
+    /*!
+        Will block.
+    */
+    void Wait() noexcept;
+
+private:
+    static const uint32_t SignalMask = 0x0000FFFF;
+    static const uint32_t WaiterOne = 0x00010000;
+
+    std::atomic<uint32_t> _state;
+
+    //! Spin for a while trying to consume the signaled event
+    bool Spin() noexcept;
+    //! Wait the event as a registered waiter
+    bool Acquire(uint64_t deadline) noexcept;
+};
+
+/*! \example threads_futex_event_auto_reset.cpp Futex-based auto-reset event synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "futex_event_auto_reset.inl"
+
+#endif // CPPCOMMON_THREADS_FUTEX_EVENT_AUTO_RESET_H
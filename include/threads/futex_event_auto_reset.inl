@@ -0,0 +1,102 @@
+/*!
+    \file futex_event_auto_reset.inl
+    \brief Futex-based auto-reset event synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void FutexEventAutoReset::Signal() noexcept
+{
+    uint32_t state = _state.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        // Allow one pending signal for each registered waiter or a single one without waiters
+        const uint32_t waiters = state / WaiterOne;
+        const uint32_t signals = state & SignalMask;
+        if (signals >= std::max<uint32_t>(waiters, 1))
+            return;
+
+        if (_state.compare_exchange_weak(state, state + 1, std::memory_order_release, std::memory_order_relaxed))
+        {
+            // Wake up one waiter only if someone has registered on the event
+            if (waiters > 0)
+                Futex::WakeOne(_state);
+            return;
+        }
+    }
+}
+
+inline bool FutexEventAutoReset::TryWait() noexcept
+{
+    uint32_t state = _state.load(std::memory_order_relaxed);
+    while ((state & SignalMask) > 0)
+        if (_state.compare_exchange_weak(state, state - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    return false;
+}
+
+inline bool FutexEventAutoReset::Spin() noexcept
+{
+    const uint32_t limit = Futex::SpinCount();
+    for (uint32_t i = 0; i < limit; ++i)
+    {
+        if (((_state.load(std::memory_order_relaxed) & SignalMask) > 0) && TryWait())
+            return true;
+        BackoffWait::Pause();
+    }
+    return false;
+}
+
+inline bool FutexEventAutoReset::Acquire(uint64_t deadline) noexcept
+{
+    // Register the waiter, so the signaling thread will wake us up
+    uint32_t state = _state.fetch_add(WaiterOne, std::memory_order_relaxed) + WaiterOne;
+    for (;;)
+    {
+        // Consume the signal and unregister the waiter in one step
+        if ((state & SignalMask) > 0)
+        {
+            if (_state.compare_exchange_weak(state, state - 1 - WaiterOne, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+            continue;
+        }
+
+        if (deadline == 0)
+            Futex::Wait(_state, state);
+        else
+        {
+            const uint64_t current = Timestamp::nano();
+            if (current >= deadline)
+            {
+                // Unregister the waiter only if nothing is available yet
+                if (_state.compare_exchange_weak(state, state - WaiterOne, std::memory_order_relaxed, std::memory_order_relaxed))
+                    return false;
+                continue;
+            }
+            Futex::WaitFor(_state, state, Timespan((int64_t)(deadline - current)));
+        }
+
+        state = _state.load(std::memory_order_relaxed);
+    }
+}
+
+inline bool FutexEventAutoReset::TryWaitFor(const Timespan& timespan) noexcept
+{
+    if (TryWait() || Spin())
+        return true;
+
+    return Acquire(Timestamp::nano() + std::max<int64_t>(timespan.nanoseconds(), 1));
+}
+
+inline void FutexEventAutoReset::Wait() noexcept
+{
+    if (TryWait() || Spin())
+        return;
+
+    Acquire(0);
+}
+
+} // namespace CppCommon
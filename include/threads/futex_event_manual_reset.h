@@ -0,0 +1,115 @@
+/*!
+    \file futex_event_manual_reset.h
+    \brief Futex-based manual-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_EVENT_MANUAL_RESET_H
+#define CPPCOMMON_THREADS_FUTEX_EVENT_MANUAL_RESET_H
+
+#include "threads/futex.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Futex-based manual-reset event synchronization primitive
+/*!
+    Futex-based manual-reset event keeps its whole state in a single 32-bit
+    word: signaled, reset or reset with waiters. Wait on the signaled event
+    is a single atomic load and signal enters the kernel only if there are
+    parked waiters. Waiting thread spins for a short while before parking
+    on the futex.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
+*/
+class FutexEventManualReset
+{
+public:
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit FutexEventManualReset(bool signaled = false) noexcept : _state(signaled ? Signaled : NotSignaled) {}
+    FutexEventManualReset(const FutexEventManualReset&) = delete;
+    FutexEventManualReset(FutexEventManualReset&&) = delete;
+    ~FutexEventManualReset() = default;
+
+    FutexEventManualReset& operator=(const FutexEventManualReset&) = delete;
+    FutexEventManualReset& operator=(FutexEventManualReset&&) = delete;
+
+    //! Reset the event
+    /*!
+        If the event is in the signaled state then it will be reset to non signaled state.
+        As the result other threads that wait for the event will be blocked.
+
+        Will not block.
+    */
+    void Reset() noexcept;
+
+    //! Signal one of waiting thread about event occurred
+    /*!
+        If some threads are waiting for the event all of them will be signaled and continued.
+
+        Will not block.
+    */
+    void Signal() noexcept;
+
+    //! Try to wait the event without block
+    /*!
+        Will not block.
+
+        \return 'true' if the event was occurred before, 'false' if the event was not occurred before
+    */
+    bool TryWait() noexcept;
+
+    //! Try to wait the event for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the event
+        \return 'true' if the event was occurred, 'false' if the event was not occurred
+    */
+    bool TryWaitFor(const Timespan& timespan) noexcept;
+    //! Try to wait the event until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the event
+        \return 'true' if the event was occurred, 'false' if the event was not occurred
+    */
+    bool TryWaitUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryWaitFor(timestamp - UtcTimestamp()); }
+
+    //! Try to wait the event with block
+    /*!
+        Will block.
+    */
+    void Wait() noexcept;
+
+private:
+    enum : uint32_t { NotSignaled = 0, Signaled = 1, Waiting = 2 };
+
+    std::atomic<uint32_t> _state;
+
+    //! Spin for a while waiting for the event
+    bool Spin() noexcept;
+    //! Mark the event as waited and check if it is still reset
+    bool Prepare() noexcept;
+};
+
+/*! \example threads_futex_event_manual_reset.cpp Futex-based manual-reset event synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "futex_event_manual_reset.inl"
+
+#endif // CPPCOMMON_THREADS_FUTEX_EVENT_MANUAL_RESET_H
@@ -0,0 +1,76 @@
+/*!
+    \file futex_event_manual_reset.inl
+    \brief Futex-based manual-reset event synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void FutexEventManualReset::Reset() noexcept
+{
+    // Keep 'Waiting' state untouched as parked waiters still need a wake up
+    uint32_t expected = Signaled;
+    _state.compare_exchange_strong(expected, NotSignaled, std::memory_order_relaxed, std::memory_order_relaxed);
+}
+
+inline void FutexEventManualReset::Signal() noexcept
+{
+    // Wake up all waiters only if someone has parked on the event
+    if (_state.exchange(Signaled, std::memory_order_release) == Waiting)
+        Futex::WakeAll(_state);
+}
+
+inline bool FutexEventManualReset::TryWait() noexcept
+{
+    return _state.load(std::memory_order_acquire) == Signaled;
+}
+
+inline bool FutexEventManualReset::Spin() noexcept
+{
+    const uint32_t limit = Futex::SpinCount();
+    for (uint32_t i = 0; i < limit; ++i)
+    {
+        if (TryWait())
+            return true;
+        BackoffWait::Pause();
+    }
+    return false;
+}
+
+inline bool FutexEventManualReset::Prepare() noexcept
+{
+    uint32_t state = _state.load(std::memory_order_acquire);
+    while (state == NotSignaled)
+        if (_state.compare_exchange_weak(state, Waiting, std::memory_order_acquire, std::memory_order_acquire))
+            return true;
+    return (state == Waiting);
+}
+
+inline bool FutexEventManualReset::TryWaitFor(const Timespan& timespan) noexcept
+{
+    if (TryWait() || Spin())
+        return true;
+
+    const uint64_t deadline = Timestamp::nano() + std::max<int64_t>(timespan.nanoseconds(), 0);
+    while (Prepare())
+    {
+        const uint64_t current = Timestamp::nano();
+        if (current >= deadline)
+            return false;
+        Futex::WaitFor(_state, Waiting, Timespan((int64_t)(deadline - current)));
+    }
+    return true;
+}
+
+inline void FutexEventManualReset::Wait() noexcept
+{
+    if (TryWait() || Spin())
+        return;
+
+    while (Prepare())
+        Futex::Wait(_state, Waiting);
+}
+
+} // namespace CppCommon
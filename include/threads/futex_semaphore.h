@@ -0,0 +1,113 @@
+/*!
+    \file futex_semaphore.h
+    \brief Futex-based semaphore synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_SEMAPHORE_H
+#define CPPCOMMON_THREADS_FUTEX_SEMAPHORE_H
+
+#include "threads/futex.h"
+#include "threads/locker.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Futex-based semaphore synchronization primitive
+/*!
+    Futex-based semaphore keeps its whole state in a single 32-bit word: the
+    low half is the count of available resources and the high half is the
+    count of parked waiters. Lock with available resources and unlock without
+    waiters are a single atomic operation each and never enter the kernel.
+    Contended lock spins for a short while before parking on the futex.
+
+    The count of resources is limited by 65535.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Semaphore_(programming)
+*/
+class FutexSemaphore
+{
+public:
+    //! Default class constructor
+    /*!
+        \param resources - Semaphore resources counter
+    */
+    explicit FutexSemaphore(int resources) noexcept;
+    FutexSemaphore(const FutexSemaphore&) = delete;
+    FutexSemaphore(FutexSemaphore&&) = delete;
+    ~FutexSemaphore() = default;
+
+    FutexSemaphore& operator=(const FutexSemaphore&) = delete;
+    FutexSemaphore& operator=(FutexSemaphore&&) = delete;
+
+    //! Get the semaphore resources counter
+    int resources() const noexcept { return _resources; }
+
+    //! Try to acquire semaphore without block
+    /*!
+        Will not block.
+
+        \return 'true' if the semaphore was successfully acquired, 'false' if the semaphore is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire semaphore for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the semaphore
+        \return 'true' if the semaphore was successfully acquired, 'false' if the semaphore is busy
+    */
+    bool TryLockFor(const Timespan& timespan) noexcept;
+    //! Try to acquire semaphore until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the semaphore
+        \return 'true' if the semaphore was successfully acquired, 'false' if the semaphore is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire semaphore with block
+    /*!
+        Will block.
+    */
+    void Lock() noexcept;
+
+    //! Release semaphore
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    static const uint32_t CountMask = 0x0000FFFF;
+    static const uint32_t WaiterOne = 0x00010000;
+
+    int _resources;
+    std::atomic<uint32_t> _state;
+
+    //! Spin for a while trying to acquire semaphore
+    bool Spin() noexcept;
+    //! Acquire semaphore as a registered waiter
+    bool Acquire(uint64_t deadline) noexcept;
+};
+
+/*! \example threads_futex_semaphore.cpp Futex-based semaphore synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "futex_semaphore.inl"
+
+#endif // CPPCOMMON_THREADS_FUTEX_SEMAPHORE_H
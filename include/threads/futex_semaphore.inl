@@ -0,0 +1,96 @@
+/*!
+    \file futex_semaphore.inl
+    \brief Futex-based semaphore synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline FutexSemaphore::FutexSemaphore(int resources) noexcept : _resources(resources), _state((uint32_t)resources)
+{
+    assert((resources > 0) && "Semaphore resources counter must be greater than zero!");
+    assert(((uint32_t)resources <= CountMask) && "Semaphore resources counter must not exceed 65535!");
+}
+
+inline bool FutexSemaphore::TryLock() noexcept
+{
+    uint32_t state = _state.load(std::memory_order_relaxed);
+    while ((state & CountMask) > 0)
+        if (_state.compare_exchange_weak(state, state - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    return false;
+}
+
+inline bool FutexSemaphore::Spin() noexcept
+{
+    const uint32_t limit = Futex::SpinCount();
+    for (uint32_t i = 0; i < limit; ++i)
+    {
+        if (((_state.load(std::memory_order_relaxed) & CountMask) > 0) && TryLock())
+            return true;
+        BackoffWait::Pause();
+    }
+    return false;
+}
+
+inline bool FutexSemaphore::Acquire(uint64_t deadline) noexcept
+{
+    // Register the waiter, so the releasing thread will wake us up
+    uint32_t state = _state.fetch_add(WaiterOne, std::memory_order_relaxed) + WaiterOne;
+    for (;;)
+    {
+        // Take the resource and unregister the waiter in one step
+        if ((state & CountMask) > 0)
+        {
+            if (_state.compare_exchange_weak(state, state - 1 - WaiterOne, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+            continue;
+        }
+
+        if (deadline == 0)
+            Futex::Wait(_state, state);
+        else
+        {
+            const uint64_t current = Timestamp::nano();
+            if (current >= deadline)
+            {
+                // Unregister the waiter only if nothing is available yet
+                if (_state.compare_exchange_weak(state, state - WaiterOne, std::memory_order_relaxed, std::memory_order_relaxed))
+                    return false;
+                continue;
+            }
+            Futex::WaitFor(_state, state, Timespan((int64_t)(deadline - current)));
+        }
+
+        state = _state.load(std::memory_order_relaxed);
+    }
+}
+
+inline bool FutexSemaphore::TryLockFor(const Timespan& timespan) noexcept
+{
+    if (TryLock() || Spin())
+        return true;
+
+    return Acquire(Timestamp::nano() + std::max<int64_t>(timespan.nanoseconds(), 1));
+}
+
+inline void FutexSemaphore::Lock() noexcept
+{
+    if (TryLock() || Spin())
+        return;
+
+    Acquire(0);
+}
+
+inline void FutexSemaphore::Unlock() noexcept
+{
+    // Wake up one waiter only if someone has registered on the semaphore
+    uint32_t state = _state.fetch_add(1, std::memory_order_release);
+    assert((((state & CountMask) + 1) <= (uint32_t)_resources) && "Semaphore is released more times than acquired!");
+    if ((state & ~CountMask) != 0)
+        Futex::WakeOne(_state);
+}
+
+} // namespace CppCommon
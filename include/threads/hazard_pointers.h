@@ -0,0 +1,166 @@
+/*!
+    \file hazard_pointers.h
+    \brief Hazard pointers memory reclamation manager definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_HAZARD_POINTERS_H
+#define CPPCOMMON_THREADS_HAZARD_POINTERS_H
+
+#include "threads/thread_records.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Hazard pointers memory reclamation manager
+/*!
+    Hazard pointers allow lock-free data structures to free unlinked nodes
+    safely while other threads might still read them. Each thread owns a
+    fixed count of hazard pointer slots. Reader publishes the pointer it is
+    going to access in its slot and validates that the pointer is still
+    reachable. Writers retire unlinked objects and free them in batches after
+    scanning all published hazard pointers.
+
+    Unlike EpochManager a stalled reader protects only the objects it has
+    published, so the count of not freed objects is always bounded. The cost
+    is a full memory barrier for each protected pointer.
+
+    Threads are registered on the first access and could be registered and
+    unregistered explicitly. Hazard pointers of exited threads are cleared,
+    and objects retired by exited threads are freed by other threads during
+    the reclamation.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Hazard_pointer
+*/
+class HazardPointers
+{
+public:
+    //! Default class constructor
+    /*!
+        \param hazards - Count of hazard pointers for each thread (default is 2)
+        \param threshold - Count of retired objects in the thread record to start the reclamation (default is 64)
+    */
+    explicit HazardPointers(size_t hazards = 2, size_t threshold = 64);
+    HazardPointers(const HazardPointers&) = delete;
+    HazardPointers(HazardPointers&&) = delete;
+    ~HazardPointers();
+
+    HazardPointers& operator=(const HazardPointers&) = delete;
+    HazardPointers& operator=(HazardPointers&&) = delete;
+
+    //! Get the count of hazard pointers for each thread
+    size_t hazards() const noexcept { return _hazards; }
+    //! Get the count of retired objects to start the reclamation
+    size_t threshold() const noexcept { return _threshold; }
+
+    //! Register the current thread
+    /*!
+        Registration is performed automatically on the first access from the thread.
+    */
+    void RegisterThread();
+    //! Unregister the current thread
+    /*!
+        Clears all hazard pointers of the current thread. Not freed objects are left for other threads.
+    */
+    void UnregisterThread();
+
+    //! Protect the pointer loaded from the given source with the hazard pointer
+    /*!
+        Loads the pointer from the source, publishes it in the given hazard
+        pointer slot and repeats until the source is not changed.
+
+        Will not block.
+
+        \param index - Hazard pointer index
+        \param source - Source atomic pointer
+        \return Protected pointer
+    */
+    template <typename T>
+    T* Protect(size_t index, const std::atomic<T*>& source);
+
+    //! Publish the given pointer in the hazard pointer slot
+    /*!
+        The caller is responsible to validate that the pointer is still reachable after the call.
+
+        \param index - Hazard pointer index
+        \param ptr - Pointer to protect
+    */
+    void Set(size_t index, const void* ptr);
+    //! Clear the hazard pointer slot
+    /*!
+        \param index - Hazard pointer index
+    */
+    void Clear(size_t index);
+    //! Clear all hazard pointer slots of the current thread
+    void ClearAll();
+
+    //! Retire the object to be deleted when it is not protected by any hazard pointer
+    /*!
+        The object must be already unlinked from the shared data structure.
+
+        \param ptr - Pointer to the object to retire
+    */
+    template <typename T>
+    void Retire(T* ptr);
+    //! Retire the memory to be freed with the given deleter when it is not protected by any hazard pointer
+    /*!
+        \param ptr - Pointer to the memory to retire
+        \param deleter - Deleter function
+    */
+    void Retire(void* ptr, void (*deleter)(void*));
+
+    //! Free retired objects which are not protected by any hazard pointer
+    /*!
+        Adopts retired objects of exited threads.
+
+        Will not block.
+    */
+    void Reclaim();
+
+private:
+    // Retired object
+    struct Retired
+    {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+
+    // Thread state
+    struct State
+    {
+        std::atomic<std::atomic<const void*>*> hazards;
+        std::unique_ptr<std::atomic<const void*>[]> storage;
+        size_t count;
+        std::vector<Retired> retired;
+
+        State() : hazards(nullptr), count(0) {}
+
+        // Clear hazard pointers of the released thread record
+        void Release() noexcept;
+    };
+
+    size_t _hazards;
+    size_t _threshold;
+    Internals::ThreadRecords<State> _records;
+
+    //! Get the hazard pointer slots of the current thread
+    std::atomic<const void*>* Current();
+};
+
+/*! \example threads_hazard_pointers.cpp Hazard pointers memory reclamation manager example */
+
+} // namespace CppCommon
+
+#include "hazard_pointers.inl"
+
+#endif // CPPCOMMON_THREADS_HAZARD_POINTERS_H
@@ -0,0 +1,175 @@
+/*!
+    \file hazard_pointers.inl
+    \brief Hazard pointers memory reclamation manager inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline HazardPointers::HazardPointers(size_t hazards, size_t threshold) : _hazards(hazards), _threshold(threshold)
+{
+    assert((hazards > 0) && "Count of hazard pointers must be greater than zero!");
+}
+
+inline HazardPointers::~HazardPointers()
+{
+    // Free all retired objects, no reader must be active at this point
+    for (auto record = _records.head(); record != nullptr; record = record->next)
+    {
+        for (auto& retired : record->data.retired)
+            retired.deleter(retired.ptr);
+        record->data.retired.clear();
+    }
+}
+
+inline std::atomic<const void*>* HazardPointers::Current()
+{
+    State& state = _records.Current().data;
+
+    // Allocate hazard pointer slots on the first access
+    std::atomic<const void*>* hazards = state.hazards.load(std::memory_order_relaxed);
+    if (hazards == nullptr)
+    {
+        state.storage = std::make_unique<std::atomic<const void*>[]>(_hazards);
+        for (size_t i = 0; i < _hazards; ++i)
+            state.storage[i].store(nullptr, std::memory_order_relaxed);
+        hazards = state.storage.get();
+        state.count = _hazards;
+        state.hazards.store(hazards, std::memory_order_release);
+    }
+    return hazards;
+}
+
+inline void HazardPointers::RegisterThread()
+{
+    Current();
+}
+
+inline void HazardPointers::UnregisterThread()
+{
+    ClearAll();
+    Reclaim();
+    _records.Release();
+}
+
+inline void HazardPointers::State::Release() noexcept
+{
+    std::atomic<const void*>* slots = hazards.load(std::memory_order_relaxed);
+    if (slots == nullptr)
+        return;
+
+    for (size_t i = 0; i < count; ++i)
+        slots[i].store(nullptr, std::memory_order_release);
+}
+
+template <typename T>
+inline T* HazardPointers::Protect(size_t index, const std::atomic<T*>& source)
+{
+    assert((index < _hazards) && "Invalid hazard pointer index!");
+
+    std::atomic<const void*>& hazard = Current()[index];
+    T* ptr = source.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        // Publish the hazard pointer and validate the source is not changed
+        hazard.store(ptr, std::memory_order_seq_cst);
+        T* current = source.load(std::memory_order_seq_cst);
+        if (current == ptr)
+            return ptr;
+        ptr = current;
+    }
+}
+
+inline void HazardPointers::Set(size_t index, const void* ptr)
+{
+    assert((index < _hazards) && "Invalid hazard pointer index!");
+
+    Current()[index].store(ptr, std::memory_order_seq_cst);
+}
+
+inline void HazardPointers::Clear(size_t index)
+{
+    assert((index < _hazards) && "Invalid hazard pointer index!");
+
+    Current()[index].store(nullptr, std::memory_order_release);
+}
+
+inline void HazardPointers::ClearAll()
+{
+    std::atomic<const void*>* hazards = Current();
+    for (size_t i = 0; i < _hazards; ++i)
+        hazards[i].store(nullptr, std::memory_order_release);
+}
+
+template <typename T>
+inline void HazardPointers::Retire(T* ptr)
+{
+    Retire(ptr, [](void* p) { delete static_cast<T*>(p); });
+}
+
+inline void HazardPointers::Retire(void* ptr, void (*deleter)(void*))
+{
+    if (ptr == nullptr)
+        return;
+
+    State& state = _records.Current().data;
+    state.retired.push_back(Retired{ ptr, deleter });
+
+    // Free retired objects in batches
+    if (state.retired.size() >= _threshold)
+        Reclaim();
+}
+
+inline void HazardPointers::Reclaim()
+{
+    State& state = _records.Current().data;
+
+    // Adopt objects retired by exited threads
+    for (auto record = _records.head(); record != nullptr; record = record->next)
+    {
+        bool owned = false;
+        if (!record->owned.load(std::memory_order_relaxed) && record->owned.compare_exchange_strong(owned, true, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            state.retired.insert(state.retired.end(), record->data.retired.begin(), record->data.retired.end());
+            record->data.retired.clear();
+            record->owned.store(false, std::memory_order_release);
+        }
+    }
+
+    if (state.retired.empty())
+        return;
+
+    // Collect all published hazard pointers
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::vector<const void*> protect;
+    for (auto record = _records.head(); record != nullptr; record = record->next)
+    {
+        std::atomic<const void*>* hazards = record->data.hazards.load(std::memory_order_acquire);
+        if (hazards == nullptr)
+            continue;
+
+        for (size_t i = 0; i < _hazards; ++i)
+        {
+            const void* ptr = hazards[i].load(std::memory_order_seq_cst);
+            if (ptr != nullptr)
+                protect.push_back(ptr);
+        }
+    }
+    std::sort(protect.begin(), protect.end());
+
+    // Free retired objects which are not protected
+    size_t kept = 0;
+    for (size_t i = 0; i < state.retired.size(); ++i)
+    {
+        Retired& retired = state.retired[i];
+        if (std::binary_search(protect.begin(), protect.end(), static_cast<const void*>(retired.ptr)))
+            state.retired[kept++] = retired;
+        else
+            retired.deleter(retired.ptr);
+    }
+    state.retired.resize(kept);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,153 @@
+/*!
+    \file mcs_spin_lock.inl
+    \brief MCS queue spin-lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline MCSSpinLock::NodeCache::~NodeCache()
+{
+    for (auto node : nodes)
+        delete node;
+}
+
+inline MCSSpinLock::NodeCache& MCSSpinLock::Cache()
+{
+    static thread_local NodeCache cache;
+    return cache;
+}
+
+inline MCSSpinLock::Node* MCSSpinLock::Allocate()
+{
+    NodeCache& cache = Cache();
+    if (cache.nodes.empty())
+        return new Node();
+
+    Node* node = cache.nodes.back();
+    cache.nodes.pop_back();
+    return node;
+}
+
+inline void MCSSpinLock::Free(Node* node)
+{
+    Cache().nodes.push_back(node);
+}
+
+inline bool MCSSpinLock::IsLocked() noexcept
+{
+    return _tail.load(std::memory_order_acquire) != nullptr;
+}
+
+inline bool MCSSpinLock::TryLock() noexcept
+{
+    // Fast check to avoid taking the node for the busy lock
+    if (_tail.load(std::memory_order_relaxed) != nullptr)
+        return false;
+
+    Node* node = Allocate();
+    node->next.store(nullptr, std::memory_order_relaxed);
+    node->locked.store(false, std::memory_order_relaxed);
+
+    Node* expected = nullptr;
+    if (!_tail.compare_exchange_strong(expected, node, std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+        Free(node);
+        return false;
+    }
+
+    _owner = node;
+    return true;
+}
+
+inline bool MCSSpinLock::TryLockSpin(int64_t spin) noexcept
+{
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+    } while (spin-- > 0);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline bool MCSSpinLock::TryLockFor(const Timespan& timespan) noexcept
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+    } while (NanoTimestamp() < finish);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline void MCSSpinLock::Lock() noexcept
+{
+    Node* node = Allocate();
+    node->next.store(nullptr, std::memory_order_relaxed);
+    node->locked.store(true, std::memory_order_relaxed);
+
+    // Enqueue the node and link it to the predecessor
+    Node* predecessor = _tail.exchange(node, std::memory_order_acq_rel);
+    if (predecessor != nullptr)
+    {
+        predecessor->next.store(node, std::memory_order_release);
+
+        // Spin on the own node until the predecessor hands the lock over
+        const uint32_t limit = Futex::SpinCount();
+        uint32_t attempts = 0;
+        while (node->locked.load(std::memory_order_acquire))
+        {
+            if (attempts++ < limit)
+                BackoffWait::Pause();
+            else
+                Thread::Yield();
+        }
+    }
+
+    _owner = node;
+}
+
+inline void MCSSpinLock::Unlock() noexcept
+{
+    Node* node = _owner;
+
+    Node* next = node->next.load(std::memory_order_acquire);
+    if (next == nullptr)
+    {
+        // Release the lock if there is no successor
+        Node* expected = node;
+        if (_tail.compare_exchange_strong(expected, nullptr, std::memory_order_release, std::memory_order_relaxed))
+        {
+            Free(node);
+            return;
+        }
+
+        // Wait for the successor to link its node
+        const uint32_t limit = Futex::SpinCount();
+        uint32_t attempts = 0;
+        while ((next = node->next.load(std::memory_order_acquire)) == nullptr)
+        {
+            if (attempts++ < limit)
+                BackoffWait::Pause();
+            else
+                Thread::Yield();
+        }
+    }
+
+    // Hand the lock over to the successor
+    next->locked.store(false, std::memory_order_release);
+    Free(node);
+}
+
+} // namespace CppCommon
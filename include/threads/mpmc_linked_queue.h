@@ -0,0 +1,137 @@
+/*!
+    \file mpmc_linked_queue.h
+    \brief Multiple producers / multiple consumers lock-free segmented linked queue definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
+#define CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
+
+#include "threads/hazard_pointers.h"
+#include "utility/resource.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace CppCommon {
+
+//! Multiple producers / multiple consumers lock-free segmented linked queue
+/*!
+    Multiple producers / multiple consumers lock-free segmented linked queue
+    use only atomic operations to provide thread-safe enqueue and dequeue
+    operations. Linked queue is an unbounded queue which consists of linked
+    segments with arrays of slots. Producers and consumers take slots of the
+    tail and head segments with a single fetch-and-add operation, so memory is
+    allocated only once per segment. Consumed segments are freed safely with
+    hazard pointers.
+
+    If the consumer takes the slot before the producer fills it, the slot is
+    abandoned and the producer retries with the next one.
+
+    FIFO order is guaranteed for items of the same producer!
+
+    Thread-safe.
+
+    Based on the FAAArrayQueue by Pedro Ramalhete and Andreia Correia
+    https://github.com/pramalhe/ConcurrencyFreaks
+*/
+template<typename T>
+class MPMCLinkedQueue
+{
+public:
+    //! Default class constructor
+    /*!
+        \param segment - Count of slots in one segment (default is 1024)
+    */
+    explicit MPMCLinkedQueue(size_t segment = 1024);
+    MPMCLinkedQueue(const MPMCLinkedQueue&) = delete;
+    MPMCLinkedQueue(MPMCLinkedQueue&&) = delete;
+    ~MPMCLinkedQueue();
+
+    MPMCLinkedQueue& operator=(const MPMCLinkedQueue&) = delete;
+    MPMCLinkedQueue& operator=(MPMCLinkedQueue&&) = delete;
+
+    //! Get the count of slots in one segment
+    size_t segment() const noexcept { return _segment; }
+
+    //! Enqueue an item into the linked queue (multiple producers threads method)
+    /*!
+        The item will be copied into the linked queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for the queue segment
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the linked queue (multiple producers threads method)
+    /*!
+        The item will be moved into the linked queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for the queue segment
+    */
+    bool Enqueue(T&& item);
+
+    //! Dequeue an item from the linked queue (multiple consumers threads method)
+    /*!
+        The item will be moved from the linked queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the linked queue is empty
+    */
+    bool Dequeue(T& item);
+
+private:
+    typedef char cache_line_pad[128];
+
+    enum : uint32_t { Empty = 0, Ready = 1, Taken = 2 };
+
+    struct Slot
+    {
+        std::atomic<uint32_t> state;
+        T value;
+
+        Slot() : state(Empty) {}
+    };
+
+    struct Segment
+    {
+        cache_line_pad pad0;
+        std::atomic<size_t> enqueue;
+        cache_line_pad pad1;
+        std::atomic<size_t> dequeue;
+        cache_line_pad pad2;
+        std::atomic<Segment*> next;
+        std::unique_ptr<Slot[]> slots;
+
+        explicit Segment(size_t size);
+    };
+
+    HazardPointers _hazards;
+    size_t _segment;
+
+    cache_line_pad _pad0;
+    std::atomic<Segment*> _head;
+    cache_line_pad _pad1;
+    std::atomic<Segment*> _tail;
+    cache_line_pad _pad2;
+};
+
+/*! \example threads_mpmc_linked_queue.cpp Multiple producers / multiple consumers lock-free segmented linked queue example */
+
+} // namespace CppCommon
+
+#include "mpmc_linked_queue.inl"
+
+#endif // CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
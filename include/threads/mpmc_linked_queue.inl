@@ -0,0 +1,159 @@
+/*!
+    \file mpmc_linked_queue.inl
+    \brief Multiple producers / multiple consumers lock-free segmented linked queue inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline MPMCLinkedQueue<T>::Segment::Segment(size_t size) : enqueue(0), dequeue(0), next(nullptr), slots(new (std::nothrow) Slot[size])
+{
+    memset(pad0, 0, sizeof(cache_line_pad));
+    memset(pad1, 0, sizeof(cache_line_pad));
+    memset(pad2, 0, sizeof(cache_line_pad));
+}
+
+template<typename T>
+inline MPMCLinkedQueue<T>::MPMCLinkedQueue(size_t segment) : _hazards(1), _segment(segment), _head(new Segment(segment)), _tail(_head.load(std::memory_order_relaxed))
+{
+    assert((segment > 0) && "Segment size must be greater than zero!");
+
+    if (!_head.load(std::memory_order_relaxed)->slots)
+    {
+        delete _head.load(std::memory_order_relaxed);
+        throw std::bad_alloc();
+    }
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+}
+
+template<typename T>
+inline MPMCLinkedQueue<T>::~MPMCLinkedQueue()
+{
+    // Remove all segments from the linked queue
+    Segment* segment = _head.load(std::memory_order_relaxed);
+    while (segment != nullptr)
+    {
+        Segment* next = segment->next.load(std::memory_order_relaxed);
+        delete segment;
+        segment = next;
+    }
+}
+
+template<typename T>
+inline bool MPMCLinkedQueue<T>::Enqueue(const T& item)
+{
+    T temp = item;
+    return Enqueue(std::forward<T>(temp));
+}
+
+template<typename T>
+inline bool MPMCLinkedQueue<T>::Enqueue(T&& item)
+{
+    // Clear the hazard pointer on any exit including exceptions
+    auto hazard = resource([this](void*) { _hazards.Clear(0); });
+
+    for (;;)
+    {
+        Segment* tail = _hazards.Protect(0, _tail);
+
+        // Take the next slot of the tail segment
+        size_t index = tail->enqueue.fetch_add(1, std::memory_order_relaxed);
+        if (index < _segment)
+        {
+            Slot& slot = tail->slots[index];
+            slot.value = std::move(item);
+
+            // Publish the item unless the slot was abandoned by the consumer
+            uint32_t state = Empty;
+            if (slot.state.compare_exchange_strong(state, Ready, std::memory_order_release, std::memory_order_relaxed))
+                return true;
+
+            item = std::move(slot.value);
+            continue;
+        }
+
+        // Tail segment is full, so link the new one or help to advance the tail
+        Segment* next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            _tail.compare_exchange_strong(tail, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+
+        std::unique_ptr<Segment> segment(new (std::nothrow) Segment(_segment));
+        if (!segment || !segment->slots)
+            return false;
+
+        // Fill the first slot of the new segment with the given value
+        segment->enqueue.store(1, std::memory_order_relaxed);
+        segment->slots[0].value = std::move(item);
+        segment->slots[0].state.store(Ready, std::memory_order_relaxed);
+
+        if (tail->next.compare_exchange_strong(next, segment.get(), std::memory_order_release, std::memory_order_acquire))
+        {
+            Segment* linked = segment.release();
+            _tail.compare_exchange_strong(tail, linked, std::memory_order_release, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Another producer has linked its segment first
+        item = std::move(segment->slots[0].value);
+    }
+}
+
+template<typename T>
+inline bool MPMCLinkedQueue<T>::Dequeue(T& item)
+{
+    // Clear the hazard pointer on any exit including exceptions
+    auto hazard = resource([this](void*) { _hazards.Clear(0); });
+
+    for (;;)
+    {
+        Segment* head = _hazards.Protect(0, _head);
+
+        // Check if the linked queue is empty
+        if ((head->dequeue.load(std::memory_order_relaxed) >= head->enqueue.load(std::memory_order_relaxed)) && (head->next.load(std::memory_order_relaxed) == nullptr))
+            break;
+
+        // Take the next slot of the head segment
+        size_t index = head->dequeue.fetch_add(1, std::memory_order_relaxed);
+        if (index < _segment)
+        {
+            Slot& slot = head->slots[index];
+
+            // Take the item or abandon the slot which is not filled yet
+            if (slot.state.exchange(Taken, std::memory_order_acquire) == Ready)
+            {
+                item = std::move(slot.value);
+                return true;
+            }
+            continue;
+        }
+
+        // Head segment is drained, so move to the next one
+        Segment* next = head->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+            break;
+
+        // Head must not pass the tail, otherwise producers could access the freed segment
+        Segment* tail = _tail.load(std::memory_order_acquire);
+        if (tail == head)
+            _tail.compare_exchange_strong(tail, next, std::memory_order_release, std::memory_order_relaxed);
+
+        if (_head.compare_exchange_strong(head, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            _hazards.Clear(0);
+            _hazards.Retire(head);
+        }
+    }
+
+    return false;
+}
+
+} // namespace CppCommon
@@ -13,6 +13,8 @@
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace CppCommon {
@@ -75,6 +77,23 @@ public:
         \return 'true' if the item was successfully enqueue, 'false' if the ring queue is full
     */
     bool Enqueue(T&& item);
+    //! Enqueue a range of items into the ring queue (multiple producers threads method)
+    /*!
+        Items will be copied into the ring queue (use std::move_iterator to move them).
+        The range is traversed twice (to count and to copy items), so forward
+        iterators are required.
+        The contiguous range of free slots is claimed with a single atomic operation,
+        so the ring queue could enqueue only the leading part of the range if there
+        is not enough free space.
+
+        Will not block.
+
+        \param first - First item iterator
+        \param last - Last item iterator
+        \return Count of successfully enqueued items (0 if the ring queue is full)
+    */
+    template <class ForwardIterator>
+    size_t EnqueueBulk(ForwardIterator first, ForwardIterator last);
 
     //! Dequeue an item from the ring queue (multiple consumers threads method)
     /*!
@@ -86,6 +105,19 @@ public:
         \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
     */
     bool Dequeue(T& item);
+    //! Dequeue a range of items from the ring queue (multiple consumers threads method)
+    /*!
+        Items will be moved from the ring queue. The contiguous range of ready
+        slots is claimed with a single atomic operation.
+
+        Will not block.
+
+        \param output - Output iterator to store dequeued items
+        \param max - Maximal count of items to dequeue
+        \return Count of successfully dequeued items (0 if the ring queue is empty)
+    */
+    template <class OutputIterator>
+    size_t DequeueBulk(OutputIterator output, size_t max);
 
 private:
     struct Node
@@ -85,6 +85,67 @@ inline bool MPMCRingQueue<T>::Enqueue(T&& item)
     return false;
 }
 
+template<typename T>
+template <class ForwardIterator>
+inline size_t MPMCRingQueue<T>::EnqueueBulk(ForwardIterator first, ForwardIterator last)
+{
+    static_assert(std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<ForwardIterator>::iterator_category>::value, "Bulk enqueue requires a multi-pass forward iterator!");
+
+    const size_t count = (size_t)std::distance(first, last);
+    if (count == 0)
+        return 0;
+
+    size_t head_sequence = _head.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        // Count contiguous empty slots starting from the head sequence
+        size_t available = 0;
+        int64_t diff = 0;
+        while (available < count)
+        {
+            Node* node = &_buffer[(head_sequence + available) & _mask];
+            size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+            diff = (int64_t)node_sequence - (int64_t)(head_sequence + available);
+            if (diff != 0)
+                break;
+            ++available;
+        }
+
+        if (available > 0)
+        {
+            // Claim all available slots by moving head once
+            if (_head.compare_exchange_weak(head_sequence, head_sequence + available, std::memory_order_relaxed))
+            {
+                for (size_t i = 0; i < available; ++i, ++first)
+                {
+                    Node* node = &_buffer[(head_sequence + i) & _mask];
+
+                    // Store the item value
+                    node->value = *first;
+
+                    // Increment the sequence so that the tail knows it's accessible
+                    node->sequence.store(head_sequence + i + 1, std::memory_order_release);
+                }
+                return available;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The head slot is full and therefore buffer is full
+            return 0;
+        }
+        else
+        {
+            // Under normal circumstances this branch should never be taken
+            head_sequence = _head.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Never happens...
+    return 0;
+}
+
 template<typename T>
 inline bool MPMCRingQueue<T>::Dequeue(T& item)
 {
@@ -129,4 +190,62 @@ inline bool MPMCRingQueue<T>::Dequeue(T& item)
     return false;
 }
 
+template<typename T>
+template <class OutputIterator>
+inline size_t MPMCRingQueue<T>::DequeueBulk(OutputIterator output, size_t max)
+{
+    if (max == 0)
+        return 0;
+
+    size_t tail_sequence = _tail.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        // Count contiguous ready slots starting from the tail sequence
+        size_t available = 0;
+        int64_t diff = 0;
+        while (available < max)
+        {
+            Node* node = &_buffer[(tail_sequence + available) & _mask];
+            size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+            diff = (int64_t)node_sequence - (int64_t)(tail_sequence + available + 1);
+            if (diff != 0)
+                break;
+            ++available;
+        }
+
+        if (available > 0)
+        {
+            // Claim all available slots by moving tail once
+            if (_tail.compare_exchange_weak(tail_sequence, tail_sequence + available, std::memory_order_relaxed))
+            {
+                for (size_t i = 0; i < available; ++i, ++output)
+                {
+                    Node* node = &_buffer[(tail_sequence + i) & _mask];
+
+                    // Get the item value
+                    *output = std::move(node->value);
+
+                    // Set the sequence to what the head sequence should be next time around
+                    node->sequence.store(tail_sequence + i + _mask + 1, std::memory_order_release);
+                }
+                return available;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The tail slot is empty and therefore buffer is empty
+            return 0;
+        }
+        else
+        {
+            // Under normal circumstances this branch should never be taken
+            tail_sequence = _tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Never happens...
+    return 0;
+}
+
 } // namespace CppCommon
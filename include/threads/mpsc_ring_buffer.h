@@ -9,14 +9,11 @@
 #ifndef CPPCOMMON_THREADS_MPSC_RING_BUFFER_H
 #define CPPCOMMON_THREADS_MPSC_RING_BUFFER_H
 
-#include "threads/spin_lock.h"
+#include "threads/producer_lanes.h"
 #include "threads/spsc_ring_buffer.h"
-#include "time/timestamp.h"
 
 #include <cstdio>
-#include <memory>
 #include <thread>
-#include <vector>
 
 namespace CppCommon {
 
@@ -24,11 +21,18 @@ namespace CppCommon {
 /*!
     Multiple producers / single consumer wait-free ring buffer use only atomic operations to provide thread-safe
     enqueue and dequeue operations. This data structure consist of several SPSC ring buffers which count is
-    provided as a hardware concurrency in the constructor. All of them are randomly accessed with a RDTS
-    distribution index. All the items available in sesequential or batch mode. All ring buffer sizes are
-    limited to the capacity provided in the constructor.
+    provided as a hardware concurrency in the constructor. Each producer thread is registered to its own
+    dedicated SPSC ring buffer on the first enqueue, so next enqueue operations are wait-free. If there are
+    more producer threads than the hardware concurrency, extra threads share one fallback ring buffer
+    protected by the spin-lock. Producer thread on the contended fallback ring buffer moves to the dedicated
+    ring buffer released by the exited thread once its previous items are consumed. The consumer scans all ring buffers in round-robin order. All ring buffer
+    sizes are limited to the capacity provided in the constructor.
 
-    FIFO order is not guaranteed!
+    Zero-copy API allows producers to write data directly into their ring buffers using
+    Reserve()/Commit() methods and the consumer to read data directly from ring buffers
+    using Peek()/Release() methods.
+
+    FIFO order is guaranteed only for data of the same producer thread!
 
     Thread-safe.
 */
@@ -85,19 +89,53 @@ public:
     */
     bool Dequeue(void* data, size_t& size);
 
-private:
-    struct Producer
-    {
-        SpinLock lock;
-        SPSCRingBuffer buffer;
+    //! Reserve a contiguous memory in the ring buffer to write a data (multiple producers threads method)
+    /*!
+        Reserved memory should be filled with the data and committed using Commit() method
+        from the same thread. Each successful reservation must be committed (probably with
+        zero size), because the shared ring buffer remains locked until the commit.
+
+        Will not block, but could spin on the shared ring buffer lock.
+
+        \param size - Reservation size
+        \return Pointer to the reserved memory or nullptr if the ring buffer is full
+    */
+    void* Reserve(size_t size);
+
+    //! Commit the data written into the reserved memory (multiple producers threads method)
+    /*!
+        Will not block.
+
+        \param size - Committed data size (should not be greater than the reservation size)
+    */
+    void Commit(size_t size);
 
-        Producer(size_t capacity) : buffer(capacity) {}
-    };
+    //! Peek a contiguous data from one of producers' ring buffers (single consumer thread method)
+    /*!
+        The data remains in the ring buffer until it is released using Release() method.
+        Producers' ring buffers are scanned in round-robin order.
+
+        Will not block.
 
+        \param size - Available data size
+        \return Pointer to the available data or nullptr if all ring buffers are empty
+    */
+    const void* Peek(size_t& size);
+
+    //! Release the data read from the last peeked ring buffer (single consumer thread method)
+    /*!
+        Will not block.
+
+        \param size - Released data size (should not be greater than the peeked data size)
+    */
+    void Release(size_t size);
+
+private:
     size_t _capacity;
     size_t _concurrency;
-    std::vector<std::shared_ptr<Producer>> _producers;
+    Internals::ProducerLanes<SPSCRingBuffer> _producers;
     size_t _consumer;
+    size_t _peeked;
 };
 
 /*! \example threads_mpsc_ring_buffer.cpp Multiple producers / single consumer wait-free ring buffer example */
@@ -8,40 +8,50 @@
 
 namespace CppCommon {
 
-inline MPSCRingBuffer::MPSCRingBuffer(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _consumer(0)
+inline MPSCRingBuffer::MPSCRingBuffer(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _producers(capacity, concurrency), _consumer(0), _peeked(0)
 {
-    // Initialize producers' ring buffer
-    for (size_t i = 0; i < concurrency; ++i)
-        _producers.push_back(std::make_shared<Producer>(capacity));
 }
 
 inline size_t MPSCRingBuffer::size() const noexcept
 {
     size_t size = 0;
-    for (const auto& producer : _producers)
-        size += producer->buffer.size();
+    for (size_t i = 0; i < _producers.size(); ++i)
+        size += _producers[i].data.size();
     return size;
 }
 
 inline bool MPSCRingBuffer::Enqueue(const void* data, size_t size)
 {
-    // Get producer index for the current thread based on RDTS value
-    size_t index = Timestamp::rdts() % _concurrency;
+    // Get the producer registered for the current thread
+    auto& producer = _producers.Current();
 
-    // Lock the chosen producer using its spin-lock
-    Locker<SpinLock> lock(_producers[index]->lock);
+    // Enqueue the data into the dedicated producer's ring buffer
+    if (!producer.shared)
+        return producer.data.Enqueue(data, size);
 
-    // Enqueue the item into the producer's ring buffer
-    return _producers[index]->buffer.Enqueue(data, size);
+    // Retry to acquire the dedicated producer if the shared one is contended
+    if (producer.lock.IsLocked())
+    {
+        auto& dedicated = _producers.Promote();
+        if (!dedicated.shared)
+            return dedicated.data.Enqueue(data, size);
+    }
+
+    // Lock the shared producer using its spin-lock
+    Locker<SpinLock> lock(producer.lock);
+
+    // Enqueue the data into the shared producer's ring buffer
+    return producer.data.Enqueue(data, size);
 }
 
 inline bool MPSCRingBuffer::Dequeue(void* data, size_t& size)
 {
-    // Try to dequeue one item from the one of producer's ring buffers
-    for (size_t i = 0; i < _concurrency; ++i)
+    // Try to dequeue one item from the one of producer's ring buffers in round-robin order
+    const size_t count = _producers.size();
+    for (size_t i = 0; i < count; ++i)
     {
         size_t temp = size;
-        if (_producers[_consumer++ % _concurrency]->buffer.Dequeue(data, temp))
+        if (_producers[_consumer++ % count].data.Dequeue(data, temp))
         {
             size = temp;
             return true;
@@ -52,4 +62,67 @@ inline bool MPSCRingBuffer::Dequeue(void* data, size_t& size)
     return false;
 }
 
+inline void* MPSCRingBuffer::Reserve(size_t size)
+{
+    // Get the producer registered for the current thread
+    auto& producer = _producers.Current();
+
+    // Reserve the memory in the dedicated producer's ring buffer
+    if (!producer.shared)
+        return producer.data.Reserve(size);
+
+    // Retry to acquire the dedicated producer if the shared one is contended
+    if (producer.lock.IsLocked())
+    {
+        auto& dedicated = _producers.Promote();
+        if (!dedicated.shared)
+            return dedicated.data.Reserve(size);
+    }
+
+    // Lock the shared producer until the commit
+    producer.lock.Lock();
+
+    void* result = producer.data.Reserve(size);
+    if (result == nullptr)
+        producer.lock.Unlock();
+
+    return result;
+}
+
+inline void MPSCRingBuffer::Commit(size_t size)
+{
+    // Get the producer registered for the current thread
+    auto& producer = _producers.Current();
+
+    producer.data.Commit(size);
+
+    // Unlock the shared producer locked by the reservation
+    if (producer.shared)
+        producer.lock.Unlock();
+}
+
+inline const void* MPSCRingBuffer::Peek(size_t& size)
+{
+    // Try to peek the data from the one of producer's ring buffers in round-robin order
+    const size_t count = _producers.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t index = _consumer++ % count;
+        const void* result = _producers[index].data.Peek(size);
+        if (result != nullptr)
+        {
+            _peeked = index;
+            return result;
+        }
+    }
+
+    size = 0;
+    return nullptr;
+}
+
+inline void MPSCRingBuffer::Release(size_t size)
+{
+    _producers[_peeked].data.Release(size);
+}
+
 } // namespace CppCommon
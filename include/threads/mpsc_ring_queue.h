@@ -9,14 +9,12 @@
 #ifndef CPPCOMMON_THREADS_MPSC_RING_QUEUE_H
 #define CPPCOMMON_THREADS_MPSC_RING_QUEUE_H
 
-#include "threads/spin_lock.h"
+#include "threads/producer_lanes.h"
 #include "threads/spsc_ring_queue.h"
-#include "time/timestamp.h"
 
 #include <cassert>
 #include <cstdio>
 #include <functional>
-#include <memory>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -27,11 +25,15 @@ namespace CppCommon {
 /*!
     Multiple producers / single consumer wait-free ring queue use only atomic operations to provide thread-safe
     enqueue and dequeue operations. This data structure consist of several SPSC ring queues which count is
-    provided as a hardware concurrency in the constructor. All of them are randomly accessed with a RDTS
-    distribution index. All the items available in sesequential or batch mode. All ring queue sizes are
-    limited to the capacity provided in the constructor.
+    provided as a hardware concurrency in the constructor. Each producer thread is registered to its own
+    dedicated SPSC ring queue on the first enqueue, so next enqueue operations are wait-free. If there are
+    more producer threads than the hardware concurrency, extra threads share one fallback ring queue
+    protected by the spin-lock. Producer thread on the contended fallback ring queue moves to the dedicated
+    ring queue released by the exited thread once its previous items are consumed. The consumer scans all ring queues in round-robin order. All the items
+    available in sesequential or batch mode. All ring queue sizes are limited to the capacity provided
+    in the constructor.
 
-    FIFO order is not guaranteed!
+    FIFO order is guaranteed only for items of the same producer thread!
 
     Thread-safe.
 */
@@ -98,7 +100,9 @@ public:
 
     //! Dequeue all items from the linked queue (single consumer thread method)
     /*!
-        All items in the batcher will be processed by the given handler.
+        All items in the batcher will be processed by the given handler. Each ring queue
+        is drained only up to its size at the moment of scan, so busy producers could not
+        starve the others.
 
         Will not block.
 
@@ -108,17 +112,9 @@ public:
     bool Dequeue(const std::function<void(const T&)>& handler = [](const int&){});
 
 private:
-    struct Producer
-    {
-        SpinLock lock;
-        SPSCRingQueue<T> queue;
-
-        Producer(size_t capacity) : queue(capacity) {}
-    };
-
     size_t _capacity;
     size_t _concurrency;
-    std::vector<std::shared_ptr<Producer>> _producers;
+    Internals::ProducerLanes<SPSCRingQueue<T>> _producers;
     size_t _consumer;
 };
 
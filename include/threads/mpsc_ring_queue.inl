@@ -9,19 +9,16 @@
 namespace CppCommon {
 
 template<typename T>
-inline MPSCRingQueue<T>::MPSCRingQueue(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _consumer(0)
+inline MPSCRingQueue<T>::MPSCRingQueue(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _producers(capacity, concurrency), _consumer(0)
 {
-    // Initialize producers' ring queue
-    for (size_t i = 0; i < concurrency; ++i)
-        _producers.push_back(std::make_shared<Producer>(capacity));
 }
 
 template<typename T>
 inline size_t MPSCRingQueue<T>::size() const noexcept
 {
     size_t size = 0;
-    for (const auto& producer : _producers)
-        size += producer->queue.size();
+    for (size_t i = 0; i < _producers.size(); ++i)
+        size += _producers[i].data.size();
     return size;
 }
 
@@ -35,23 +32,37 @@ inline bool MPSCRingQueue<T>::Enqueue(const T& item)
 template<typename T>
 inline bool MPSCRingQueue<T>::Enqueue(T&& item)
 {
-    // Get producer index for the current thread based on RDTS value
-    size_t index = Timestamp::rdts() % _concurrency;
+    // Get the producer registered for the current thread
+    auto& producer = _producers.Current();
 
-    // Lock the chosen producer using its spin-lock
-    Locker<SpinLock> lock(_producers[index]->lock);
+    // Enqueue the item into the dedicated producer's ring queue
+    if (!producer.shared)
+        return producer.data.Enqueue(std::forward<T>(item));
 
-    // Enqueue the item into the producer's ring queue
-    return _producers[index]->queue.Enqueue(std::forward<T>(item));
+    // Retry to acquire the dedicated producer if the shared one is contended
+    if (producer.lock.IsLocked())
+    {
+        auto& dedicated = _producers.Promote();
+        if (!dedicated.shared)
+            return dedicated.data.Enqueue(std::forward<T>(item));
+    }
+
+    // Lock the shared producer using its spin-lock
+    Locker<SpinLock> lock(producer.lock);
+
+    // Enqueue the item into the shared producer's ring queue
+    return producer.data.Enqueue(std::forward<T>(item));
 }
 
 template<typename T>
 inline bool MPSCRingQueue<T>::Dequeue(T& item)
 {
-    // Try to dequeue one item from the one of producer's ring queue
-    for (size_t i = 0; i < _concurrency; ++i)
+    // Try to dequeue one item from the one of producer's ring queue in round-robin order
+    const size_t count = _producers.size();
+    for (size_t i = 0; i < count; ++i)
     {
-        if (_producers[_consumer++ % _concurrency]->queue.Dequeue(item))
+        size_t index = _consumer++ % count;
+        if (_producers[index].data.Dequeue(item))
             return true;
     }
 
@@ -65,11 +76,16 @@ inline bool MPSCRingQueue<T>::Dequeue(const std::function<void(const T&)>& handl
 
     bool result = false;
 
-    // Consume all available items from producers' ring queues
-    for (auto& producer : _producers)
+    // Consume items available at the moment of scan from producers' ring queues
+    const size_t count = _producers.size();
+    const size_t start = _consumer++ % count;
+    for (size_t i = 0; i < count; ++i)
     {
+        auto& producer = _producers[(start + i) % count];
+
         T item;
-        while (producer->queue.Dequeue(item))
+        size_t available = producer.data.size();
+        while ((available-- > 0) && producer.data.Dequeue(item))
         {
             handler(item);
             result = true;
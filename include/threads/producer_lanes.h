@@ -0,0 +1,117 @@
+/*!
+    \file producer_lanes.h
+    \brief Per-thread producer lanes definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_PRODUCER_LANES_H
+#define CPPCOMMON_THREADS_PRODUCER_LANES_H
+
+#include "threads/spin_lock.h"
+#include "threads/thread_registry.h"
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Per-thread producer lanes
+/*!
+    Producer lanes are used by multiple producers / single consumer containers
+    to give each producer thread its own dedicated single producer lane. The
+    lane is registered on the first access from the thread and remembered in
+    the thread-local token, so next accesses are wait-free. The lane is
+    released for other threads when its owner thread exits.
+
+    When all dedicated lanes are taken, producer threads share the fallback
+    lane protected by the spin-lock. Producer thread on the shared lane could
+    be promoted to the dedicated lane released by the exited thread (usually
+    when the shared lane is contended).
+
+    Thread-safe.
+*/
+template <class TLane>
+class ProducerLanes
+{
+public:
+    //! Producer lane
+    struct Lane
+    {
+        const bool shared;
+        std::atomic<bool> owned;
+        SpinLock lock;
+        TLane data;
+
+        Lane(size_t capacity, bool is_shared) : shared(is_shared), owned(false), data(capacity) {}
+
+        //! Release the lane for other threads
+        void Release() noexcept { owned.store(false, std::memory_order_release); }
+    };
+
+    //! Initialize producer lanes
+    /*!
+        \param capacity - Lane capacity
+        \param concurrency - Count of dedicated lanes
+    */
+    ProducerLanes(size_t capacity, size_t concurrency);
+    ProducerLanes(const ProducerLanes&) = delete;
+    ProducerLanes(ProducerLanes&&) = delete;
+    ~ProducerLanes() = default;
+
+    ProducerLanes& operator=(const ProducerLanes&) = delete;
+    ProducerLanes& operator=(ProducerLanes&&) = delete;
+
+    //! Get the count of all lanes (dedicated lanes and the shared lane)
+    size_t size() const noexcept { return _lanes.size(); }
+
+    //! Get the lane by the given index
+    Lane& operator[](size_t index) noexcept { return *_lanes[index]; }
+    const Lane& operator[](size_t index) const noexcept { return *_lanes[index]; }
+
+    //! Get the producer lane of the current thread
+    /*!
+        Registers the dedicated lane on the first call from the current thread.
+        Returns the shared lane if all dedicated lanes are taken.
+
+        \return Producer lane of the current thread
+    */
+    Lane& Current();
+
+    //! Try to promote the current thread from the shared lane to the dedicated lane
+    /*!
+        Dedicated lane is acquired only if the shared lane is empty, so all
+        previous items of the current thread are already consumed and FIFO
+        order of its items is preserved.
+
+        \return Dedicated producer lane or the shared lane if it is not empty or all dedicated lanes are still taken
+    */
+    Lane& Promote();
+
+private:
+    ThreadRegistry<Lane> _registry;
+    std::vector<std::shared_ptr<Lane>> _lanes;
+
+    //! Register the producer lane for the current thread
+    Lane& Register();
+    //! Try to own one of dedicated lanes
+    /*!
+        \return Owned dedicated lane or nullptr if all dedicated lanes are taken
+    */
+    std::shared_ptr<Lane> Acquire();
+};
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
+
+#include "producer_lanes.inl"
+
+#endif // CPPCOMMON_THREADS_PRODUCER_LANES_H
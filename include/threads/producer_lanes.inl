@@ -0,0 +1,73 @@
+/*!
+    \file producer_lanes.inl
+    \brief Per-thread producer lanes inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <class TLane>
+inline ProducerLanes<TLane>::ProducerLanes(size_t capacity, size_t concurrency)
+{
+    // Initialize dedicated lanes and the shared lane
+    for (size_t i = 0; i < concurrency; ++i)
+        _lanes.push_back(std::make_shared<Lane>(capacity, false));
+    _lanes.push_back(std::make_shared<Lane>(capacity, true));
+}
+
+template <class TLane>
+inline typename ProducerLanes<TLane>::Lane& ProducerLanes<TLane>::Current()
+{
+    Lane* lane = _registry.Find();
+    return (lane != nullptr) ? *lane : Register();
+}
+
+template <class TLane>
+inline typename ProducerLanes<TLane>::Lane& ProducerLanes<TLane>::Register()
+{
+    // Try to own one of dedicated lanes, otherwise use the shared lane
+    std::shared_ptr<Lane> lane = Acquire();
+    if (!lane)
+        lane = _lanes.back();
+
+    _registry.Register(lane);
+    return *lane;
+}
+
+template <class TLane>
+inline typename ProducerLanes<TLane>::Lane& ProducerLanes<TLane>::Promote()
+{
+    Lane& current = Current();
+    if (!current.shared || !current.data.empty())
+        return current;
+
+    std::shared_ptr<Lane> lane = Acquire();
+    if (!lane)
+        return current;
+
+    _registry.Replace(lane);
+    return *lane;
+}
+
+template <class TLane>
+inline std::shared_ptr<typename ProducerLanes<TLane>::Lane> ProducerLanes<TLane>::Acquire()
+{
+    for (size_t i = 0; i < (_lanes.size() - 1); ++i)
+    {
+        bool owned = false;
+        if (!_lanes[i]->owned.load(std::memory_order_relaxed) && _lanes[i]->owned.compare_exchange_strong(owned, true, std::memory_order_acquire, std::memory_order_relaxed))
+            return _lanes[i];
+    }
+
+    return nullptr;
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
@@ -0,0 +1,138 @@
+/*!
+    \file rcu_pointer.h
+    \brief RCU protected pointer definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_RCU_POINTER_H
+#define CPPCOMMON_THREADS_RCU_POINTER_H
+
+#include "threads/epoch_manager.h"
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <mutex>
+
+namespace CppCommon {
+
+//! RCU protected pointer
+/*!
+    RCU (read-copy-update) protected pointer is designed for read-mostly
+    shared data such as configuration tables. Readers access the current value
+    inside the epoch-based read-side critical section without any locks or
+    shared writes. Writers publish a new copy of the value and retire the old
+    one, which is freed by the epoch manager once all readers that might still
+    access it have left their critical sections.
+
+    Readers must not keep references to the value after the reader guard
+    is destroyed.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Read-copy-update
+*/
+template <typename T>
+class RCUPointer
+{
+public:
+    //! Reader guard
+    /*!
+        Reader guard keeps the read-side critical section and provides access
+        to the value which was current at the moment of the guard creation.
+
+        Not thread-safe.
+    */
+    class Reader
+    {
+    public:
+        //! Enter read-side critical section and load the current value
+        /*!
+            \param pointer - RCU protected pointer
+        */
+        explicit Reader(const RCUPointer& pointer) : _guard(pointer._manager), _value(pointer._value.load(std::memory_order_acquire)) {}
+        Reader(const Reader&) = delete;
+        Reader(Reader&&) = delete;
+        ~Reader() = default;
+
+        Reader& operator=(const Reader&) = delete;
+        Reader& operator=(Reader&&) = delete;
+
+        //! Check if the value is not null
+        explicit operator bool() const noexcept { return _value != nullptr; }
+
+        //! Get the value
+        const T& operator*() const noexcept { return *_value; }
+        const T* operator->() const noexcept { return _value; }
+
+        //! Get the value pointer
+        const T* get() const noexcept { return _value; }
+
+    private:
+        EpochManager::Guard _guard;
+        const T* _value;
+    };
+
+    //! Initialize RCU protected pointer with the given value
+    /*!
+        \param manager - Epoch manager
+        \param value - Initial value (default is nullptr)
+    */
+    explicit RCUPointer(EpochManager& manager, std::unique_ptr<T> value = nullptr) : _manager(manager), _value(value.release()) {}
+    RCUPointer(const RCUPointer&) = delete;
+    RCUPointer(RCUPointer&&) = delete;
+    ~RCUPointer();
+
+    RCUPointer& operator=(const RCUPointer&) = delete;
+    RCUPointer& operator=(RCUPointer&&) = delete;
+
+    //! Get the epoch manager
+    EpochManager& manager() noexcept { return _manager; }
+
+    //! Read the current value
+    /*!
+        Will not block.
+
+        \return Reader guard of the current value
+    */
+    Reader Read() const { return Reader(*this); }
+
+    //! Update the value
+    /*!
+        Publishes the new value and retires the old one.
+
+        \param value - New value
+    */
+    void Update(std::unique_ptr<T> value);
+
+    //! Modify the copy of the current value and publish it
+    /*!
+        Writers are serialized, so concurrent modifications are not lost.
+        The current value must not be null.
+
+        \param modifier - Modifier function which is called with the reference to the value copy
+    */
+    template <class TModifier>
+    void Modify(TModifier modifier);
+
+    //! Wait for all readers of retired values and free them
+    /*!
+        Will block until all readers leave their current critical sections.
+    */
+    void Synchronize() { _manager.Synchronize(); }
+
+private:
+    EpochManager& _manager;
+    std::atomic<T*> _value;
+    std::mutex _mutex;
+};
+
+/*! \example threads_rcu_pointer.cpp RCU protected pointer example */
+
+} // namespace CppCommon
+
+#include "rcu_pointer.inl"
+
+#endif // CPPCOMMON_THREADS_RCU_POINTER_H
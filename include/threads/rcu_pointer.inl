@@ -0,0 +1,44 @@
+/*!
+    \file rcu_pointer.inl
+    \brief RCU protected pointer inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline RCUPointer<T>::~RCUPointer()
+{
+    // No reader must be active at this point
+    delete _value.load(std::memory_order_acquire);
+}
+
+template <typename T>
+inline void RCUPointer<T>::Update(std::unique_ptr<T> value)
+{
+    std::scoped_lock locker(_mutex);
+
+    T* old = _value.exchange(value.release(), std::memory_order_acq_rel);
+    _manager.Retire(old);
+}
+
+template <typename T>
+template <class TModifier>
+inline void RCUPointer<T>::Modify(TModifier modifier)
+{
+    std::scoped_lock locker(_mutex);
+
+    T* current = _value.load(std::memory_order_acquire);
+    assert((current != nullptr) && "Cannot modify the null value!");
+
+    // Read the current value, copy and update it
+    auto value = std::make_unique<T>(*current);
+    modifier(*value);
+
+    T* old = _value.exchange(value.release(), std::memory_order_acq_rel);
+    _manager.Retire(old);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,178 @@
+/*!
+    \file scalable_rw_lock.h
+    \brief Scalable reader-biased read/write lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SCALABLE_RW_LOCK_H
+#define CPPCOMMON_THREADS_SCALABLE_RW_LOCK_H
+
+#include "threads/futex.h"
+#include "threads/futex_critical_section.h"
+#include "threads/locker.h"
+#include "threads/thread.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace CppCommon {
+
+//! Scalable reader-biased read/write lock synchronization primitive
+/*!
+    Scalable read/write lock is biased towards readers. Each reader thread
+    is assigned to one of the cache line sized reader slots and acquires the
+    read lock by incrementing only its own slot counter, so concurrent readers
+    do not bounce a shared cache line between CPU cores. Writer revokes the
+    reader bias by raising the writer flag, which turns new readers away, and
+    then waits for all reader slots to drain. Readers turned away by the
+    writer are parked on the futex until the write lock is released.
+
+    Read lock is cheap and scales with the count of CPU cores, write lock is
+    expensive and proportional to the count of reader slots. Use it for data
+    which is read very often and modified rarely.
+
+    Read lock is not recursive and cannot be upgraded to the write lock.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Readers%E2%80%93writer_lock
+*/
+class ScalableRWLock
+{
+public:
+    //! Default class constructor
+    /*!
+        \param slots - Count of reader slots, must be a power of two (default is 0 to use the count of CPU cores)
+    */
+    explicit ScalableRWLock(size_t slots = 0);
+    ScalableRWLock(const ScalableRWLock&) = delete;
+    ScalableRWLock(ScalableRWLock&&) = delete;
+    ~ScalableRWLock() = default;
+
+    ScalableRWLock& operator=(const ScalableRWLock&) = delete;
+    ScalableRWLock& operator=(ScalableRWLock&&) = delete;
+
+    //! Get the count of reader slots
+    size_t slots() const noexcept { return _slots.size(); }
+
+    //! Try to acquire read lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockRead() noexcept;
+    //! Try to acquire write lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWrite() noexcept;
+
+    //! Try to acquire read lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadFor(const Timespan& timespan) noexcept;
+    //! Try to acquire write lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteFor(const Timespan& timespan) noexcept;
+    //! Try to acquire read lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockReadFor(timestamp - UtcTimestamp()); }
+    //! Try to acquire write lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockWriteFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire read lock with block
+    /*!
+        Will block.
+    */
+    void LockRead() noexcept;
+    //! Acquire write lock with block
+    /*!
+        Will block.
+    */
+    void LockWrite() noexcept;
+
+    //! Release read lock
+    /*!
+        Will not block.
+    */
+    void UnlockRead() noexcept;
+    //! Release write lock
+    /*!
+        Will not block.
+    */
+    void UnlockWrite() noexcept;
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Reader slot occupies the whole cache line
+    struct Slot
+    {
+        std::atomic<uint32_t> readers;
+        cache_line_pad pad;
+
+        Slot() noexcept : readers(0) {}
+    };
+
+    enum : uint32_t { Unlocked = 0, Locked = 1, Contended = 2 };
+
+    cache_line_pad _pad0;
+    std::atomic<uint32_t> _writer;
+    cache_line_pad _pad1;
+    FutexCriticalSection _writers;
+    std::vector<Slot> _slots;
+    size_t _mask;
+
+    //! Get the reader slot of the current thread
+    Slot& Current() noexcept;
+    //! Try to enter the reader slot if there is no active writer
+    bool TryEnter(Slot& slot) noexcept;
+    //! Wait for the active writer to release the write lock
+    bool WaitWriter(uint64_t deadline) noexcept;
+    //! Revoke the reader bias and wait for all reader slots to drain
+    bool Revoke(uint64_t deadline) noexcept;
+    //! Restore the reader bias and wake up parked readers
+    void Restore() noexcept;
+};
+
+/*! \example threads_scalable_rw_lock.cpp Scalable reader-biased read/write lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "scalable_rw_lock.inl"
+
+#endif // CPPCOMMON_THREADS_SCALABLE_RW_LOCK_H
@@ -0,0 +1,191 @@
+/*!
+    \file scalable_rw_lock.inl
+    \brief Scalable reader-biased read/write lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline ScalableRWLock::ScalableRWLock(size_t slots) : _writer(Unlocked)
+{
+    // Use the count of CPU cores rounded up to the power of two by default
+    if (slots == 0)
+    {
+        slots = 1;
+        while (slots < std::max<size_t>(std::thread::hardware_concurrency(), 1))
+            slots <<= 1;
+    }
+
+    assert((slots > 0) && ((slots & (slots - 1)) == 0) && "Count of reader slots must be a power of two!");
+
+    _slots = std::vector<Slot>(slots);
+    _mask = slots - 1;
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    for (auto& slot : _slots)
+        memset(slot.pad, 0, sizeof(cache_line_pad));
+}
+
+inline ScalableRWLock::Slot& ScalableRWLock::Current() noexcept
+{
+    // Spread reader threads over slots in round-robin order
+    static std::atomic<uint32_t> counter(0);
+    static thread_local uint32_t index = counter.fetch_add(1, std::memory_order_relaxed);
+    return _slots[index & _mask];
+}
+
+inline bool ScalableRWLock::TryEnter(Slot& slot) noexcept
+{
+    // Sequentially consistent operations pair with Revoke() so that either
+    // the reader sees the writer flag or the writer sees the reader slot
+    slot.readers.fetch_add(1, std::memory_order_seq_cst);
+    if (_writer.load(std::memory_order_seq_cst) == Unlocked)
+        return true;
+
+    slot.readers.fetch_sub(1, std::memory_order_release);
+    return false;
+}
+
+inline bool ScalableRWLock::WaitWriter(uint64_t deadline) noexcept
+{
+    const uint32_t limit = Futex::SpinCount();
+    for (uint32_t i = 0; i < limit; ++i)
+    {
+        if (_writer.load(std::memory_order_relaxed) == Unlocked)
+            return true;
+        BackoffWait::Pause();
+    }
+
+    uint32_t state = _writer.load(std::memory_order_relaxed);
+    while (state != Unlocked)
+    {
+        // Mark the writer as contended, so it will wake us up
+        if ((state == Locked) && !_writer.compare_exchange_weak(state, Contended, std::memory_order_relaxed, std::memory_order_relaxed))
+            continue;
+
+        if (deadline == 0)
+            Futex::Wait(_writer, Contended);
+        else
+        {
+            const uint64_t current = Timestamp::nano();
+            if (current >= deadline)
+                return false;
+            Futex::WaitFor(_writer, Contended, Timespan((int64_t)(deadline - current)));
+        }
+
+        state = _writer.load(std::memory_order_relaxed);
+    }
+    return true;
+}
+
+inline bool ScalableRWLock::Revoke(uint64_t deadline) noexcept
+{
+    // Turn new readers away
+    _writer.store(Locked, std::memory_order_seq_cst);
+
+    // Wait for active readers to leave their slots
+    const uint32_t limit = Futex::SpinCount();
+    for (auto& slot : _slots)
+    {
+        uint32_t attempts = 0;
+        while (slot.readers.load(std::memory_order_seq_cst) != 0)
+        {
+            if ((deadline != 0) && (Timestamp::nano() >= deadline))
+            {
+                Restore();
+                return false;
+            }
+
+            if (attempts++ < limit)
+                BackoffWait::Pause();
+            else
+                Thread::Yield();
+        }
+    }
+    return true;
+}
+
+inline void ScalableRWLock::Restore() noexcept
+{
+    if (_writer.exchange(Unlocked, std::memory_order_release) == Contended)
+        Futex::WakeAll(_writer);
+}
+
+inline bool ScalableRWLock::TryLockRead() noexcept
+{
+    return TryEnter(Current());
+}
+
+inline bool ScalableRWLock::TryLockWrite() noexcept
+{
+    if (!_writers.TryLock())
+        return false;
+
+    _writer.store(Locked, std::memory_order_seq_cst);
+    for (auto& slot : _slots)
+    {
+        if (slot.readers.load(std::memory_order_seq_cst) != 0)
+        {
+            Restore();
+            _writers.Unlock();
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool ScalableRWLock::TryLockReadFor(const Timespan& timespan) noexcept
+{
+    Slot& slot = Current();
+    if (TryEnter(slot))
+        return true;
+
+    const uint64_t deadline = Timestamp::nano() + std::max<int64_t>(timespan.nanoseconds(), 1);
+    while (WaitWriter(deadline))
+        if (TryEnter(slot))
+            return true;
+    return false;
+}
+
+inline bool ScalableRWLock::TryLockWriteFor(const Timespan& timespan) noexcept
+{
+    const uint64_t deadline = Timestamp::nano() + std::max<int64_t>(timespan.nanoseconds(), 1);
+    if (!_writers.TryLockFor(timespan))
+        return false;
+
+    if (!Revoke(deadline))
+    {
+        _writers.Unlock();
+        return false;
+    }
+    return true;
+}
+
+inline void ScalableRWLock::LockRead() noexcept
+{
+    Slot& slot = Current();
+    while (!TryEnter(slot))
+        WaitWriter(0);
+}
+
+inline void ScalableRWLock::LockWrite() noexcept
+{
+    _writers.Lock();
+    Revoke(0);
+}
+
+inline void ScalableRWLock::UnlockRead() noexcept
+{
+    Current().readers.fetch_sub(1, std::memory_order_release);
+}
+
+inline void ScalableRWLock::UnlockWrite() noexcept
+{
+    Restore();
+    _writers.Unlock();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,225 @@
+/*!
+    \file spmc_multicast_ring.h
+    \brief Single producer / multiple consumers wait-free multicast ring definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SPMC_MULTICAST_RING_H
+#define CPPCOMMON_THREADS_SPMC_MULTICAST_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Single producer / multiple consumers wait-free multicast ring
+/*!
+    Single producer / multiple consumers wait-free multicast ring is a
+    sequenced ring in the style of the LMAX Disruptor. Every registered
+    consumer sees every item, so the item is written into the ring only once
+    regardless of the count of consumers. Each consumer tracks its own
+    sequence and the producer never overwrites an item which is not yet
+    consumed by all consumers.
+
+    Consumer could depend on other consumers. Dependent consumer waits until
+    all its dependencies have processed the item, so consumers form a
+    pipeline of stages (stage B sees the item only after stage A). Items are
+    claimed and consumed in batches with a single sequence update per batch.
+
+    Consumers must be registered before the producer starts. Each consumer
+    must be used from a single thread.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    https://lmax-exchange.github.io/disruptor
+*/
+template<typename T>
+class SPMCMulticastRing
+{
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Ring capacity (must be a power of two)
+    */
+    explicit SPMCMulticastRing(size_t capacity);
+    SPMCMulticastRing(const SPMCMulticastRing&) = delete;
+    SPMCMulticastRing(SPMCMulticastRing&&) = delete;
+    ~SPMCMulticastRing() { delete[] _buffer; }
+
+    SPMCMulticastRing& operator=(const SPMCMulticastRing&) = delete;
+    SPMCMulticastRing& operator=(SPMCMulticastRing&&) = delete;
+
+    //! Get ring capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the count of registered consumers
+    size_t consumers() const noexcept { return _consumers.size(); }
+    //! Get the count of published items
+    size_t cursor() const noexcept { return _cursor.load(std::memory_order_acquire); }
+
+    //! Is ring empty for the given consumer?
+    bool empty(size_t consumer) const noexcept { return (size(consumer) == 0); }
+    //! Get the count of items which are published, but not consumed by the given consumer
+    size_t size(size_t consumer) const noexcept;
+
+    //! Register a new consumer
+    /*!
+        New consumer starts from the current cursor of the ring.
+
+        Not thread-safe and must be called before the producer starts.
+
+        \param dependencies - Consumers which must process each item before the new consumer (default is none)
+        \return Consumer index
+    */
+    size_t AddConsumer(std::initializer_list<size_t> dependencies = {});
+
+    //! Enqueue an item into the ring (single producer thread method)
+    /*!
+        The item will be copied into the ring.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the ring is full
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the ring (single producer thread method)
+    /*!
+        The item will be moved into the ring.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the ring is full
+    */
+    bool Enqueue(T&& item);
+    //! Enqueue items from the given range into the ring (single producer thread method)
+    /*!
+        Claims all free slots for the batch and publishes them with a single update.
+
+        Will not block.
+
+        \param first - Input iterator to the first item to enqueue
+        \param last - Input iterator past the last item to enqueue
+        \return Count of successfully enqueued items
+    */
+    template<class InputIterator>
+    size_t EnqueueBulk(InputIterator first, InputIterator last);
+
+    //! Reserve contiguous slots in the ring (single producer thread method)
+    /*!
+        Reserved slots must be filled and published with Commit() method.
+        The count of reserved slots might be less than requested if the ring
+        is almost full or the reservation reaches the end of the ring.
+
+        Will not block.
+
+        \param count - Count of slots to reserve (will be updated with the reserved count)
+        \return Pointer to the first reserved slot or nullptr if the ring is full
+    */
+    T* Reserve(size_t& count);
+    //! Publish the given count of previously reserved slots (single producer thread method)
+    /*!
+        Will not block.
+
+        \param count - Count of slots to publish
+    */
+    void Commit(size_t count);
+
+    //! Dequeue an item from the ring (consumer thread method)
+    /*!
+        The item will be copied from the ring, because other consumers might still access it.
+
+        Will not block.
+
+        \param consumer - Consumer index
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the ring is empty for the consumer
+    */
+    bool Dequeue(size_t consumer, T& item);
+    //! Dequeue items from the ring into the given output (consumer thread method)
+    /*!
+        Will not block.
+
+        \param consumer - Consumer index
+        \param output - Output iterator to store dequeued items
+        \param max - Maximal count of items to dequeue
+        \return Count of successfully dequeued items
+    */
+    template<class OutputIterator>
+    size_t DequeueBulk(size_t consumer, OutputIterator output, size_t max);
+
+    //! Consume all available items in place with the given handler (consumer thread method)
+    /*!
+        Handler is called for each available item with the reference to it:
+        'void handler(T& item)'. The whole batch is released with a single
+        sequence update after the last item is handled. Handler could modify
+        the item only if every other consumer depends on this one directly
+        or transitively, otherwise concurrent readers of the item make it
+        a data race.
+
+        Will not block.
+
+        \param consumer - Consumer index
+        \param handler - Item handler
+        \param max - Maximal count of items to consume (default is unlimited)
+        \return Count of consumed items
+    */
+    template<class THandler>
+    size_t Consume(size_t consumer, THandler handler, size_t max = std::numeric_limits<size_t>::max());
+
+private:
+    typedef char cache_line_pad[128];
+
+    // Consumer state
+    struct Consumer
+    {
+        cache_line_pad pad0;
+        std::atomic<size_t> sequence;
+        cache_line_pad pad1;
+        size_t available;
+        std::vector<const std::atomic<size_t>*> barriers;
+        cache_line_pad pad2;
+
+        explicit Consumer(size_t start);
+    };
+
+    cache_line_pad _pad0;
+    const size_t _capacity;
+    const size_t _mask;
+    T* const _buffer;
+    std::vector<std::unique_ptr<Consumer>> _consumers;
+
+    cache_line_pad _pad1;
+    std::atomic<size_t> _cursor;
+    cache_line_pad _pad2;
+    size_t _claimed;
+    size_t _reserved;
+    size_t _gate;
+    cache_line_pad _pad3;
+
+    //! Get the count of free slots for the producer
+    size_t Free(size_t count);
+    //! Get the count of available items for the consumer
+    size_t Available(Consumer& consumer, size_t count);
+};
+
+/*! \example threads_spmc_multicast_ring.cpp Single producer / multiple consumers wait-free multicast ring example */
+
+} // namespace CppCommon
+
+#include "spmc_multicast_ring.inl"
+
+#endif // CPPCOMMON_THREADS_SPMC_MULTICAST_RING_H
@@ -0,0 +1,209 @@
+/*!
+    \file spmc_multicast_ring.inl
+    \brief Single producer / multiple consumers wait-free multicast ring inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline SPMCMulticastRing<T>::Consumer::Consumer(size_t start) : sequence(start), available(start)
+{
+    memset(pad0, 0, sizeof(cache_line_pad));
+    memset(pad1, 0, sizeof(cache_line_pad));
+    memset(pad2, 0, sizeof(cache_line_pad));
+}
+
+template<typename T>
+inline SPMCMulticastRing<T>::SPMCMulticastRing(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new T[capacity]), _cursor(0), _claimed(0), _reserved(0), _gate(0)
+{
+    assert((capacity > 0) && "Ring capacity must be greater than zero!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring capacity must be a power of two!");
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+    memset(_pad3, 0, sizeof(cache_line_pad));
+}
+
+template<typename T>
+inline size_t SPMCMulticastRing<T>::size(size_t consumer) const noexcept
+{
+    assert((consumer < _consumers.size()) && "Invalid consumer index!");
+
+    const size_t sequence = _consumers[consumer]->sequence.load(std::memory_order_acquire);
+    const size_t cursor = _cursor.load(std::memory_order_acquire);
+
+    return cursor - sequence;
+}
+
+template<typename T>
+inline size_t SPMCMulticastRing<T>::AddConsumer(std::initializer_list<size_t> dependencies)
+{
+    auto consumer = std::make_unique<Consumer>(_cursor.load(std::memory_order_relaxed));
+
+    // Consumer without dependencies waits for the producer only
+    for (auto dependency : dependencies)
+    {
+        assert((dependency < _consumers.size()) && "Invalid dependency consumer index!");
+        consumer->barriers.push_back(&_consumers[dependency]->sequence);
+    }
+    if (consumer->barriers.empty())
+        consumer->barriers.push_back(&_cursor);
+
+    _consumers.emplace_back(std::move(consumer));
+    return _consumers.size() - 1;
+}
+
+template<typename T>
+inline size_t SPMCMulticastRing<T>::Free(size_t count)
+{
+    // Refresh the cached gating sequence only if it is not enough
+    if ((_capacity - (_claimed - _gate)) < count)
+    {
+        size_t gate = _claimed;
+        for (auto& consumer : _consumers)
+            gate = std::min(gate, consumer->sequence.load(std::memory_order_acquire));
+        _gate = gate;
+    }
+
+    return _capacity - (_claimed - _gate);
+}
+
+template<typename T>
+inline size_t SPMCMulticastRing<T>::Available(Consumer& consumer, size_t count)
+{
+    const size_t sequence = consumer.sequence.load(std::memory_order_relaxed);
+
+    // Refresh the cached barrier sequence only if it is not enough
+    if ((consumer.available - sequence) < count)
+    {
+        size_t available = std::numeric_limits<size_t>::max();
+        for (auto barrier : consumer.barriers)
+            available = std::min(available, barrier->load(std::memory_order_acquire));
+        consumer.available = available;
+    }
+
+    return consumer.available - sequence;
+}
+
+template<typename T>
+inline bool SPMCMulticastRing<T>::Enqueue(const T& item)
+{
+    T temp = item;
+    return Enqueue(std::forward<T>(temp));
+}
+
+template<typename T>
+inline bool SPMCMulticastRing<T>::Enqueue(T&& item)
+{
+    // Check if the ring is full
+    if (Free(1) == 0)
+        return false;
+
+    // Store the item value
+    _buffer[_claimed & _mask] = std::move(item);
+
+    // Publish the item
+    _cursor.store(++_claimed, std::memory_order_release);
+
+    return true;
+}
+
+template<typename T>
+template<class InputIterator>
+inline size_t SPMCMulticastRing<T>::EnqueueBulk(InputIterator first, InputIterator last)
+{
+    // Claim all free slots for the batch
+    const size_t free = Free(_capacity);
+
+    size_t count = 0;
+    for (; (count < free) && (first != last); ++first, ++count)
+        _buffer[(_claimed + count) & _mask] = *first;
+
+    // Publish the whole batch at once
+    if (count > 0)
+    {
+        _claimed += count;
+        _cursor.store(_claimed, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template<typename T>
+inline T* SPMCMulticastRing<T>::Reserve(size_t& count)
+{
+    // Reserve contiguous slots up to the end of the ring
+    const size_t index = _claimed & _mask;
+    count = std::min({ count, Free(count), _capacity - index });
+    _reserved = count;
+
+    return (count > 0) ? &_buffer[index] : nullptr;
+}
+
+template<typename T>
+inline void SPMCMulticastRing<T>::Commit(size_t count)
+{
+    assert((count <= _reserved) && "Cannot commit more slots than reserved!");
+
+    _reserved = 0;
+    if (count > 0)
+    {
+        _claimed += count;
+        _cursor.store(_claimed, std::memory_order_release);
+    }
+}
+
+template<typename T>
+inline bool SPMCMulticastRing<T>::Dequeue(size_t consumer, T& item)
+{
+    assert((consumer < _consumers.size()) && "Invalid consumer index!");
+
+    Consumer& state = *_consumers[consumer];
+
+    // Check if the ring is empty for the consumer
+    if (Available(state, 1) == 0)
+        return false;
+
+    // Copy the item value and release the slot
+    const size_t sequence = state.sequence.load(std::memory_order_relaxed);
+    item = _buffer[sequence & _mask];
+    state.sequence.store(sequence + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<typename T>
+template<class OutputIterator>
+inline size_t SPMCMulticastRing<T>::DequeueBulk(size_t consumer, OutputIterator output, size_t max)
+{
+    return Consume(consumer, [&output](T& item) { *output = item; ++output; }, max);
+}
+
+template<typename T>
+template<class THandler>
+inline size_t SPMCMulticastRing<T>::Consume(size_t consumer, THandler handler, size_t max)
+{
+    assert((consumer < _consumers.size()) && "Invalid consumer index!");
+
+    Consumer& state = *_consumers[consumer];
+
+    // Claim all available items as a single batch
+    const size_t count = std::min(Available(state, max), max);
+    if (count == 0)
+        return 0;
+
+    const size_t sequence = state.sequence.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i)
+        handler(_buffer[(sequence + i) & _mask]);
+
+    // Release the whole batch at once
+    state.sequence.store(sequence + count, std::memory_order_release);
+
+    return count;
+}
+
+} // namespace CppCommon
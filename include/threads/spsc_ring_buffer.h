@@ -9,8 +9,10 @@
 #ifndef CPPCOMMON_THREADS_SPSC_RING_BUFFER_H
 #define CPPCOMMON_THREADS_SPSC_RING_BUFFER_H
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 
@@ -21,6 +23,13 @@ namespace CppCommon {
     Single producer / single consumer wait-free ring buffer use only atomic operations to provide thread-safe enqueue
     and dequeue operations. Ring buffer is bounded to the fixed capacity provided in the constructor.
 
+    Zero-copy API allows to write data directly into the ring buffer memory
+    using Reserve()/Commit() methods and to read data directly from the ring
+    buffer memory using Peek()/Release() methods. Reserved memory is always
+    contiguous: if the reservation does not fit into the tail of the ring
+    buffer, the tail is skipped and the reservation starts from the beginning
+    of the ring buffer. Skipped tail is never returned to the consumer.
+
     FIFO order is guaranteed!
 
     Thread-safe.
@@ -79,6 +88,51 @@ public:
     */
     bool Dequeue(void* data, size_t& size);
 
+    //! Reserve a contiguous memory in the ring buffer to write a data (single producer thread method)
+    /*!
+        Reserved memory should be filled with the data and committed using Commit() method.
+        Reservation size should not be greater than ring buffer capacity!
+
+        Will not block.
+
+        \param size - Reservation size
+        \return Pointer to the reserved memory or nullptr if the ring buffer is full
+    */
+    void* Reserve(size_t size);
+
+    //! Commit the data written into the reserved memory (single producer thread method)
+    /*!
+        Committed data becomes available for the consumer.
+
+        Will not block.
+
+        \param size - Committed data size (should not be greater than the reservation size)
+    */
+    void Commit(size_t size);
+
+    //! Peek a contiguous data from the ring buffer (single consumer thread method)
+    /*!
+        The data remains in the ring buffer until it is released using Release() method.
+        If the data is wrapped around the end of the ring buffer, only the first
+        contiguous part of it is returned.
+
+        Will not block.
+
+        \param size - Available data size
+        \return Pointer to the available data or nullptr if the ring buffer is empty
+    */
+    const void* Peek(size_t& size);
+
+    //! Release the data read from the ring buffer (single consumer thread method)
+    /*!
+        Released memory becomes available for the producer.
+
+        Will not block.
+
+        \param size - Released data size (should not be greater than the peeked data size)
+    */
+    void Release(size_t size);
+
 private:
     typedef char cache_line_pad[128];
 
@@ -89,9 +143,16 @@ private:
 
     cache_line_pad _pad1;
     std::atomic<size_t> _head;
+    std::atomic<size_t> _gap;
+    size_t _reserve_position;
+    size_t _reserve_size;
     cache_line_pad _pad2;
     std::atomic<size_t> _tail;
+    size_t _peek_size;
     cache_line_pad _pad3;
+
+    //! Skip the padding gap if it starts at the tail
+    size_t SkipGap(size_t tail, size_t head) noexcept;
 };
 
 /*! \example threads_spsc_ring_buffer.cpp Single producer / single consumer wait-free ring buffer example */
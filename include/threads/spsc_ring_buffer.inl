@@ -8,7 +8,7 @@
 
 namespace CppCommon {
 
-inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new uint8_t[capacity]), _head(0), _tail(0)
+inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new uint8_t[capacity]), _head(0), _gap(SIZE_MAX), _reserve_position(0), _reserve_size(0), _tail(0), _peek_size(0)
 {
     assert((capacity > 1) && "Ring buffer capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
@@ -23,6 +23,11 @@ inline size_t SPSCRingBuffer::size() const noexcept
 {
     const size_t head = _head.load(std::memory_order_acquire);
     const size_t tail = _tail.load(std::memory_order_acquire);
+    const size_t gap = _gap.load(std::memory_order_relaxed);
+
+    // Padding gap skipped by the zero-copy producer is not counted
+    if ((tail <= gap) && (gap < head))
+        return head - tail - (((gap | _mask) + 1) - gap);
 
     return head - tail;
 }
@@ -71,11 +76,16 @@ inline bool SPSCRingBuffer::Dequeue(void* data, size_t& size)
     if (data == nullptr)
         return false;
 
-    const size_t tail = _tail.load(std::memory_order_relaxed);
     const size_t head = _head.load(std::memory_order_acquire);
+    const size_t tail = SkipGap(_tail.load(std::memory_order_relaxed), head);
+
+    // Padding gap skipped by the zero-copy producer
+    const size_t gap = _gap.load(std::memory_order_relaxed);
+    const bool skip = (tail < gap) && (gap < head);
+    const size_t skipped = skip ? (((gap | _mask) + 1) - gap) : 0;
 
     // Get the ring buffer size
-    size_t available = head - tail;
+    size_t available = head - tail - skipped;
     if (size > available)
         size = available;
 
@@ -86,16 +96,100 @@ inline bool SPSCRingBuffer::Dequeue(void* data, size_t& size)
     // Copy data from the ring buffer
     size_t head_index = head & _mask;
     size_t tail_index = tail & _mask;
-    size_t remain = (head_index > tail_index) ? (head_index - tail_index) : (_capacity - tail_index);
+    size_t remain = skip ? (gap - tail) : ((head_index > tail_index) ? (head_index - tail_index) : (_capacity - tail_index));
     size_t first = (size > remain) ? remain : size;
     size_t last = (size > remain) ? size - remain : 0;
     memcpy((uint8_t*)data, &_buffer[tail_index], first);
     memcpy((uint8_t*)data + first, _buffer, last);
 
     // Increase the tail cursor
-    _tail.store(tail + size, std::memory_order_release);
+    _tail.store(tail + size + ((size > remain) ? skipped : 0), std::memory_order_release);
 
     return true;
 }
 
+inline void* SPSCRingBuffer::Reserve(size_t size)
+{
+    assert((size <= _capacity) && "Reservation size should not be greater than ring buffer capacity!");
+    if (size > _capacity)
+        return nullptr;
+
+    const size_t head = _head.load(std::memory_order_relaxed);
+    const size_t tail = _tail.load(std::memory_order_acquire);
+
+    // Skip the tail of the ring buffer if the reservation does not fit into it
+    size_t position = head;
+    if (((head & _mask) + size) > _capacity)
+        position = (head | _mask) + 1;
+
+    // Check if there is required free space in the ring buffer
+    if ((position + size - tail) > _capacity)
+        return nullptr;
+
+    _reserve_position = position;
+    _reserve_size = size;
+    return &_buffer[position & _mask];
+}
+
+inline void SPSCRingBuffer::Commit(size_t size)
+{
+    assert((size <= _reserve_size) && "Committed data size should not be greater than the reservation size!");
+    if (size > _reserve_size)
+        size = _reserve_size;
+
+    _reserve_size = 0;
+
+    if (size == 0)
+        return;
+
+    // Publish the padding gap together with the head cursor
+    const size_t head = _head.load(std::memory_order_relaxed);
+    if (_reserve_position != head)
+        _gap.store(head, std::memory_order_relaxed);
+
+    // Increase the head cursor
+    _head.store(_reserve_position + size, std::memory_order_release);
+}
+
+inline const void* SPSCRingBuffer::Peek(size_t& size)
+{
+    const size_t head = _head.load(std::memory_order_acquire);
+    const size_t tail = SkipGap(_tail.load(std::memory_order_relaxed), head);
+
+    // Data is contiguous until the padding gap or the end of the ring buffer
+    const size_t gap = _gap.load(std::memory_order_relaxed);
+    size_t end = ((tail < gap) && (gap < head)) ? gap : head;
+    end = std::min(end, (tail | _mask) + 1);
+
+    size = _peek_size = end - tail;
+    return (size > 0) ? &_buffer[tail & _mask] : nullptr;
+}
+
+inline void SPSCRingBuffer::Release(size_t size)
+{
+    assert((size <= _peek_size) && "Released data size should not be greater than the peeked data size!");
+    if (size > _peek_size)
+        size = _peek_size;
+
+    _peek_size -= size;
+
+    if (size == 0)
+        return;
+
+    // Increase the tail cursor
+    _tail.store(_tail.load(std::memory_order_relaxed) + size, std::memory_order_release);
+}
+
+inline size_t SPSCRingBuffer::SkipGap(size_t tail, size_t head) noexcept
+{
+    // Padding gap is published before the head cursor, so it is visible here
+    const size_t gap = _gap.load(std::memory_order_relaxed);
+    if ((tail == gap) && (gap < head))
+    {
+        tail = (gap | _mask) + 1;
+        _tail.store(tail, std::memory_order_release);
+    }
+    return tail;
+}
+
 } // namespace CppCommon
@@ -0,0 +1,321 @@
+/*!
+    \file thread_pool.h
+    \brief Work-stealing thread pool definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_THREAD_POOL_H
+#define CPPCOMMON_THREADS_THREAD_POOL_H
+
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/thread.h"
+#include "threads/work_stealing_deque.h"
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace CppCommon {
+
+class ThreadPool;
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Thread pool task
+class PoolTask
+{
+public:
+    virtual ~PoolTask() = default;
+
+    //! Execute the task
+    virtual void Execute() = 0;
+};
+
+//! Thread pool task with the given function
+template <typename Fn>
+class PoolFunctionTask : public PoolTask
+{
+public:
+    template <typename F>
+    explicit PoolFunctionTask(F&& fn) : _fn(std::forward<F>(fn)) {}
+
+    void Execute() override { _fn(); }
+
+private:
+    Fn _fn;
+};
+
+//! Thread pool future shared state
+template <typename T>
+class PoolFutureState
+{
+public:
+    typedef std::conditional_t<std::is_void<T>::value, std::monostate, T> value_type;
+
+    PoolFutureState() : _ready(false) {}
+
+    bool ready() const noexcept { return _ready.load(std::memory_order_acquire); }
+
+    //! Block until the state is ready
+    void Wait();
+
+    //! Set the result value and run continuations
+    void SetValue(value_type&& value);
+    //! Set the result exception and run continuations
+    void SetException(std::exception_ptr exception);
+
+    //! Take the result value or rethrow the result exception
+    value_type Take();
+
+    //! Add the continuation task which is executed once the state is ready
+    void AddContinuation(std::unique_ptr<PoolTask>&& continuation);
+
+private:
+    CriticalSection _cs;
+    ConditionVariable _cv;
+    std::atomic<bool> _ready;
+    std::optional<value_type> _value;
+    std::exception_ptr _exception;
+    std::vector<std::unique_ptr<PoolTask>> _continuations;
+
+    //! Make the state ready and run continuations
+    void Complete();
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Thread pool task future
+/*!
+    Thread pool task future provides the result of the task submitted into
+    the thread pool. Waiting for the future in the thread pool worker does
+    not block the worker, but executes other pending tasks until the future
+    is ready, so fork-join algorithms could wait for their children tasks.
+
+    Continuations attached with Then() are scheduled into the thread pool
+    when the future becomes ready.
+
+    Not thread-safe.
+*/
+template <typename T>
+class TaskFuture
+{
+    friend class ThreadPool;
+    template <typename U>
+    friend class TaskFuture;
+
+public:
+    TaskFuture() noexcept : _pool(nullptr) {}
+    TaskFuture(const TaskFuture&) = delete;
+    TaskFuture(TaskFuture&&) noexcept = default;
+    ~TaskFuture() = default;
+
+    TaskFuture& operator=(const TaskFuture&) = delete;
+    TaskFuture& operator=(TaskFuture&&) noexcept = default;
+
+    //! Check if the future is valid
+    explicit operator bool() const noexcept { return valid(); }
+
+    //! Is the future valid?
+    bool valid() const noexcept { return (bool)_state; }
+    //! Is the future result ready?
+    bool ready() const noexcept { return _state && _state->ready(); }
+
+    //! Wait for the future result
+    /*!
+        Will block or execute other pending tasks in the thread pool worker.
+    */
+    void Wait();
+
+    //! Get the future result
+    /*!
+        Will block or execute other pending tasks in the thread pool worker.
+        The future becomes invalid after this call. The exception thrown by
+        the task is re-thrown.
+
+        \return Task result
+    */
+    T Get();
+
+    //! Attach the continuation to the future
+    /*!
+        The continuation is called in the thread pool with the result of the
+        current future as an argument (or without arguments for void future).
+        If the current task throws an exception, the continuation is skipped
+        and the exception is propagated into the continuation future. The
+        current future becomes invalid after this call.
+
+        \param fn - Continuation function
+        \return Continuation future
+    */
+    template <typename Fn>
+    auto Then(Fn&& fn);
+
+private:
+    ThreadPool* _pool;
+    std::shared_ptr<Internals::PoolFutureState<T>> _state;
+
+    TaskFuture(ThreadPool* pool, std::shared_ptr<Internals::PoolFutureState<T>> state) noexcept : _pool(pool), _state(std::move(state)) {}
+};
+
+//! Work-stealing thread pool
+/*!
+    Work-stealing thread pool executes tasks on the fixed count of worker
+    threads. Each worker has its own lock-free Chase-Lev deque. Tasks
+    submitted from the worker are pushed into its deque and popped in LIFO
+    order, while idle workers steal the oldest tasks from other workers.
+    Tasks submitted from external threads are pushed into the shared
+    injection queue.
+
+    Idle workers spin for a short time and then park until new tasks are
+    submitted. Worker threads could be optionally pinned to CPU cores.
+
+    Unhandled exceptions thrown by tasks posted with Post() are fatal. Use
+    Submit() to propagate exceptions through the task future.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Work_stealing
+*/
+class ThreadPool
+{
+    template <typename T>
+    friend class TaskFuture;
+
+public:
+    //! Initialize thread pool with a given count of workers
+    /*!
+        \param threads - Count of worker threads (default is std::thread::hardware_concurrency())
+        \param pinning - Pin worker threads to CPU cores (default is false)
+    */
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency(), bool pinning = false);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    //! Get the count of worker threads
+    size_t threads() const noexcept { return _workers.size(); }
+    //! Get the count of pending and running tasks
+    size_t pending() const noexcept { return _pending.load(std::memory_order_acquire); }
+    //! Is worker threads pinned to CPU cores?
+    bool pinning() const noexcept { return _pinning; }
+
+    //! Get the thread pool of the current worker thread
+    /*!
+        \return Thread pool or nullptr if the current thread is not a thread pool worker
+    */
+    static ThreadPool* CurrentPool() noexcept;
+    //! Get the worker index of the current worker thread
+    /*!
+        \return Worker index or -1 if the current thread is not a thread pool worker
+    */
+    static int CurrentWorker() noexcept;
+
+    //! Post the task into the thread pool
+    /*!
+        \param fn - Task function
+    */
+    template <typename Fn>
+    void Post(Fn&& fn);
+
+    //! Submit the task into the thread pool
+    /*!
+        \param fn - Task function
+        \param args - Task function arguments
+        \return Task future
+    */
+    template <typename Fn, typename... Args>
+    auto Submit(Fn&& fn, Args&&... args) -> TaskFuture<std::invoke_result_t<std::decay_t<Fn>, std::decay_t<Args>...>>;
+
+    //! Execute one pending task in the current thread
+    /*!
+        Will not block.
+
+        \return 'true' if the task was executed, 'false' if there are no pending tasks
+    */
+    bool RunOne();
+
+    //! Wait until all pending tasks are completed
+    /*!
+        Must not be called from the worker of the same thread pool.
+
+        Will block.
+    */
+    void Wait();
+
+    //! Stop the thread pool
+    /*!
+        All pending tasks are executed before worker threads are stopped.
+        Tasks must not be posted after the thread pool is stopped.
+    */
+    void Stop();
+
+private:
+    // Thread pool worker
+    struct Worker
+    {
+        size_t index;
+        uint64_t random;
+        WorkStealingDeque<Internals::PoolTask*> deque;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    bool _pinning;
+    std::atomic<bool> _stop;
+    std::atomic<size_t> _pending;
+
+    // Injection queue of external tasks
+    CriticalSection _injection_cs;
+    std::deque<Internals::PoolTask*> _injection;
+    std::atomic<size_t> _injected;
+
+    // Parking of idle workers
+    CriticalSection _park_cs;
+    ConditionVariable _park_cv;
+    std::atomic<size_t> _sleepers;
+    size_t _wakeups;
+
+    // Waiting for all pending tasks
+    CriticalSection _idle_cs;
+    ConditionVariable _idle_cv;
+
+    //! Schedule the task
+    void Schedule(Internals::PoolTask* task);
+    //! Execute the task
+    void Execute(Internals::PoolTask* task);
+    //! Find a pending task for the given worker
+    Internals::PoolTask* FindTask(Worker* worker);
+    //! Is there any pending task?
+    bool HasTasks() const;
+    //! Wake one parked worker
+    void Wake();
+    //! Park the current worker
+    void Park();
+    //! Help to execute pending tasks until the given predicate is true
+    template <typename TPredicate>
+    void Help(TPredicate predicate);
+
+    //! Worker thread function
+    void WorkerThread(size_t index);
+};
+
+/*! \example threads_thread_pool.cpp Work-stealing thread pool example */
+
+} // namespace CppCommon
+
+#include "thread_pool.inl"
+
+#endif // CPPCOMMON_THREADS_THREAD_POOL_H
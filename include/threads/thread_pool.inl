@@ -0,0 +1,210 @@
+/*!
+    \file thread_pool.inl
+    \brief Work-stealing thread pool inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <typename T>
+inline void PoolFutureState<T>::Wait()
+{
+    Locker<CriticalSection> locker(_cs);
+    _cv.Wait(_cs, [this]() { return ready(); });
+}
+
+template <typename T>
+inline void PoolFutureState<T>::SetValue(value_type&& value)
+{
+    _value.emplace(std::move(value));
+    Complete();
+}
+
+template <typename T>
+inline void PoolFutureState<T>::SetException(std::exception_ptr exception)
+{
+    _exception = exception;
+    Complete();
+}
+
+template <typename T>
+inline typename PoolFutureState<T>::value_type PoolFutureState<T>::Take()
+{
+    assert(ready() && "Future state must be ready!");
+
+    if (_exception)
+        std::rethrow_exception(_exception);
+
+    return std::move(*_value);
+}
+
+template <typename T>
+inline void PoolFutureState<T>::AddContinuation(std::unique_ptr<PoolTask>&& continuation)
+{
+    {
+        Locker<CriticalSection> locker(_cs);
+        if (!ready())
+        {
+            _continuations.emplace_back(std::move(continuation));
+            return;
+        }
+    }
+
+    // The state is already ready
+    continuation->Execute();
+}
+
+template <typename T>
+inline void PoolFutureState<T>::Complete()
+{
+    std::vector<std::unique_ptr<PoolTask>> continuations;
+
+    {
+        Locker<CriticalSection> locker(_cs);
+        _ready.store(true, std::memory_order_release);
+        continuations.swap(_continuations);
+        _cv.NotifyAll();
+    }
+
+    // Continuations are executed outside of the lock
+    for (auto& continuation : continuations)
+        continuation->Execute();
+}
+
+//! Continuation result type
+template <typename T, typename Fn>
+struct PoolContinuationResult { typedef std::invoke_result_t<Fn, T> type; };
+template <typename Fn>
+struct PoolContinuationResult<void, Fn> { typedef std::invoke_result_t<Fn> type; };
+
+} // namespace Internals
+//! @endcond
+
+template <typename T>
+inline void TaskFuture<T>::Wait()
+{
+    assert(valid() && "Future must be valid!");
+
+    if (_state->ready())
+        return;
+
+    // Execute other pending tasks in the thread pool worker
+    ThreadPool* current = ThreadPool::CurrentPool();
+    if (current != nullptr)
+        current->Help([this]() { return _state->ready(); });
+    else
+        _state->Wait();
+}
+
+template <typename T>
+inline T TaskFuture<T>::Get()
+{
+    Wait();
+
+    auto state = std::move(_state);
+    if constexpr (std::is_void<T>::value)
+        state->Take();
+    else
+        return state->Take();
+}
+
+template <typename T>
+template <typename Fn>
+inline auto TaskFuture<T>::Then(Fn&& fn)
+{
+    assert(valid() && "Future must be valid!");
+
+    typedef typename Internals::PoolContinuationResult<T, std::decay_t<Fn>>::type R;
+
+    auto pool = _pool;
+    auto state = std::move(_state);
+    auto next = std::make_shared<Internals::PoolFutureState<R>>();
+
+    auto continuation = [pool, state, next, fn = std::forward<Fn>(fn)]() mutable
+    {
+        pool->Post([state = std::move(state), next = std::move(next), fn = std::move(fn)]() mutable
+        {
+            try
+            {
+                auto value = state->Take();
+                if constexpr (std::is_void<T>::value)
+                {
+                    if constexpr (std::is_void<R>::value)
+                    {
+                        fn();
+                        next->SetValue(std::monostate());
+                    }
+                    else
+                        next->SetValue(fn());
+                }
+                else
+                {
+                    if constexpr (std::is_void<R>::value)
+                    {
+                        fn(std::move(value));
+                        next->SetValue(std::monostate());
+                    }
+                    else
+                        next->SetValue(fn(std::move(value)));
+                }
+            }
+            catch (...)
+            {
+                next->SetException(std::current_exception());
+            }
+        });
+    };
+
+    auto raw = state.get();
+    raw->AddContinuation(std::make_unique<Internals::PoolFunctionTask<decltype(continuation)>>(std::move(continuation)));
+    return TaskFuture<R>(pool, std::move(next));
+}
+
+template <typename Fn>
+inline void ThreadPool::Post(Fn&& fn)
+{
+    Schedule(new Internals::PoolFunctionTask<std::decay_t<Fn>>(std::forward<Fn>(fn)));
+}
+
+template <typename Fn, typename... Args>
+inline auto ThreadPool::Submit(Fn&& fn, Args&&... args) -> TaskFuture<std::invoke_result_t<std::decay_t<Fn>, std::decay_t<Args>...>>
+{
+    typedef std::invoke_result_t<std::decay_t<Fn>, std::decay_t<Args>...> R;
+
+    auto state = std::make_shared<Internals::PoolFutureState<R>>();
+
+    Post([state, fn = std::forward<Fn>(fn), ...args = std::forward<Args>(args)]() mutable
+    {
+        try
+        {
+            if constexpr (std::is_void<R>::value)
+            {
+                std::invoke(std::move(fn), std::move(args)...);
+                state->SetValue(std::monostate());
+            }
+            else
+                state->SetValue(std::invoke(std::move(fn), std::move(args)...));
+        }
+        catch (...)
+        {
+            state->SetException(std::current_exception());
+        }
+    });
+
+    return TaskFuture<R>(this, std::move(state));
+}
+
+template <typename TPredicate>
+inline void ThreadPool::Help(TPredicate predicate)
+{
+    while (!predicate())
+        if (!RunOne())
+            Thread::Yield();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,100 @@
+/*!
+    \file thread_records.h
+    \brief Per-thread records registry definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_THREAD_RECORDS_H
+#define CPPCOMMON_THREADS_THREAD_RECORDS_H
+
+#include "threads/thread_registry.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Per-thread records registry
+/*!
+    Thread records registry is used by memory reclamation schemes to give each
+    participating thread its own record. The record is registered on the first
+    access from the thread and remembered in the thread-local token, so next
+    accesses are wait-free. When the thread exits the record is released and
+    could be taken by another thread together with its pending state.
+
+    Record data must provide 'void Release() noexcept' method which is called
+    when the record is released by its thread, so the exited thread could not
+    leave its published state (e.g. hazard pointers) behind.
+
+    Records are never removed from the registry until it is destroyed, so
+    other threads can always scan all records without locks.
+
+    Thread-safe.
+*/
+template <class TRecord>
+class ThreadRecords
+{
+public:
+    //! Thread record
+    struct Record
+    {
+        TRecord data;
+        std::atomic<bool> owned;
+        Record* next;
+
+        Record() : owned(true), next(nullptr) {}
+
+        //! Release the record for other threads
+        void Release() noexcept { data.Release(); owned.store(false, std::memory_order_release); }
+    };
+
+    ThreadRecords() : _head(nullptr) {}
+    ThreadRecords(const ThreadRecords&) = delete;
+    ThreadRecords(ThreadRecords&&) = delete;
+    ~ThreadRecords() = default;
+
+    ThreadRecords& operator=(const ThreadRecords&) = delete;
+    ThreadRecords& operator=(ThreadRecords&&) = delete;
+
+    //! Get the first record in the registry
+    Record* head() const noexcept { return _head.load(std::memory_order_acquire); }
+
+    //! Get the record of the current thread
+    /*!
+        Registers the record on the first call from the current thread.
+
+        \return Record of the current thread
+    */
+    Record& Current();
+
+    //! Release the record of the current thread
+    /*!
+        Does nothing if the current thread has no registered record.
+    */
+    void Release();
+
+private:
+    ThreadRegistry<Record> _registry;
+    std::atomic<Record*> _head;
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<Record>> _records;
+
+    //! Register the record for the current thread
+    Record& Register();
+};
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
+
+#include "thread_records.inl"
+
+#endif // CPPCOMMON_THREADS_THREAD_RECORDS_H
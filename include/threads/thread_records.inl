@@ -0,0 +1,64 @@
+/*!
+    \file thread_records.inl
+    \brief Per-thread records registry inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <class TRecord>
+inline typename ThreadRecords<TRecord>::Record& ThreadRecords<TRecord>::Current()
+{
+    Record* record = _registry.Find();
+    return (record != nullptr) ? *record : Register();
+}
+
+template <class TRecord>
+inline void ThreadRecords<TRecord>::Release()
+{
+    Record* record = _registry.Unregister();
+    if (record != nullptr)
+        record->Release();
+}
+
+template <class TRecord>
+inline typename ThreadRecords<TRecord>::Record& ThreadRecords<TRecord>::Register()
+{
+    std::shared_ptr<Record> record;
+
+    // Try to take one of released records
+    {
+        std::scoped_lock locker(_mutex);
+        for (auto& candidate : _records)
+        {
+            bool owned = false;
+            if (!candidate->owned.load(std::memory_order_relaxed) && candidate->owned.compare_exchange_strong(owned, true, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                record = candidate;
+                break;
+            }
+        }
+
+        // Create a new record and publish it for lock-free scanning
+        if (!record)
+        {
+            record = std::make_shared<Record>();
+            record->next = _head.load(std::memory_order_relaxed);
+            _records.push_back(record);
+            _head.store(record.get(), std::memory_order_release);
+        }
+    }
+
+    _registry.Register(record);
+    return *record;
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
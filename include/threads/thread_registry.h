@@ -0,0 +1,107 @@
+/*!
+    \file thread_registry.h
+    \brief Thread-local registry of per-thread objects definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_THREAD_REGISTRY_H
+#define CPPCOMMON_THREADS_THREAD_REGISTRY_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Thread-local registry of per-thread objects
+/*!
+    Thread registry remembers the object registered for the current thread in
+    the thread-local token, so next lookups are wait-free. The token keeps
+    registrations of all registry instances used by the thread, the most
+    recently used one is the first. Registrations of destroyed objects are
+    forgotten on the next registration.
+
+    When the thread exits all its alive registered objects are released with
+    their 'void Release() noexcept' method.
+
+    Thread-safe.
+*/
+template <class TObject>
+class ThreadRegistry
+{
+public:
+    ThreadRegistry() noexcept : _id(NextId()) {}
+    ThreadRegistry(const ThreadRegistry&) = delete;
+    ThreadRegistry(ThreadRegistry&&) = delete;
+    ~ThreadRegistry() = default;
+
+    ThreadRegistry& operator=(const ThreadRegistry&) = delete;
+    ThreadRegistry& operator=(ThreadRegistry&&) = delete;
+
+    //! Find the object registered for the current thread
+    /*!
+        \return Pointer to the registered object or nullptr if the current thread has no registered object
+    */
+    TObject* Find() noexcept;
+
+    //! Register the object for the current thread
+    /*!
+        \param object - Object to register
+    */
+    void Register(const std::shared_ptr<TObject>& object);
+    //! Replace the object registered for the current thread
+    /*!
+        The previous object is not released.
+
+        \param object - Object to register instead of the previous one
+    */
+    void Replace(const std::shared_ptr<TObject>& object) noexcept;
+    //! Unregister the object of the current thread
+    /*!
+        The object is not released.
+
+        \return Pointer to the unregistered object or nullptr if the current thread has no registered object
+    */
+    TObject* Unregister() noexcept;
+
+private:
+    // Thread-local registration of the object
+    struct Registration
+    {
+        uint64_t id;
+        TObject* object;
+        std::weak_ptr<TObject> owner;
+    };
+
+    // Thread-local token releases registered objects when the thread exits
+    struct Token
+    {
+        std::vector<Registration> registrations;
+
+        ~Token();
+    };
+
+    uint64_t _id;
+
+    //! Get the thread-local token of the current thread
+    static Token& CurrentToken();
+
+    //! Get unique identifier of thread registry instance
+    static uint64_t NextId() noexcept;
+};
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
+
+#include "thread_registry.inl"
+
+#endif // CPPCOMMON_THREADS_THREAD_REGISTRY_H
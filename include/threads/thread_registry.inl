@@ -0,0 +1,109 @@
+/*!
+    \file thread_registry.inl
+    \brief Thread-local registry of per-thread objects inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template <class TObject>
+inline TObject* ThreadRegistry<TObject>::Find() noexcept
+{
+    Token& token = CurrentToken();
+
+    // Fast path: the object of the most recently used instance is the first
+    if (!token.registrations.empty() && (token.registrations.front().id == _id))
+        return token.registrations.front().object;
+
+    for (auto it = token.registrations.begin(); it != token.registrations.end(); ++it)
+    {
+        if (it->id == _id)
+        {
+            std::iter_swap(token.registrations.begin(), it);
+            return token.registrations.front().object;
+        }
+    }
+
+    return nullptr;
+}
+
+template <class TObject>
+inline void ThreadRegistry<TObject>::Register(const std::shared_ptr<TObject>& object)
+{
+    Token& token = CurrentToken();
+
+    // Forget registrations of destroyed objects
+    token.registrations.erase(std::remove_if(token.registrations.begin(), token.registrations.end(), [](const Registration& registration) { return registration.owner.expired(); }), token.registrations.end());
+
+    token.registrations.insert(token.registrations.begin(), Registration{ _id, object.get(), object });
+}
+
+template <class TObject>
+inline void ThreadRegistry<TObject>::Replace(const std::shared_ptr<TObject>& object) noexcept
+{
+    Token& token = CurrentToken();
+
+    for (auto& registration : token.registrations)
+    {
+        if (registration.id == _id)
+        {
+            registration.object = object.get();
+            registration.owner = object;
+            return;
+        }
+    }
+}
+
+template <class TObject>
+inline TObject* ThreadRegistry<TObject>::Unregister() noexcept
+{
+    Token& token = CurrentToken();
+
+    for (auto it = token.registrations.begin(); it != token.registrations.end(); ++it)
+    {
+        if (it->id == _id)
+        {
+            TObject* object = it->object;
+            token.registrations.erase(it);
+            return object;
+        }
+    }
+
+    return nullptr;
+}
+
+template <class TObject>
+inline ThreadRegistry<TObject>::Token::~Token()
+{
+    // Release objects which are still alive
+    for (auto& registration : registrations)
+    {
+        auto object = registration.owner.lock();
+        if (object)
+            object->Release();
+    }
+}
+
+template <class TObject>
+inline typename ThreadRegistry<TObject>::Token& ThreadRegistry<TObject>::CurrentToken()
+{
+    static thread_local Token token;
+    return token;
+}
+
+template <class TObject>
+inline uint64_t ThreadRegistry<TObject>::NextId() noexcept
+{
+    static std::atomic<uint64_t> id(0);
+    return ++id;
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
@@ -0,0 +1,124 @@
+/*!
+    \file ticket_spin_lock.h
+    \brief Ticket spin-lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TICKET_SPIN_LOCK_H
+#define CPPCOMMON_THREADS_TICKET_SPIN_LOCK_H
+
+#include "threads/futex.h"
+#include "threads/locker.h"
+#include "threads/thread.h"
+#include "threads/wait_strategy.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Ticket spin-lock synchronization primitive
+/*!
+    Ticket spin-lock grants the lock to waiting threads in the strict FIFO
+    order. Each thread takes the next ticket and waits until the ticket is
+    served. Waiting thread pauses proportionally to the count of threads
+    ahead of it in the queue, so the shared cache line is polled less often
+    under contention. Threads which are waiting too long yield the CPU to
+    let the preempted lock owner progress.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Ticket_lock
+*/
+class TicketSpinLock
+{
+public:
+    //! Default class constructor
+    /*!
+        \param backoff - Count of pause instructions for each thread ahead in the queue (default is 64)
+    */
+    explicit TicketSpinLock(uint32_t backoff = 64) noexcept : _backoff(backoff), _next(0), _serving(0) {}
+    TicketSpinLock(const TicketSpinLock&) = delete;
+    TicketSpinLock(TicketSpinLock&&) = delete;
+    ~TicketSpinLock() = default;
+
+    TicketSpinLock& operator=(const TicketSpinLock&) = delete;
+    TicketSpinLock& operator=(TicketSpinLock&&) = delete;
+
+    //! Get the count of pause instructions for each thread ahead in the queue
+    uint32_t backoff() const noexcept { return _backoff; }
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the spin-lock is already locked, 'false' if the spin-lock is released
+    */
+    bool IsLocked() noexcept;
+
+    //! Try to acquire spin-lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire spin-lock for the given spin count
+    /*!
+        Will block for the given spin count in the worst case.
+
+        \param spin - Spin count
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockSpin(int64_t spin) noexcept;
+
+    //! Try to acquire spin-lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the spin-lock
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockFor(const Timespan& timespan) noexcept;
+    //! Try to acquire spin-lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the spin-lock
+        \return 'true' if the spin-lock was successfully acquired, 'false' if the spin-lock is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire spin-lock with block
+    /*!
+        Will block in a spin loop.
+    */
+    void Lock() noexcept;
+
+    //! Release spin-lock
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    typedef char cache_line_pad[128];
+
+    uint32_t _backoff;
+    std::atomic<uint32_t> _next;
+    cache_line_pad _pad;
+    std::atomic<uint32_t> _serving;
+};
+
+/*! \example threads_ticket_spin_lock.cpp Ticket spin-lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "ticket_spin_lock.inl"
+
+#endif // CPPCOMMON_THREADS_TICKET_SPIN_LOCK_H
@@ -0,0 +1,81 @@
+/*!
+    \file ticket_spin_lock.inl
+    \brief Ticket spin-lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool TicketSpinLock::IsLocked() noexcept
+{
+    return _next.load(std::memory_order_relaxed) != _serving.load(std::memory_order_acquire);
+}
+
+inline bool TicketSpinLock::TryLock() noexcept
+{
+    // Take the next ticket only if it will be served immediately
+    uint32_t serving = _serving.load(std::memory_order_acquire);
+    return _next.compare_exchange_strong(serving, serving + 1, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline bool TicketSpinLock::TryLockSpin(int64_t spin) noexcept
+{
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+    } while (spin-- > 0);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline bool TicketSpinLock::TryLockFor(const Timespan& timespan) noexcept
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    // Try to acquire spin-lock at least one time
+    do
+    {
+        if (TryLock())
+            return true;
+    } while (NanoTimestamp() < finish);
+
+    // Failed to acquire spin-lock
+    return false;
+}
+
+inline void TicketSpinLock::Lock() noexcept
+{
+    const uint32_t ticket = _next.fetch_add(1, std::memory_order_relaxed);
+    const uint32_t limit = Futex::SpinCount();
+
+    uint32_t attempts = 0;
+    for (;;)
+    {
+        const uint32_t serving = _serving.load(std::memory_order_acquire);
+        if (serving == ticket)
+            return;
+
+        // Pause proportionally to the count of threads ahead in the queue
+        if (attempts++ < limit)
+        {
+            const uint32_t pause = (ticket - serving) * _backoff;
+            for (uint32_t i = 0; i < pause; ++i)
+                BackoffWait::Pause();
+        }
+        else
+            Thread::Yield();
+    }
+}
+
+inline void TicketSpinLock::Unlock() noexcept
+{
+    _serving.store(_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,204 @@
+/*!
+    \file timer_service.h
+    \brief Timer service definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TIMER_SERVICE_H
+#define CPPCOMMON_THREADS_TIMER_SERVICE_H
+
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Timer service
+/*!
+    Timer service schedules large numbers of timeouts (e.g. heartbeats of
+    network sessions) in the hierarchical timing wheel. The wheel has four
+    levels of 256 slots each, so schedule, cancel and reschedule operations
+    take O(1) time regardless of the count of active timers. Timers which are
+    far in the future are cascaded into lower levels as the time goes.
+
+    Time is measured in ticks of the given resolution. Ticks are produced
+    by Timestamp::nano() or by the user-supplied clock, which is useful to
+    drive the service with the simulated time. Timers never expire earlier
+    than requested, but could expire up to one tick later.
+
+    Expired timers are dispatched in batches either by the user-driven
+    Poll() method or by the dispatch thread started with Start(). Callbacks
+    are called without holding the service lock, so they could schedule,
+    cancel or reschedule timers. Callbacks must not call Poll(). Unhandled
+    exceptions thrown by callbacks on the dispatch thread are fatal.
+
+    Thread-safe.
+
+    http://www.cs.columbia.edu/~nahum/w6998/papers/sosp87-timing-wheels.pdf
+*/
+class TimerService
+{
+public:
+    //! Timer identifier
+    typedef uint64_t TimerId;
+    //! Timer callback
+    typedef std::function<void()> Callback;
+    //! Clock which returns the current time in nanoseconds
+    typedef std::function<uint64_t()> Clock;
+
+    //! Invalid timer identifier
+    static const TimerId InvalidTimer = 0;
+
+    //! Initialize timer service with a given tick resolution and clock
+    /*!
+        \param resolution - Tick resolution (default is 1 millisecond)
+        \param clock - Clock in nanoseconds (default is Timestamp::nano())
+    */
+    explicit TimerService(const Timespan& resolution = Timespan::milliseconds(1), const Clock& clock = nullptr);
+    TimerService(const TimerService&) = delete;
+    TimerService(TimerService&&) = delete;
+    ~TimerService();
+
+    TimerService& operator=(const TimerService&) = delete;
+    TimerService& operator=(TimerService&&) = delete;
+
+    //! Get the tick resolution
+    Timespan resolution() const noexcept { return Timespan((int64_t)_resolution); }
+    //! Get the current time of the service clock in nanoseconds
+    uint64_t now() const { return _clock ? _clock() : Timestamp::nano(); }
+    //! Get the last processed tick
+    uint64_t tick() const;
+    //! Get the count of scheduled timers
+    size_t size() const;
+    //! Is the dispatch thread running?
+    bool running() const noexcept { return _thread.joinable(); }
+
+    //! Schedule a new timer
+    /*!
+        \param timeout - Timeout after which the callback is called
+        \param callback - Timer callback
+        \param period - Period to repeat the timer (default is zero for one-shot timer)
+        \return Timer identifier
+    */
+    TimerId Schedule(const Timespan& timeout, Callback callback, const Timespan& period = Timespan::zero());
+    //! Reschedule the timer with a new timeout
+    /*!
+        Period of the timer is preserved.
+
+        \param id - Timer identifier
+        \param timeout - New timeout after which the callback is called
+        \return 'true' if the timer was successfully rescheduled, 'false' if the timer is not scheduled
+    */
+    bool Reschedule(TimerId id, const Timespan& timeout);
+    //! Cancel the timer
+    /*!
+        Callback of the timer which is already collected into the dispatch
+        batch will be still called once.
+
+        \param id - Timer identifier
+        \return 'true' if the timer was successfully cancelled, 'false' if the timer is not scheduled
+    */
+    bool Cancel(TimerId id);
+    //! Is the timer scheduled?
+    /*!
+        \param id - Timer identifier
+        \return 'true' if the timer is scheduled, 'false' if the timer is expired or cancelled
+    */
+    bool IsScheduled(TimerId id) const;
+
+    //! Dispatch all expired timers in the current thread
+    /*!
+        Advances the timing wheel to the current tick of the clock and calls
+        callbacks of all expired timers in a batch.
+
+        Will not block, except for the time of callbacks.
+
+        \return Count of dispatched timers
+    */
+    size_t Poll();
+
+    //! Start the dispatch thread
+    /*!
+        Dispatch thread polls the service once per tick while there are
+        scheduled timers and sleeps until a new timer is scheduled otherwise.
+    */
+    void Start();
+    //! Stop the dispatch thread
+    void Stop();
+
+private:
+    // Timing wheel geometry
+    static const size_t LevelBits = 8;
+    static const size_t LevelSlots = 1 << LevelBits;
+    static const size_t Levels = 4;
+    static const uint32_t None = 0xFFFFFFFF;
+
+    // Timer node in the timing wheel slot list
+    struct Timer
+    {
+        std::shared_ptr<Callback> callback;
+        uint64_t expire;
+        uint64_t period;
+        uint32_t generation;
+        uint32_t slot;
+        uint32_t prev;
+        uint32_t next;
+    };
+
+    const uint64_t _resolution;
+    const Clock _clock;
+
+    mutable CriticalSection _cs;
+    uint64_t _current;
+    size_t _size;
+    uint32_t _free;
+    std::vector<Timer> _timers;
+    std::vector<uint32_t> _wheel;
+
+    // Dispatch batch
+    CriticalSection _poll_cs;
+    std::vector<std::shared_ptr<Callback>> _batch;
+
+    // Dispatch thread
+    ConditionVariable _cv;
+    std::atomic<bool> _stop;
+    std::thread _thread;
+
+    //! Get the current tick of the clock
+    uint64_t NowTick() const { return now() / _resolution; }
+    //! Get the expiration tick for the given timeout
+    uint64_t ExpireTick(const Timespan& timeout) const;
+    //! Find the scheduled timer by its identifier
+    uint32_t Find(TimerId id) const noexcept;
+    //! Allocate a new timer node
+    uint32_t Allocate();
+    //! Release the timer node
+    void Release(uint32_t index);
+    //! Link the timer into the timing wheel slot
+    void Link(uint32_t index);
+    //! Unlink the timer from the timing wheel slot
+    void Unlink(uint32_t index);
+    //! Cascade timers from the given slot into lower levels
+    void Cascade(size_t slot);
+    //! Advance the timing wheel and collect expired timers into the batch
+    void Advance();
+
+    //! Dispatch thread function
+    void DispatchThread();
+};
+
+/*! \example threads_timer_service.cpp Timer service example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_TIMER_SERVICE_H
@@ -0,0 +1,224 @@
+/*!
+    \file wait_strategy.h
+    \brief Wait strategies for lock-free queues definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WAIT_STRATEGY_H
+#define CPPCOMMON_THREADS_WAIT_STRATEGY_H
+
+#include "threads/futex.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace CppCommon {
+
+//! Busy-spin wait strategy
+/*!
+    Busy-spin wait strategy retries the operation in the tight loop. It has
+    the lowest latency, but burns the whole CPU core while waiting.
+
+    Thread-safe.
+*/
+class BusySpinWait
+{
+public:
+    //! Wait until the given condition is satisfied
+    /*!
+        \param condition - Condition to check (usually the operation to try)
+    */
+    template <typename TCondition>
+    void Wait(TCondition condition);
+
+    //! Notify waiters that the condition could be changed
+    void Notify() noexcept {}
+};
+
+//! Pause backoff wait strategy
+/*!
+    Pause backoff wait strategy retries the operation with the exponentially
+    growing count of CPU pause instructions between attempts. It reduces the
+    memory bus pressure and gives resources to the sibling hyper-thread.
+
+    Thread-safe.
+*/
+class BackoffWait
+{
+public:
+    //! Initialize pause backoff wait strategy with the given maximal count of pause instructions
+    /*!
+        \param max_pause - Maximal count of pause instructions between attempts (default is 1024)
+    */
+    explicit BackoffWait(uint32_t max_pause = 1024) noexcept : _max_pause(max_pause) {}
+
+    //! Get the maximal count of pause instructions between attempts
+    uint32_t max_pause() const noexcept { return _max_pause; }
+
+    //! Wait until the given condition is satisfied
+    /*!
+        \param condition - Condition to check (usually the operation to try)
+    */
+    template <typename TCondition>
+    void Wait(TCondition condition);
+
+    //! Notify waiters that the condition could be changed
+    void Notify() noexcept {}
+
+    //! Execute CPU pause instruction
+    static void Pause() noexcept;
+
+private:
+    uint32_t _max_pause;
+};
+
+//! Yield wait strategy
+/*!
+    Yield wait strategy gives the rest of the time slice to other threads
+    between attempts. It keeps the CPU core busy only if there are no other
+    threads ready to run.
+
+    Thread-safe.
+*/
+class YieldWait
+{
+public:
+    //! Wait until the given condition is satisfied
+    /*!
+        \param condition - Condition to check (usually the operation to try)
+    */
+    template <typename TCondition>
+    void Wait(TCondition condition);
+
+    //! Notify waiters that the condition could be changed
+    void Notify() noexcept {}
+};
+
+//! Spin-then-park wait strategy
+/*!
+    Spin-then-park wait strategy spins with pause backoff for the given count
+    of attempts and then parks the waiting thread on the futex. Spinning is
+    disabled on single CPU systems where it only delays the thread which
+    could satisfy the condition. Notify() never enters the kernel when there
+    are no parked waiters, but each call still costs a sequential consistent
+    memory fence (a locked instruction on x86) followed by an atomic load.
+    The fence pairs with the fence of the parking thread, so the concurrent
+    notification could not be lost.
+
+    The same strategy instance must be shared by all producers and consumers
+    of the queue.
+
+    Thread-safe.
+*/
+class SpinParkWait
+{
+public:
+    //! Initialize spin-then-park wait strategy with the given count of spin attempts
+    /*!
+        \param spin - Count of spin attempts before parking (default is 100)
+    */
+    explicit SpinParkWait(uint32_t spin = 100) noexcept : _spin((std::thread::hardware_concurrency() > 1) ? spin : 0), _epoch(0), _waiters(0) {}
+    SpinParkWait(const SpinParkWait&) = delete;
+    SpinParkWait(SpinParkWait&&) = delete;
+    ~SpinParkWait() = default;
+
+    SpinParkWait& operator=(const SpinParkWait&) = delete;
+    SpinParkWait& operator=(SpinParkWait&&) = delete;
+
+    //! Get the count of spin attempts before parking
+    uint32_t spin() const noexcept { return _spin; }
+    //! Get the count of parked waiters
+    uint32_t waiters() const noexcept { return _waiters.load(std::memory_order_relaxed); }
+
+    //! Wait until the given condition is satisfied
+    /*!
+        \param condition - Condition to check (usually the operation to try)
+    */
+    template <typename TCondition>
+    void Wait(TCondition condition);
+
+    //! Notify waiters that the condition could be changed
+    /*!
+        Costs a sequential consistent memory fence and an atomic load if
+        there are no parked waiters. Otherwise wakes up all parked waiters.
+    */
+    void Notify() noexcept;
+
+private:
+    uint32_t _spin;
+    std::atomic<uint32_t> _epoch;
+    std::atomic<uint32_t> _waiters;
+};
+
+//! Enqueue an item into the queue and wait if the queue is full
+/*!
+    Works with any queue which provides 'bool Enqueue(const T& item)' method.
+
+    Will block using the given wait strategy.
+
+    \param queue - Queue
+    \param item - Item to enqueue
+    \param strategy - Wait strategy shared with queue consumers
+*/
+template <class TQueue, typename T, class TWaitStrategy>
+void EnqueueWait(TQueue& queue, const T& item, TWaitStrategy& strategy);
+
+//! Dequeue an item from the queue and wait if the queue is empty
+/*!
+    Works with any queue which provides 'bool Dequeue(T& item)' method.
+
+    Will block using the given wait strategy.
+
+    \param queue - Queue
+    \param item - Item to dequeue
+    \param strategy - Wait strategy shared with queue producers
+*/
+template <class TQueue, typename T, class TWaitStrategy>
+void DequeueWait(TQueue& queue, T& item, TWaitStrategy& strategy);
+
+//! Enqueue a data into the ring buffer and wait if the ring buffer is full
+/*!
+    Works with any ring buffer which provides 'bool Enqueue(const void* data, size_t size)' method.
+
+    Will block using the given wait strategy.
+
+    \param buffer - Ring buffer
+    \param data - Data buffer to enqueue
+    \param size - Data buffer size
+    \param strategy - Wait strategy shared with ring buffer consumers
+*/
+template <class TBuffer, class TWaitStrategy>
+void EnqueueWait(TBuffer& buffer, const void* data, size_t size, TWaitStrategy& strategy);
+
+//! Dequeue a data from the ring buffer and wait if the ring buffer is empty
+/*!
+    Works with any ring buffer which provides 'bool Dequeue(void* data, size_t& size)' method.
+
+    Will block using the given wait strategy.
+
+    \param buffer - Ring buffer
+    \param data - Data buffer to dequeue
+    \param size - Data buffer size
+    \param strategy - Wait strategy shared with ring buffer producers
+*/
+template <class TBuffer, class TWaitStrategy>
+void DequeueWait(TBuffer& buffer, void* data, size_t& size, TWaitStrategy& strategy);
+
+/*! \example threads_wait_strategy.cpp Wait strategies for lock-free queues example */
+
+} // namespace CppCommon
+
+#include "wait_strategy.inl"
+
+#endif // CPPCOMMON_THREADS_WAIT_STRATEGY_H
@@ -0,0 +1,134 @@
+/*!
+    \file wait_strategy.inl
+    \brief Wait strategies for lock-free queues inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename TCondition>
+inline void BusySpinWait::Wait(TCondition condition)
+{
+    while (!condition()) {}
+}
+
+inline void BackoffWait::Pause() noexcept
+{
+#if defined(_MSC_VER)
+    YieldProcessor();
+#elif defined(__i386__) || defined(__x86_64__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+template <typename TCondition>
+inline void BackoffWait::Wait(TCondition condition)
+{
+    uint32_t pause = 1;
+    while (!condition())
+    {
+        for (uint32_t i = 0; i < pause; ++i)
+            Pause();
+
+        // Exponential backoff
+        if (pause < _max_pause)
+            pause *= 2;
+    }
+}
+
+template <typename TCondition>
+inline void YieldWait::Wait(TCondition condition)
+{
+    while (!condition())
+        Thread::Yield();
+}
+
+template <typename TCondition>
+inline void SpinParkWait::Wait(TCondition condition)
+{
+    uint32_t attempts = 0;
+    uint32_t pause = 1;
+
+    for (;;)
+    {
+        if (condition())
+            return;
+
+        // Spin with pause backoff
+        if (attempts < _spin)
+        {
+            ++attempts;
+            for (uint32_t i = 0; i < pause; ++i)
+                BackoffWait::Pause();
+            if (pause < 16)
+                pause *= 2;
+            continue;
+        }
+
+        // Register the waiter and re-check the condition before parking,
+        // so the concurrent notification could not be lost
+        uint32_t epoch = _epoch.load(std::memory_order_acquire);
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (condition())
+        {
+            _waiters.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Park until the epoch is changed by the notifier
+        Futex::Wait(_epoch, epoch);
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+inline void SpinParkWait::Notify() noexcept
+{
+    // Pairs with the fence in Wait() so that either the waiter sees the
+    // changed condition or the notifier sees the registered waiter
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_waiters.load(std::memory_order_relaxed) == 0)
+        return;
+
+    _epoch.fetch_add(1, std::memory_order_release);
+    Futex::WakeAll(_epoch);
+}
+
+template <class TQueue, typename T, class TWaitStrategy>
+inline void EnqueueWait(TQueue& queue, const T& item, TWaitStrategy& strategy)
+{
+    strategy.Wait([&queue, &item]() { return queue.Enqueue(item); });
+    strategy.Notify();
+}
+
+template <class TQueue, typename T, class TWaitStrategy>
+inline void DequeueWait(TQueue& queue, T& item, TWaitStrategy& strategy)
+{
+    strategy.Wait([&queue, &item]() { return queue.Dequeue(item); });
+    strategy.Notify();
+}
+
+template <class TBuffer, class TWaitStrategy>
+inline void EnqueueWait(TBuffer& buffer, const void* data, size_t size, TWaitStrategy& strategy)
+{
+    strategy.Wait([&buffer, data, size]() { return buffer.Enqueue(data, size); });
+    strategy.Notify();
+}
+
+template <class TBuffer, class TWaitStrategy>
+inline void DequeueWait(TBuffer& buffer, void* data, size_t& size, TWaitStrategy& strategy)
+{
+    // Ring buffer resets the size if it is empty
+    const size_t capacity = size;
+    strategy.Wait([&buffer, data, &size, capacity]() { size = capacity; return buffer.Dequeue(data, size); });
+    strategy.Notify();
+}
+
+} // namespace CppCommon
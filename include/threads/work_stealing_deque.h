@@ -0,0 +1,127 @@
+/*!
+    \file work_stealing_deque.h
+    \brief Work-stealing deque definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
+#define CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Work-stealing deque
+/*!
+    Work-stealing deque is a lock-free Chase-Lev deque. The single owner
+    thread pushes and pops items at the bottom of the deque (LIFO order),
+    while any other threads steal items from the top of the deque (FIFO
+    order). The deque grows when it is full. Previous buffers are retained
+    until the deque is destroyed, so concurrent thieves never access the
+    released memory.
+
+    Items must be trivially copyable (e.g. pointers to tasks).
+
+    Thread-safe.
+
+    https://www.dre.vanderbilt.edu/~schmidt/PDF/work-stealing-dequeue.pdf
+    https://fzn.fr/readings/ppopp13.pdf
+*/
+template<typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Work-stealing deque item must be trivially copyable!");
+
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Initial deque capacity (must be a power of two, default is 1024)
+    */
+    explicit WorkStealingDeque(size_t capacity = 1024);
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    //! Check if the deque is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is deque empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get deque capacity
+    size_t capacity() const noexcept { return _array.load(std::memory_order_relaxed)->capacity; }
+    //! Get deque size
+    size_t size() const noexcept;
+
+    //! Push an item into the bottom of the deque (owner thread method)
+    /*!
+        Will not block. The deque grows if it is full.
+
+        \param item - Item to push
+    */
+    void Push(T item);
+
+    //! Pop an item from the bottom of the deque (owner thread method)
+    /*!
+        Will not block.
+
+        \param item - Item to pop
+        \return 'true' if the item was successfully popped, 'false' if the deque is empty
+    */
+    bool Pop(T& item);
+
+    //! Steal an item from the top of the deque (thief threads method)
+    /*!
+        Will not block. May spuriously fail if the item was concurrently
+        stolen or popped by another thread.
+
+        \param item - Item to steal
+        \return 'true' if the item was successfully stolen, 'false' if the deque is empty or the steal was lost
+    */
+    bool Steal(T& item);
+
+private:
+    // Circular array of items
+    struct Array
+    {
+        size_t capacity;
+        size_t mask;
+        std::unique_ptr<std::atomic<T>[]> buffer;
+
+        explicit Array(size_t size) : capacity(size), mask(size - 1), buffer(new std::atomic<T>[size]) {}
+
+        T Get(int64_t index) const noexcept { return buffer[(size_t)index & mask].load(std::memory_order_relaxed); }
+        void Put(int64_t index, T item) noexcept { buffer[(size_t)index & mask].store(item, std::memory_order_relaxed); }
+    };
+
+    typedef char cache_line_pad[128];
+
+    cache_line_pad _pad0;
+    std::atomic<int64_t> _top;
+    cache_line_pad _pad1;
+    std::atomic<int64_t> _bottom;
+    cache_line_pad _pad2;
+    std::atomic<Array*> _array;
+    // All arrays are kept until the deque is destroyed (owner thread only)
+    std::vector<std::unique_ptr<Array>> _arrays;
+    cache_line_pad _pad3;
+
+    //! Grow the deque array twice
+    Array* Grow(Array* array, int64_t top, int64_t bottom);
+};
+
+} // namespace CppCommon
+
+#include "work_stealing_deque.inl"
+
+#endif // CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
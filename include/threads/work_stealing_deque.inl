@@ -0,0 +1,112 @@
+/*!
+    \file work_stealing_deque.inl
+    \brief Work-stealing deque inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : _top(0), _bottom(0)
+{
+    assert((capacity > 1) && "Deque capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Deque capacity must be a power of two!");
+
+    _arrays.emplace_back(std::make_unique<Array>(capacity));
+    _array.store(_arrays.back().get(), std::memory_order_relaxed);
+
+    memset(_pad0, 0, sizeof(cache_line_pad));
+    memset(_pad1, 0, sizeof(cache_line_pad));
+    memset(_pad2, 0, sizeof(cache_line_pad));
+    memset(_pad3, 0, sizeof(cache_line_pad));
+}
+
+template<typename T>
+inline size_t WorkStealingDeque<T>::size() const noexcept
+{
+    int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    int64_t top = _top.load(std::memory_order_relaxed);
+    return (bottom > top) ? (size_t)(bottom - top) : 0;
+}
+
+template<typename T>
+inline void WorkStealingDeque<T>::Push(T item)
+{
+    int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    int64_t top = _top.load(std::memory_order_acquire);
+    Array* array = _array.load(std::memory_order_relaxed);
+
+    // Grow the full deque
+    if ((bottom - top) > (int64_t)(array->capacity - 1))
+        array = Grow(array, top, bottom);
+
+    array->Put(bottom, item);
+    _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Pop(T& item)
+{
+    int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    Array* array = _array.load(std::memory_order_relaxed);
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = _top.load(std::memory_order_relaxed);
+
+    // Empty deque
+    if (top > bottom)
+    {
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    item = array->Get(bottom);
+
+    // Not the last item
+    if (top < bottom)
+        return true;
+
+    // The last item should be raced with thieves
+    bool result = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return result;
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Steal(T& item)
+{
+    int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+    // Empty deque
+    if (top >= bottom)
+        return false;
+
+    Array* array = _array.load(std::memory_order_acquire);
+    T result = array->Get(top);
+
+    // Race with other thieves and the owner
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+
+    item = result;
+    return true;
+}
+
+template<typename T>
+inline typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::Grow(Array* array, int64_t top, int64_t bottom)
+{
+    auto grown = std::make_unique<Array>(array->capacity * 2);
+    for (int64_t i = top; i < bottom; ++i)
+        grown->Put(i, array->Get(i));
+
+    Array* result = grown.get();
+    _arrays.emplace_back(std::move(grown));
+    _array.store(result, std::memory_order_release);
+    return result;
+}
+
+} // namespace CppCommon
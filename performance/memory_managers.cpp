@@ -6,13 +6,25 @@
 
 #include "memory/allocator.h"
 #include "memory/allocator_arena.h"
+#include "memory/allocator_concurrent_arena.h"
 #include "memory/allocator_heap.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_slab.h"
+#include "memory/allocator_stats.h"
+#include "memory/allocator_thread_cache.h"
+#include "threads/critical_section.h"
 
+#include <thread>
 #include <vector>
 
 using namespace CppCommon;
 
+const uint64_t items_to_allocate = 10000000;
+const uint64_t items_to_bump = 1000000;
+const int threads_from = 1;
+const int threads_to = 8;
+const auto threads_settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
 class MemoryManagerFixture : public virtual CppBenchmark::Fixture
 {
 protected:
@@ -62,6 +74,40 @@ protected:
     void Reset() override { manager.reset(); }
 };
 
+class SlabMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manager;
+
+    SlabMemoryManagerFixture() : manager(auxiliary) {}
+
+    void Reset() override { manager.reset(); }
+};
+
+class ThreadCacheMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manager;
+
+    ThreadCacheMemoryManagerFixture() : manager(auxiliary) {}
+
+    void Reset() override { manager.reset(); }
+};
+
+class StatsMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> pool;
+    StatsMemoryManager<PoolMemoryManager<DefaultMemoryManager>> manager;
+
+    StatsMemoryManagerFixture() : pool(auxiliary), manager(pool) {}
+
+    void Reset() override { manager.reset(); }
+};
+
 template <class TMemoryManagerFixture>
 class MallocFixture : public TMemoryManagerFixture
 {
@@ -191,4 +237,207 @@ BENCHMARK_FIXTURE(FreeFixture<PoolMemoryManagerFixture>, "PoolMemoryManager.free
     context.metrics().AddBytes(context.y());
 }
 
+BENCHMARK_FIXTURE(MallocFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.free", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.malloc", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<SlabMemoryManagerFixture>, "SlabMemoryManager.free", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<ThreadCacheMemoryManagerFixture>, "ThreadCacheMemoryManager.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<ThreadCacheMemoryManagerFixture>, "ThreadCacheMemoryManager.free", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<ThreadCacheMemoryManagerFixture>, "ThreadCacheMemoryManager.malloc", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<ThreadCacheMemoryManagerFixture>, "ThreadCacheMemoryManager.free", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<StatsMemoryManagerFixture>, "StatsMemoryManager<PoolMemoryManager>.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<StatsMemoryManagerFixture>, "StatsMemoryManager<PoolMemoryManager>.free", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+// Pool memory manager synchronized with a critical section
+class LockedPoolMemoryManager
+{
+public:
+    explicit LockedPoolMemoryManager(DefaultMemoryManager& auxiliary) : _pool(auxiliary) {}
+
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        Locker<CriticalSection> locker(_lock);
+        return _pool.malloc(size, alignment);
+    }
+
+    void free(void* ptr, size_t size)
+    {
+        Locker<CriticalSection> locker(_lock);
+        _pool.free(ptr, size);
+    }
+
+private:
+    CriticalSection _lock;
+    PoolMemoryManager<DefaultMemoryManager> _pool;
+};
+
+template <class TMemoryManager>
+void malloc_free(CppBenchmark::Context& context, TMemoryManager& manager, size_t size)
+{
+    const int threads_count = context.x();
+    const size_t batch = 64;
+
+    // Start allocation threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manager, size, threads_count]()
+        {
+            void* pointers[batch];
+            uint64_t items = (items_to_allocate / threads_count);
+            for (uint64_t i = 0; i < items; i += batch)
+            {
+                // Allocate and free a batch of memory blocks
+                for (size_t j = 0; j < batch; ++j)
+                    pointers[j] = manager.malloc(size);
+                for (size_t j = 0; j < batch; ++j)
+                    manager.free(pointers[j], size);
+            }
+        });
+    }
+
+    // Wait for all allocation threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(2 * items_to_allocate);
+    context.metrics().AddBytes(items_to_allocate * size);
+}
+
+BENCHMARK("PoolMemoryManager<CriticalSection>.malloc-free-threads", threads_settings)
+{
+    DefaultMemoryManager auxiliary;
+    LockedPoolMemoryManager manager(auxiliary);
+    malloc_free(context, manager, 64);
+}
+
+BENCHMARK("ThreadCacheMemoryManager.malloc-free-threads", threads_settings)
+{
+    DefaultMemoryManager auxiliary;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    malloc_free(context, manager, 64);
+}
+
+// Arena memory manager synchronized with a critical section
+class LockedArenaMemoryManager
+{
+public:
+    explicit LockedArenaMemoryManager(DefaultMemoryManager& auxiliary) : _arena(auxiliary) {}
+
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        Locker<CriticalSection> locker(_lock);
+        return _arena.malloc(size, alignment);
+    }
+
+    void free(void* ptr, size_t size)
+    {
+        Locker<CriticalSection> locker(_lock);
+        _arena.free(ptr, size);
+    }
+
+private:
+    CriticalSection _lock;
+    ArenaMemoryManager<DefaultMemoryManager> _arena;
+};
+
+template <class TMemoryManager>
+void bump_malloc(CppBenchmark::Context& context, TMemoryManager& manager, size_t size)
+{
+    const int threads_count = context.x();
+
+    // Start allocation threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manager, size, threads_count]()
+        {
+            uint64_t items = (items_to_bump / threads_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Arena deallocation only updates allocation statistics
+                void* ptr = manager.malloc(size);
+                manager.free(ptr, size);
+            }
+        });
+    }
+
+    // Wait for all allocation threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_bump);
+    context.metrics().AddBytes(items_to_bump * size);
+}
+
+BENCHMARK("ArenaMemoryManager<CriticalSection>.malloc-threads", threads_settings)
+{
+    DefaultMemoryManager auxiliary;
+    LockedArenaMemoryManager manager(auxiliary);
+    bump_malloc(context, manager, 64);
+}
+
+BENCHMARK("ConcurrentArenaMemoryManager.malloc-threads", threads_settings)
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentArenaMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    bump_malloc(context, manager, 64);
+}
+
 BENCHMARK_MAIN()
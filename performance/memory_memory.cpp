@@ -0,0 +1,48 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "memory/memory.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const auto sizes = CppBenchmark::Settings().Param(64).Param(4096).Param(1024 * 1024).Param(64 * 1024 * 1024);
+
+class MemoryFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::vector<uint8_t> buffer;
+
+    void Initialize(CppBenchmark::Context& context) override { buffer.resize(context.x(), 0); }
+    void Cleanup(CppBenchmark::Context& context) override { buffer.clear(); buffer.shrink_to_fit(); }
+};
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::IsZero", sizes)
+{
+    context.metrics().SetCustom("zero", Memory::IsZero(buffer.data(), buffer.size()) ? 1u : 0u);
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::ZeroFill", sizes)
+{
+    Memory::ZeroFill(buffer.data(), buffer.size());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::RandomFill", sizes)
+{
+    Memory::RandomFill(buffer.data(), buffer.size());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "memset", sizes)
+{
+    memset(buffer.data(), 0, buffer.size());
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,132 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "memory/object_pool.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const int items = 1000000;
+
+struct Order
+{
+    uint64_t id;
+    uint64_t price;
+    uint64_t quantity;
+    uint64_t flags;
+
+    Order(uint64_t i) : id(i), price(i * 2), quantity(i * 3), flags(0) {}
+};
+
+class NewDeleteFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::vector<Order*> orders;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        orders.reserve(items);
+        for (int i = 0; i < items; ++i)
+            orders.push_back(new Order(i));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        for (auto order : orders)
+            delete order;
+        orders.clear();
+    }
+};
+
+class ObjectPoolFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager;
+    ObjectPool<Order> pool;
+    std::vector<uint64_t> handles;
+
+    ObjectPoolFixture() : manager(auxiliary), pool(manager) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        handles.reserve(items);
+        for (int i = 0; i < items; ++i)
+            handles.push_back(pool.create(i));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        pool.clear();
+        handles.clear();
+    }
+};
+
+BENCHMARK("new/delete.create-destroy")
+{
+    std::vector<Order*> orders;
+    orders.reserve(items);
+    for (int i = 0; i < items; ++i)
+        orders.push_back(new Order(i));
+    for (auto order : orders)
+        delete order;
+
+    // Update benchmark metrics
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK("ObjectPool.create-destroy")
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager(auxiliary);
+    ObjectPool<Order> pool(manager);
+
+    std::vector<uint64_t> handles;
+    handles.reserve(items);
+    for (int i = 0; i < items; ++i)
+        handles.push_back(pool.create(i));
+    for (auto handle : handles)
+        pool.destroy(handle);
+
+    // Update benchmark metrics
+    context.metrics().AddItems(items);
+}
+
+BENCHMARK_FIXTURE(NewDeleteFixture, "new/delete.lookup")
+{
+    uint64_t sum = 0;
+    for (auto order : orders)
+        sum += order->price;
+
+    // Update benchmark metrics
+    context.metrics().AddItems(items);
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK_FIXTURE(ObjectPoolFixture, "ObjectPool.lookup")
+{
+    uint64_t sum = 0;
+    for (auto handle : handles)
+        sum += pool.get(handle)->price;
+
+    // Update benchmark metrics
+    context.metrics().AddItems(items);
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK_FIXTURE(ObjectPoolFixture, "ObjectPool.iterate")
+{
+    uint64_t sum = 0;
+    for (const auto& order : pool)
+        sum += order.price;
+
+    // Update benchmark metrics
+    context.metrics().AddItems(items);
+    context.metrics().SetCustom("sum", sum);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,137 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "memory/allocator_arena.h"
+#include "memory/allocator_pmr.h"
+#include "memory/allocator_pool.h"
+
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+using namespace CppCommon;
+
+const int items = 100000;
+
+class NewDeleteResourceFixture
+{
+protected:
+    std::pmr::memory_resource* resource() { return std::pmr::new_delete_resource(); }
+    void Reset() {}
+};
+
+class PoolResourceFixture
+{
+protected:
+    std::pmr::unsynchronized_pool_resource pool;
+
+    std::pmr::memory_resource* resource() { return &pool; }
+    void Reset() { pool.release(); }
+};
+
+class ArenaResourceFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manager;
+    MemoryManagerResource<ArenaMemoryManager<DefaultMemoryManager>> adapter;
+
+    ArenaResourceFixture() : manager(auxiliary), adapter(manager) {}
+
+    std::pmr::memory_resource* resource() { return &adapter; }
+    void Reset() { manager.reset(); }
+};
+
+class PoolMemoryManagerResourceFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager;
+    MemoryManagerResource<PoolMemoryManager<DefaultMemoryManager>> adapter;
+
+    PoolMemoryManagerResourceFixture() : manager(auxiliary), adapter(manager) {}
+
+    std::pmr::memory_resource* resource() { return &adapter; }
+    void Reset() { manager.reset(); }
+};
+
+template <class TResourceFixture>
+class VectorFixture : public virtual CppBenchmark::Fixture, public TResourceFixture
+{
+protected:
+    void Process(CppBenchmark::Context& context)
+    {
+        {
+            std::pmr::vector<int> v(this->resource());
+            for (int i = 0; i < items; ++i)
+                v.push_back(i);
+        }
+        TResourceFixture::Reset();
+
+        // Update benchmark metrics
+        context.metrics().AddItems(items);
+    }
+};
+
+template <class TResourceFixture>
+class HashMapFixture : public virtual CppBenchmark::Fixture, public TResourceFixture
+{
+protected:
+    void Process(CppBenchmark::Context& context)
+    {
+        {
+            std::pmr::unordered_map<int, int> m(this->resource());
+            for (int i = 0; i < items; ++i)
+                m.emplace(i, i);
+        }
+        TResourceFixture::Reset();
+
+        // Update benchmark metrics
+        context.metrics().AddItems(items);
+    }
+};
+
+BENCHMARK_FIXTURE(VectorFixture<NewDeleteResourceFixture>, "std::pmr::vector<new_delete_resource>")
+{
+    this->Process(context);
+}
+
+BENCHMARK_FIXTURE(VectorFixture<PoolResourceFixture>, "std::pmr::vector<unsynchronized_pool_resource>")
+{
+    this->Process(context);
+}
+
+BENCHMARK_FIXTURE(VectorFixture<ArenaResourceFixture>, "std::pmr::vector<ArenaMemoryManager>")
+{
+    this->Process(context);
+}
+
+BENCHMARK_FIXTURE(VectorFixture<PoolMemoryManagerResourceFixture>, "std::pmr::vector<PoolMemoryManager>")
+{
+    this->Process(context);
+}
+
+BENCHMARK_FIXTURE(HashMapFixture<NewDeleteResourceFixture>, "std::pmr::unordered_map<new_delete_resource>")
+{
+    this->Process(context);
+}
+
+BENCHMARK_FIXTURE(HashMapFixture<PoolResourceFixture>, "std::pmr::unordered_map<unsynchronized_pool_resource>")
+{
+    this->Process(context);
+}
+
+BENCHMARK_FIXTURE(HashMapFixture<ArenaResourceFixture>, "std::pmr::unordered_map<ArenaMemoryManager>")
+{
+    this->Process(context);
+}
+
+BENCHMARK_FIXTURE(HashMapFixture<PoolMemoryManagerResourceFixture>, "std::pmr::unordered_map<PoolMemoryManager>")
+{
+    this->Process(context);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,68 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "memory/memory.h"
+#include "memory/memory_telemetry.h"
+
+using namespace CppCommon;
+
+const uint64_t operations = 100000;
+
+class TelemetryFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    MemoryTelemetry telemetry;
+};
+
+BENCHMARK("Memory::RamTotal()")
+{
+    int64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += Memory::RamTotal();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("Memory::RamFree()")
+{
+    int64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += Memory::RamFree();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(TelemetryFixture, "MemoryTelemetry::Usage()")
+{
+    int64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += telemetry.Usage().rss;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_FIXTURE(TelemetryFixture, "MemoryTelemetry::Refresh()")
+{
+    int64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations / 100; ++i)
+        crc += telemetry.Refresh().rss;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations / 100 - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
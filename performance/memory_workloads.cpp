@@ -0,0 +1,556 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "memory/allocator.h"
+#include "memory/allocator_arena.h"
+#include "memory/allocator_concurrent_arena.h"
+#include "memory/allocator_heap.h"
+#include "memory/allocator_page.h"
+#include "memory/allocator_pool.h"
+#include "memory/allocator_slab.h"
+#include "memory/allocator_stats.h"
+#include "memory/allocator_thread_cache.h"
+#include "memory/memory_telemetry.h"
+#include "threads/critical_section.h"
+#include "threads/spsc_ring_queue.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const size_t working_set = 10000;
+const size_t churn_operations = 100000;
+const size_t burst_blocks = 100000;
+const size_t container_items = 20000;
+const size_t transfer_blocks = 100000;
+const size_t min_block = 8;
+const size_t max_block = 32768;
+
+// Get the resident set size of the current process in bytes
+int64_t ResidentMemory()
+{
+    static MemoryTelemetry telemetry;
+    return telemetry.Refresh().rss;
+}
+
+// Generate block sizes from the log-normal distribution (median is about 150 bytes)
+std::vector<size_t> LogNormalSizes(size_t count)
+{
+    std::mt19937_64 generator(12345);
+    std::lognormal_distribution<double> distribution(5.0, 1.5);
+
+    std::vector<size_t> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        result.push_back(std::clamp((size_t)distribution(generator), min_block, max_block));
+    return result;
+}
+
+// Generate random indexes of the working set blocks
+std::vector<size_t> RandomIndexes(size_t count, size_t range)
+{
+    std::mt19937_64 generator(54321);
+    std::uniform_int_distribution<size_t> distribution(0, range - 1);
+
+    std::vector<size_t> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        result.push_back(distribution(generator));
+    return result;
+}
+
+// Touch each memory page of the allocated block to make it resident
+void Touch(void* ptr, size_t size)
+{
+    uint8_t* buffer = (uint8_t*)ptr;
+    for (size_t i = 0; i < size; i += 4096)
+        buffer[i] = 0xFF;
+    buffer[size - 1] = 0xFF;
+}
+
+// Memory manager protected with a critical section to allow cross-thread frees
+template <class TMemoryManager>
+class LockedMemoryManager
+{
+public:
+    template <typename... Args>
+    explicit LockedMemoryManager(Args&&... args) : _manager(std::forward<Args>(args)...) {}
+
+    size_t allocated() const noexcept { return _manager.allocated(); }
+    size_t allocations() const noexcept { return _manager.allocations(); }
+    size_t max_size() const noexcept { return _manager.max_size(); }
+
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t))
+    { Locker<CriticalSection> locker(_lock); return _manager.malloc(size, alignment); }
+    void free(void* ptr, size_t size)
+    { Locker<CriticalSection> locker(_lock); _manager.free(ptr, size); }
+    void reset()
+    { Locker<CriticalSection> locker(_lock); _manager.reset(); }
+
+private:
+    CriticalSection _lock;
+    TMemoryManager _manager;
+};
+
+class DefaultManagerFixture
+{
+protected:
+    typedef DefaultMemoryManager manager_type;
+
+    DefaultMemoryManager manager;
+};
+
+class HeapManagerFixture
+{
+protected:
+    typedef HeapMemoryManager manager_type;
+
+    HeapMemoryManager manager;
+};
+
+class ArenaManagerFixture
+{
+protected:
+    typedef ArenaMemoryManager<DefaultMemoryManager> manager_type;
+
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manager;
+
+    ArenaManagerFixture() : manager(auxiliary) {}
+};
+
+class PoolManagerFixture
+{
+protected:
+    typedef PoolMemoryManager<DefaultMemoryManager> manager_type;
+
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager;
+
+    PoolManagerFixture() : manager(auxiliary) {}
+};
+
+class SlabManagerFixture
+{
+protected:
+    typedef SlabMemoryManager<DefaultMemoryManager> manager_type;
+
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manager;
+
+    SlabManagerFixture() : manager(auxiliary) {}
+};
+
+class PageManagerFixture
+{
+protected:
+    typedef PageMemoryManager manager_type;
+
+    PageMemoryManager manager;
+};
+
+class ConcurrentArenaManagerFixture
+{
+protected:
+    typedef ConcurrentArenaMemoryManager<DefaultMemoryManager> manager_type;
+
+    DefaultMemoryManager auxiliary;
+    ConcurrentArenaMemoryManager<DefaultMemoryManager> manager;
+
+    ConcurrentArenaManagerFixture() : manager(auxiliary) {}
+};
+
+class ThreadCacheManagerFixture
+{
+protected:
+    typedef ThreadCacheMemoryManager<DefaultMemoryManager> manager_type;
+
+    DefaultMemoryManager auxiliary;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manager;
+
+    ThreadCacheManagerFixture() : manager(auxiliary) {}
+};
+
+class LockedDefaultManagerFixture
+{
+protected:
+    typedef LockedMemoryManager<DefaultMemoryManager> manager_type;
+
+    LockedMemoryManager<DefaultMemoryManager> manager;
+};
+
+class LockedPoolManagerFixture
+{
+protected:
+    typedef LockedMemoryManager<PoolMemoryManager<DefaultMemoryManager>> manager_type;
+
+    DefaultMemoryManager auxiliary;
+    LockedMemoryManager<PoolMemoryManager<DefaultMemoryManager>> manager;
+
+    LockedPoolManagerFixture() : manager(auxiliary) {}
+};
+
+// Workload fixture tracks requested memory, resident memory growth and fragmentation.
+// Allocation-tracking mode additionally collects statistics memory manager counters.
+template <class TManagerFixture, bool tracking = false>
+class WorkloadFixture : public virtual CppBenchmark::Fixture, public TManagerFixture
+{
+protected:
+    typedef typename TManagerFixture::manager_type manager_type;
+
+    StatsMemoryManager<manager_type, tracking> tracker;
+    std::vector<size_t> sizes;
+    int64_t resident;
+    size_t requested;
+    size_t peak;
+
+    WorkloadFixture() : tracker(this->manager), resident(0), requested(0), peak(0) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        sizes = LogNormalSizes(std::max(std::max(churn_operations, burst_blocks), transfer_blocks));
+        resident = ResidentMemory();
+        requested = 0;
+        peak = 0;
+        tracker.clear_stats();
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        if constexpr (tracking)
+        {
+            MemoryStats stats = tracker.stats();
+            context.metrics().SetCustom("total_allocations", stats.total_allocations);
+            context.metrics().SetCustom("total_allocated", stats.total_allocated);
+            context.metrics().SetCustom("failures", stats.failures);
+        }
+        sizes.clear();
+    }
+
+    void* Allocate(size_t size)
+    {
+        void* ptr = tracker.malloc(size);
+        Touch(ptr, size);
+        requested += size;
+        peak = std::max(peak, requested);
+        return ptr;
+    }
+
+    void Free(void* ptr, size_t size)
+    {
+        tracker.free(ptr, size);
+        requested -= size;
+    }
+
+    // Update resident memory growth and fragmentation metrics at the peak of the workload
+    void Measure(CppBenchmark::Context& context)
+    {
+        int64_t growth = std::max(ResidentMemory() - resident, (int64_t)0);
+        context.metrics().SetCustom("peak_requested", (uint64_t)peak);
+        context.metrics().SetCustom("rss_growth", growth);
+        if (peak > 0)
+            context.metrics().SetCustom("fragmentation", (double)growth / (double)peak);
+    }
+
+    // Random frees and allocations of log-normal sizes over the fixed working set
+    void Churn(CppBenchmark::Context& context)
+    {
+        std::vector<size_t> indexes = RandomIndexes(churn_operations, working_set);
+        std::vector<std::pair<void*, size_t>> blocks(working_set);
+
+        for (size_t i = 0; i < working_set; ++i)
+            blocks[i] = std::make_pair(Allocate(sizes[i]), sizes[i]);
+
+        for (size_t i = 0; i < churn_operations; ++i)
+        {
+            auto& block = blocks[indexes[i]];
+            Free(block.first, block.second);
+            block = std::make_pair(Allocate(sizes[i]), sizes[i]);
+        }
+
+        Measure(context);
+
+        for (auto& block : blocks)
+            Free(block.first, block.second);
+        tracker.reset();
+
+        // Update benchmark metrics
+        context.metrics().AddItems(churn_operations);
+    }
+
+    // Allocate a burst of log-normal sizes and release all of them at once
+    void Burst(CppBenchmark::Context& context)
+    {
+        std::vector<void*> blocks;
+        blocks.reserve(burst_blocks);
+
+        uint64_t bytes = 0;
+        for (size_t i = 0; i < burst_blocks; ++i)
+        {
+            blocks.push_back(Allocate(sizes[i]));
+            bytes += sizes[i];
+        }
+
+        Measure(context);
+
+        for (size_t i = 0; i < burst_blocks; ++i)
+            Free(blocks[i], sizes[i]);
+        tracker.reset();
+
+        // Update benchmark metrics
+        context.metrics().AddItems(burst_blocks);
+        context.metrics().AddBytes(bytes);
+    }
+
+    // Node based containers workload through Allocator<T>
+    void Containers(CppBenchmark::Context& context)
+    {
+        typedef Allocator<std::pair<const int, int>, StatsMemoryManager<manager_type, tracking>> map_allocator;
+        typedef Allocator<int, StatsMemoryManager<manager_type, tracking>> list_allocator;
+
+        {
+            std::map<int, int, std::less<int>, map_allocator> map((map_allocator(tracker)));
+            std::list<int, list_allocator> list((list_allocator(tracker)));
+
+            for (int i = 0; i < (int)container_items; ++i)
+            {
+                map.emplace((i * 7919) % (int)container_items, i);
+                list.push_back(i);
+            }
+
+            // Erase every second item and insert them again
+            for (auto it = map.begin(); it != map.end();)
+            {
+                it = map.erase(it);
+                if (it != map.end())
+                    ++it;
+            }
+            for (auto it = list.begin(); it != list.end();)
+            {
+                it = list.erase(it);
+                if (it != list.end())
+                    ++it;
+            }
+            for (int i = 0; i < (int)container_items; i += 2)
+            {
+                map.emplace(i, i);
+                list.push_front(i);
+            }
+
+            requested = tracker.allocated();
+            peak = std::max(peak, requested);
+            Measure(context);
+        }
+        tracker.reset();
+
+        // Update benchmark metrics
+        context.metrics().AddItems(container_items * 3);
+    }
+};
+
+// Producer thread allocates blocks which are freed by the consumer thread
+template <class TManagerFixture>
+class TransferFixture : public virtual CppBenchmark::Fixture, public TManagerFixture
+{
+protected:
+    std::vector<size_t> sizes;
+    int64_t resident;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        sizes = LogNormalSizes(transfer_blocks);
+        resident = ResidentMemory();
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        sizes.clear();
+    }
+
+    void Transfer(CppBenchmark::Context& context)
+    {
+        SPSCRingQueue<std::pair<void*, size_t>> queue(1024);
+
+        std::thread consumer([this, &queue]()
+        {
+            std::pair<void*, size_t> block;
+            for (size_t i = 0; i < transfer_blocks; ++i)
+            {
+                while (!queue.Dequeue(block))
+                    std::this_thread::yield();
+                this->manager.free(block.first, block.second);
+            }
+        });
+
+        for (size_t i = 0; i < transfer_blocks; ++i)
+        {
+            std::pair<void*, size_t> block(this->manager.malloc(sizes[i]), sizes[i]);
+            Touch(block.first, block.second);
+            while (!queue.Enqueue(block))
+                std::this_thread::yield();
+        }
+
+        consumer.join();
+
+        context.metrics().SetCustom("rss_growth", std::max(ResidentMemory() - resident, (int64_t)0));
+        this->manager.reset();
+
+        // Update benchmark metrics
+        context.metrics().AddItems(transfer_blocks);
+    }
+};
+
+// Workload fixtures in allocation-tracking mode
+typedef WorkloadFixture<DefaultManagerFixture, true> DefaultTrackingFixture;
+typedef WorkloadFixture<PoolManagerFixture, true> PoolTrackingFixture;
+typedef WorkloadFixture<ThreadCacheManagerFixture, true> ThreadCacheTrackingFixture;
+
+BENCHMARK_FIXTURE(WorkloadFixture<DefaultManagerFixture>, "DefaultMemoryManager.churn")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<HeapManagerFixture>, "HeapMemoryManager.churn")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<PoolManagerFixture>, "PoolMemoryManager.churn")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<SlabManagerFixture>, "SlabMemoryManager.churn")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<PageManagerFixture>, "PageMemoryManager.churn")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<ConcurrentArenaManagerFixture>, "ConcurrentArenaMemoryManager.churn")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<ThreadCacheManagerFixture>, "ThreadCacheMemoryManager.churn")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(DefaultTrackingFixture, "DefaultMemoryManager.churn.tracking")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(PoolTrackingFixture, "PoolMemoryManager.churn.tracking")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(ThreadCacheTrackingFixture, "ThreadCacheMemoryManager.churn.tracking")
+{
+    Churn(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<DefaultManagerFixture>, "DefaultMemoryManager.burst")
+{
+    Burst(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<HeapManagerFixture>, "HeapMemoryManager.burst")
+{
+    Burst(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<ArenaManagerFixture>, "ArenaMemoryManager.burst")
+{
+    Burst(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<PoolManagerFixture>, "PoolMemoryManager.burst")
+{
+    Burst(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<SlabManagerFixture>, "SlabMemoryManager.burst")
+{
+    Burst(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<PageManagerFixture>, "PageMemoryManager.burst")
+{
+    Burst(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<ConcurrentArenaManagerFixture>, "ConcurrentArenaMemoryManager.burst")
+{
+    Burst(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<ThreadCacheManagerFixture>, "ThreadCacheMemoryManager.burst")
+{
+    Burst(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<DefaultManagerFixture>, "DefaultMemoryManager.containers")
+{
+    Containers(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<ArenaManagerFixture>, "ArenaMemoryManager.containers")
+{
+    Containers(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<PoolManagerFixture>, "PoolMemoryManager.containers")
+{
+    Containers(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<SlabManagerFixture>, "SlabMemoryManager.containers")
+{
+    Containers(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<PageManagerFixture>, "PageMemoryManager.containers")
+{
+    Containers(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<ConcurrentArenaManagerFixture>, "ConcurrentArenaMemoryManager.containers")
+{
+    Containers(context);
+}
+
+BENCHMARK_FIXTURE(WorkloadFixture<ThreadCacheManagerFixture>, "ThreadCacheMemoryManager.containers")
+{
+    Containers(context);
+}
+
+BENCHMARK_FIXTURE(TransferFixture<LockedDefaultManagerFixture>, "LockedDefaultMemoryManager.cross-thread")
+{
+    Transfer(context);
+}
+
+BENCHMARK_FIXTURE(TransferFixture<LockedPoolManagerFixture>, "LockedPoolMemoryManager.cross-thread")
+{
+    Transfer(context);
+}
+
+BENCHMARK_FIXTURE(TransferFixture<ThreadCacheManagerFixture>, "ThreadCacheMemoryManager.cross-thread")
+{
+    Transfer(context);
+}
+
+BENCHMARK_MAIN()
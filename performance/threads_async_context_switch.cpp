@@ -0,0 +1,183 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/async_event_auto_reset.h"
+#include "threads/async_wait_queue.h"
+#include "threads/event_auto_reset.h"
+#include "threads/thread_pool.h"
+#include "threads/wait_queue.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+const uint64_t round_trips = 1000000;
+
+Task<> EventPing(AsyncEventAutoReset& ping, AsyncEventAutoReset& pong, Executor& executor)
+{
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        ping.Signal();
+        co_await pong.Wait(executor);
+    }
+}
+
+Task<> EventPong(AsyncEventAutoReset& ping, AsyncEventAutoReset& pong, Executor& executor)
+{
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        co_await ping.Wait(executor);
+        pong.Signal();
+    }
+}
+
+Task<> QueuePing(AsyncWaitQueue<uint64_t>& ping, AsyncWaitQueue<uint64_t>& pong, Executor& executor, uint64_t& crc)
+{
+    uint64_t item;
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        co_await ping.Enqueue(i, executor);
+        co_await pong.Dequeue(item, executor);
+        crc += item;
+    }
+}
+
+Task<> QueuePong(AsyncWaitQueue<uint64_t>& ping, AsyncWaitQueue<uint64_t>& pong, Executor& executor)
+{
+    uint64_t item;
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        co_await ping.Dequeue(item, executor);
+        co_await pong.Enqueue(item, executor);
+    }
+}
+
+void ping_pong_events(CppBenchmark::Context& context, Executor& executor)
+{
+    AsyncEventAutoReset ping;
+    AsyncEventAutoReset pong;
+
+    // Start the pong coroutine and wait for the ping coroutine
+    Task<> task = EventPong(ping, pong, executor);
+    task.Start();
+    SyncWait(EventPing(ping, pong, executor));
+    while (!task.done())
+        Thread::Yield();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(round_trips * 2);
+    context.metrics().AddItems(round_trips);
+}
+
+void ping_pong_queues(CppBenchmark::Context& context, Executor& executor)
+{
+    uint64_t crc = 0;
+    AsyncWaitQueue<uint64_t> ping;
+    AsyncWaitQueue<uint64_t> pong;
+
+    // Start the pong coroutine and wait for the ping coroutine
+    Task<> task = QueuePong(ping, pong, executor);
+    task.Start();
+    SyncWait(QueuePing(ping, pong, executor, crc));
+    while (!task.done())
+        Thread::Yield();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(round_trips * 2);
+    context.metrics().AddItems(round_trips);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("EventAutoReset-threads")
+{
+    EventAutoReset ping;
+    EventAutoReset pong;
+
+    // Start the pong thread
+    auto thread = std::thread([&ping, &pong]()
+    {
+        for (uint64_t i = 0; i < round_trips; ++i)
+        {
+            ping.Wait();
+            pong.Signal();
+        }
+    });
+
+    // Perform ping-pong round trips
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        ping.Signal();
+        pong.Wait();
+    }
+
+    // Wait for the pong thread
+    thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(round_trips * 2);
+    context.metrics().AddItems(round_trips);
+}
+
+BENCHMARK("AsyncEventAutoReset-inline")
+{
+    ping_pong_events(context, Executor::Inline());
+}
+
+BENCHMARK("AsyncEventAutoReset-pool")
+{
+    ThreadPool pool(2);
+    PoolExecutor<ThreadPool> executor(pool);
+    ping_pong_events(context, executor);
+}
+
+BENCHMARK("WaitQueue-threads")
+{
+    uint64_t crc = 0;
+    WaitQueue<uint64_t> ping;
+    WaitQueue<uint64_t> pong;
+
+    // Start the pong thread
+    auto thread = std::thread([&ping, &pong]()
+    {
+        uint64_t item;
+        for (uint64_t i = 0; i < round_trips; ++i)
+        {
+            ping.Dequeue(item);
+            pong.Enqueue(item);
+        }
+    });
+
+    // Perform ping-pong round trips
+    uint64_t item;
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        ping.Enqueue(i);
+        pong.Dequeue(item);
+        crc += item;
+    }
+
+    // Wait for the pong thread
+    thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(round_trips * 2);
+    context.metrics().AddItems(round_trips);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("AsyncWaitQueue-inline")
+{
+    ping_pong_queues(context, Executor::Inline());
+}
+
+BENCHMARK("AsyncWaitQueue-pool")
+{
+    ThreadPool pool(2);
+    PoolExecutor<ThreadPool> executor(pool);
+    ping_pong_queues(context, executor);
+}
+
+BENCHMARK_MAIN()
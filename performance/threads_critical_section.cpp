@@ -5,6 +5,7 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "threads/critical_section.h"
+#include "threads/futex_critical_section.h"
 
 #include <thread>
 #include <vector>
@@ -16,14 +17,12 @@ const int producers_from = 1;
 const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
-void produce(CppBenchmark::Context& context)
+template <class TLock>
+void produce(CppBenchmark::Context& context, TLock& lock)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
-    // Create critical section synchronization primitive
-    CriticalSection lock;
-
     // Start producer threads
     std::vector<std::thread> producers;
     for (int producer = 0; producer < producers_count; ++producer)
@@ -33,7 +32,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<CriticalSection> locker(lock);
+                Locker<TLock> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -50,7 +49,14 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("CriticalSection", settings)
 {
-    produce(context);
+    CriticalSection lock;
+    produce(context, lock);
+}
+
+BENCHMARK("FutexCriticalSection", settings)
+{
+    FutexCriticalSection lock;
+    produce(context, lock);
 }
 
 BENCHMARK_MAIN()
@@ -6,6 +6,7 @@
 
 #include "threads/mpmc_ring_queue.h"
 
+#include <algorithm>
 #include <functional>
 #include <thread>
 #include <vector>
@@ -16,6 +17,10 @@ const uint64_t items_to_produce = 10000000;
 const int producers_from = 1;
 const int producers_to = 8;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const int bulk_producers = 4;
+const int batch_from = 1;
+const int batch_to = 256;
+const auto bulk_settings = CppBenchmark::Settings().ParamRange(batch_from, batch_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
 
 template<typename T, uint64_t N>
 void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
@@ -82,4 +87,89 @@ BENCHMARK("MPMCRingQueue<YieldWait>-producers", settings)
     produce_consume<int, 1048576>(context, []{ std::this_thread::yield(); });
 }
 
+template<typename T, uint64_t N>
+void produce_consume_bulk(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int producers_count = bulk_producers;
+    const size_t batch = context.x();
+    uint64_t crc = 0;
+
+    // Create multiple producers / multiple consumers wait-free ring queue
+    MPMCRingQueue<T> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc, batch]()
+    {
+        std::vector<T> items(batch);
+        uint64_t consumed = 0;
+        while (consumed < items_to_produce)
+        {
+            // Dequeue the batch using the given waiting strategy
+            size_t count = queue.DequeueBulk(items.begin(), batch);
+            if (count == 0)
+            {
+                wait_strategy();
+                continue;
+            }
+
+            // Consume the batch
+            for (size_t i = 0; i < count; ++i)
+                crc += items[i];
+            consumed += count;
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &wait_strategy, producer, producers_count, batch]()
+        {
+            std::vector<T> buffer(batch);
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; i += batch)
+            {
+                size_t count = (size_t)std::min((uint64_t)batch, items - i);
+                for (size_t j = 0; j < count; ++j)
+                    buffer[j] = (T)(items * producer + i + j);
+
+                // Enqueue the batch using the given waiting strategy
+                size_t enqueued = 0;
+                while (enqueued < count)
+                {
+                    size_t result = queue.EnqueueBulk(buffer.begin() + enqueued, buffer.begin() + count);
+                    if (result == 0)
+                        wait_strategy();
+                    enqueued += result;
+                }
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("MPMCRingQueue.capacity", N);
+    context.metrics().SetCustom("MPMCRingQueue.producers", producers_count);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait>-batch", bulk_settings)
+{
+    produce_consume_bulk<int, 1048576>(context, []{});
+}
+
+BENCHMARK("MPMCRingQueue<YieldWait>-batch", bulk_settings)
+{
+    produce_consume_bulk<int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
 BENCHMARK_MAIN()
@@ -5,7 +5,10 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "threads/rw_lock.h"
+#include "threads/scalable_rw_lock.h"
+#include "threads/thread.h"
 
+#include <atomic>
 #include <thread>
 #include <vector>
 
@@ -19,6 +22,12 @@ const int writers_to = 32;
 const auto settings = CppBenchmark::Settings().PairRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          writers_from, writers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+const uint64_t items_to_read = 100000000;
+const int read_mostly_readers_from = 1;
+const int read_mostly_readers_to = 64;
+const auto read_mostly_settings = CppBenchmark::Settings().ParamRange(read_mostly_readers_from, read_mostly_readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int readers_count = context.x();
@@ -27,7 +36,7 @@ void produce(CppBenchmark::Context& context)
     uint64_t writers_crc = 0;
 
     // Create read/write lock synchronization primitive
-    RWLock lock;
+    TLock lock;
 
     // Start readers threads
     std::vector<std::thread> readers;
@@ -38,7 +47,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / readers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                ReadLocker<RWLock> locker(lock);
+                ReadLocker<TLock> locker(lock);
                 readers_crc += (reader * items) + i;
             }
         });
@@ -53,7 +62,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / writers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                WriteLocker<RWLock> locker(lock);
+                WriteLocker<TLock> locker(lock);
                 writers_crc += (writer * items) + i;
             }
         });
@@ -73,9 +82,83 @@ void produce(CppBenchmark::Context& context)
     context.metrics().SetCustom("CRC-Writers", writers_crc);
 }
 
+template <class TLock>
+void read_mostly(CppBenchmark::Context& context)
+{
+    const int readers_count = context.x();
+    std::atomic<uint64_t> readers_crc(0);
+    std::atomic<int> readers_active(readers_count);
+    uint64_t writes = 0;
+    uint64_t value = 0;
+
+    // Create read/write lock synchronization primitive
+    TLock lock;
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&lock, &readers_crc, &readers_active, &value, readers_count]()
+        {
+            uint64_t crc = 0;
+            uint64_t items = (items_to_read / readers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                ReadLocker<TLock> locker(lock);
+                crc += value;
+            }
+            readers_crc += crc;
+            --readers_active;
+        });
+    }
+
+    // Start the single writer thread which rarely updates the value
+    std::thread writer([&lock, &readers_active, &value, &writes]()
+    {
+        while (readers_active > 0)
+        {
+            {
+                WriteLocker<TLock> locker(lock);
+                ++value;
+                ++writes;
+            }
+
+            // Sleep for a while...
+            Thread::Sleep(1);
+        }
+    });
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    // Wait for the writer thread
+    writer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_read - 1);
+    context.metrics().SetCustom("CRC-Readers", readers_crc.load());
+    context.metrics().SetCustom("Writes", writes);
+}
+
 BENCHMARK("RWLock", settings)
 {
-    produce(context);
+    produce<RWLock>(context);
+}
+
+BENCHMARK("ScalableRWLock", settings)
+{
+    produce<ScalableRWLock>(context);
+}
+
+BENCHMARK("RWLock-ReadMostly", read_mostly_settings)
+{
+    read_mostly<RWLock>(context);
+}
+
+BENCHMARK("ScalableRWLock-ReadMostly", read_mostly_settings)
+{
+    read_mostly<ScalableRWLock>(context);
 }
 
 BENCHMARK_MAIN()
@@ -5,6 +5,7 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "threads/semaphore.h"
+#include "threads/futex_semaphore.h"
 
 #include <thread>
 #include <vector>
@@ -19,15 +20,12 @@ const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().PairRange(semaphore_from, semaphore_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
-void produce(CppBenchmark::Context& context)
+template <class TLock>
+void produce(CppBenchmark::Context& context, TLock& lock)
 {
-    const int semaphore_count = context.x();
     const int producers_count = context.y();
     uint64_t crc = 0;
 
-    // Create semaphore synchronization primitive
-    Semaphore lock(semaphore_count);
-
     // Start producer threads
     std::vector<std::thread> producers;
     for (int producer = 0; producer < producers_count; ++producer)
@@ -37,7 +35,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<Semaphore> locker(lock);
+                Locker<TLock> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -54,7 +52,14 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("Semaphore", settings)
 {
-    produce(context);
+    Semaphore lock(context.x());
+    produce(context, lock);
+}
+
+BENCHMARK("FutexSemaphore", settings)
+{
+    FutexSemaphore lock(context.x());
+    produce(context, lock);
 }
 
 BENCHMARK_MAIN()
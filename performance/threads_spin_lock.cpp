@@ -4,7 +4,10 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "threads/clh_spin_lock.h"
+#include "threads/mcs_spin_lock.h"
 #include "threads/spin_lock.h"
+#include "threads/ticket_spin_lock.h"
 
 #include <thread>
 #include <vector>
@@ -16,13 +19,14 @@ const int producers_from = 1;
 const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
     // Create spin-lock synchronization primitive
-    SpinLock lock;
+    TLock lock;
 
     // Start producer threads
     std::vector<std::thread> producers;
@@ -33,7 +37,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<SpinLock> locker(lock);
+                Locker<TLock> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -50,7 +54,22 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("SpinLock", settings)
 {
-    produce(context);
+    produce<SpinLock>(context);
+}
+
+BENCHMARK("TicketSpinLock", settings)
+{
+    produce<TicketSpinLock>(context);
+}
+
+BENCHMARK("MCSSpinLock", settings)
+{
+    produce<MCSSpinLock>(context);
+}
+
+BENCHMARK("CLHSpinLock", settings)
+{
+    produce<CLHSpinLock>(context);
 }
 
 BENCHMARK_MAIN()
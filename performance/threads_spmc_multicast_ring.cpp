@@ -0,0 +1,196 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/spmc_multicast_ring.h"
+#include "threads/spsc_ring_queue.h"
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int consumers_from = 1;
+const int consumers_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(consumers_from, consumers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template<typename T, uint64_t N>
+void produce_consume_multicast(CppBenchmark::Context& context, bool batch, bool pipeline, const std::function<void()>& wait_strategy)
+{
+    const int consumers_count = context.x();
+    std::vector<uint64_t> crcs(consumers_count, 0);
+
+    // Create single producer / multiple consumers wait-free multicast ring
+    SPMCMulticastRing<T> ring(N);
+
+    // Register independent consumers or the pipeline of dependent stages
+    std::vector<size_t> indexes;
+    for (int i = 0; i < consumers_count; ++i)
+    {
+        if (pipeline && (i > 0))
+            indexes.push_back(ring.AddConsumer({ indexes.back() }));
+        else
+            indexes.push_back(ring.AddConsumer());
+    }
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < consumers_count; ++i)
+    {
+        consumers.emplace_back([&ring, &wait_strategy, &crcs, batch, i, index = indexes[i]]()
+        {
+            uint64_t crc = 0;
+            uint64_t consumed = 0;
+            while (consumed < items_to_produce)
+            {
+                if (batch)
+                {
+                    // Consume a batch of items in place
+                    size_t count = ring.Consume(index, [&crc](T& item) { crc += item; });
+                    if (count == 0)
+                        wait_strategy();
+                    consumed += count;
+                }
+                else
+                {
+                    // Dequeue using the given waiting strategy
+                    T item;
+                    while (!ring.Dequeue(index, item))
+                        wait_strategy();
+
+                    // Consume the item
+                    crc += item;
+                    ++consumed;
+                }
+            }
+            crcs[i] = crc;
+        });
+    }
+
+    // Start producer thread
+    auto producer = std::thread([&ring, &wait_strategy]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Enqueue using the given waiting strategy
+            while (!ring.Enqueue((T)i))
+                wait_strategy();
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for consumer threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    uint64_t crc = 0;
+    for (auto consumer_crc : crcs)
+        crc += consumer_crc;
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce * consumers_count);
+    context.metrics().AddBytes(items_to_produce * consumers_count * sizeof(T));
+    context.metrics().SetCustom("SPMCMulticastRing.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+template<typename T, uint64_t N>
+void produce_consume_queues(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int consumers_count = context.x();
+    std::vector<uint64_t> crcs(consumers_count, 0);
+
+    // Create single producer / single consumer wait-free ring queue for each consumer
+    std::vector<std::unique_ptr<SPSCRingQueue<T>>> queues;
+    for (int i = 0; i < consumers_count; ++i)
+        queues.emplace_back(std::make_unique<SPSCRingQueue<T>>(N));
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < consumers_count; ++i)
+    {
+        consumers.emplace_back([&wait_strategy, &crcs, i, &queue = *queues[i]]()
+        {
+            uint64_t crc = 0;
+            for (uint64_t j = 0; j < items_to_produce; ++j)
+            {
+                // Dequeue using the given waiting strategy
+                T item;
+                while (!queue.Dequeue(item))
+                    wait_strategy();
+
+                // Consume the item
+                crc += item;
+            }
+            crcs[i] = crc;
+        });
+    }
+
+    // Start producer thread
+    auto producer = std::thread([&queues, &wait_strategy]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Enqueue a copy of the item into each queue using the given waiting strategy
+            for (auto& queue : queues)
+                while (!queue->Enqueue((T)i))
+                    wait_strategy();
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for consumer threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    uint64_t crc = 0;
+    for (auto consumer_crc : crcs)
+        crc += consumer_crc;
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce * consumers_count);
+    context.metrics().AddBytes(items_to_produce * consumers_count * sizeof(T));
+    context.metrics().SetCustom("SPSCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("SPMCMulticastRing<SpinWait>", settings)
+{
+    produce_consume_multicast<int, 1048576>(context, false, false, []{});
+}
+
+BENCHMARK("SPMCMulticastRing<YieldWait>", settings)
+{
+    produce_consume_multicast<int, 1048576>(context, false, false, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("SPMCMulticastRing-Batch<YieldWait>", settings)
+{
+    produce_consume_multicast<int, 1048576>(context, true, false, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("SPMCMulticastRing-Pipeline<YieldWait>", settings)
+{
+    produce_consume_multicast<int, 1048576>(context, true, true, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("N x SPSCRingQueue<SpinWait>", settings)
+{
+    produce_consume_queues<int, 1048576>(context, []{});
+}
+
+BENCHMARK("N x SPSCRingQueue<YieldWait>", settings)
+{
+    produce_consume_queues<int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK_MAIN()
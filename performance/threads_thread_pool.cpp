@@ -0,0 +1,156 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/thread_pool.h"
+#include "threads/wait_queue.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const int fibonacci_n = 30;
+const int fibonacci_cutoff = 16;
+const uint64_t tasks_to_post = 1000000;
+const int threads_from = 1;
+const int threads_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Simple thread pool with the single shared wait queue
+class SharedQueuePool
+{
+public:
+    explicit SharedQueuePool(size_t threads) : _pending(0)
+    {
+        for (size_t i = 0; i < threads; ++i)
+        {
+            _threads.emplace_back([this]()
+            {
+                std::function<void()> task;
+                while (_queue.Dequeue(task))
+                {
+                    task();
+                    if (--_pending == 0)
+                    {
+                        Locker<CriticalSection> locker(_cs);
+                        _cv.NotifyAll();
+                    }
+                }
+            });
+        }
+    }
+
+    ~SharedQueuePool()
+    {
+        _queue.Close();
+        for (auto& thread : _threads)
+            thread.join();
+    }
+
+    void Post(std::function<void()> task)
+    {
+        ++_pending;
+        _queue.Enqueue(std::move(task));
+    }
+
+    void Wait()
+    {
+        Locker<CriticalSection> locker(_cs);
+        _cv.Wait(_cs, [this]() { return (_pending == 0); });
+    }
+
+private:
+    WaitQueue<std::function<void()>> _queue;
+    std::vector<std::thread> _threads;
+    std::atomic<uint64_t> _pending;
+    CriticalSection _cs;
+    ConditionVariable _cv;
+};
+
+uint64_t Fibonacci(int n)
+{
+    return (n < 2) ? n : Fibonacci(n - 1) + Fibonacci(n - 2);
+}
+
+uint64_t Fibonacci(ThreadPool& pool, int n, uint64_t& tasks)
+{
+    if (n < fibonacci_cutoff)
+        return Fibonacci(n);
+
+    ++tasks;
+    uint64_t child_tasks = 0;
+    auto child = pool.Submit([&pool, n, &child_tasks]() { return Fibonacci(pool, n - 1, child_tasks); });
+    uint64_t result = Fibonacci(pool, n - 2, tasks);
+    result += child.Get();
+    tasks += child_tasks;
+    return result;
+}
+
+BENCHMARK("ThreadPool-fork-join", settings)
+{
+    ThreadPool pool(context.x());
+
+    uint64_t tasks = 0;
+    uint64_t crc = pool.Submit([&pool, &tasks]() { return Fibonacci(pool, fibonacci_n, tasks); }).Get();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(tasks);
+    context.metrics().AddItems(tasks);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("ThreadPool-fan-out", settings)
+{
+    ThreadPool pool(context.x());
+
+    std::atomic<uint64_t> crc(0);
+    for (uint64_t i = 0; i < tasks_to_post; ++i)
+        pool.Post([&crc, i]() { crc.fetch_add(i, std::memory_order_relaxed); });
+    pool.Wait();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(tasks_to_post);
+    context.metrics().AddItems(tasks_to_post);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("ThreadPool-fan-out-nested", settings)
+{
+    ThreadPool pool(context.x());
+
+    // Fan out from the worker so tasks are spread by stealing
+    std::atomic<uint64_t> crc(0);
+    pool.Post([&pool, &crc]()
+    {
+        for (uint64_t i = 0; i < tasks_to_post; ++i)
+            pool.Post([&crc, i]() { crc.fetch_add(i, std::memory_order_relaxed); });
+    });
+    pool.Wait();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(tasks_to_post);
+    context.metrics().AddItems(tasks_to_post);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("SharedQueuePool-fan-out", settings)
+{
+    SharedQueuePool pool(context.x());
+
+    std::atomic<uint64_t> crc(0);
+    for (uint64_t i = 0; i < tasks_to_post; ++i)
+        pool.Post([&crc, i]() { crc.fetch_add(i, std::memory_order_relaxed); });
+    pool.Wait();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(tasks_to_post);
+    context.metrics().AddItems(tasks_to_post);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,101 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/timer_service.h"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+using namespace CppCommon;
+
+const int timers = 1000000;
+const int heartbeats = 100000;
+const int ticks = 1000;
+
+class TimerServiceFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    uint64_t clock;
+    TimerService service;
+    std::vector<TimerService::TimerId> ids;
+    uint64_t fired;
+
+    TimerServiceFixture() : clock(0), service(Timespan::milliseconds(1), [this]() { return clock; }), fired(0) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        // Schedule heartbeat timers of sessions evenly over the second
+        ids.reserve(heartbeats);
+        for (int i = 0; i < heartbeats; ++i)
+            ids.push_back(service.Schedule(Timespan::milliseconds(1 + (i % ticks)), [this]() { ++fired; }, Timespan::seconds(1)));
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        for (auto id : ids)
+            service.Cancel(id);
+        ids.clear();
+    }
+};
+
+BENCHMARK("std::multimap.schedule-cancel")
+{
+    std::multimap<uint64_t, std::function<void()>> queue;
+    std::vector<std::multimap<uint64_t, std::function<void()>>::iterator> ids;
+    ids.reserve(timers);
+
+    for (int i = 0; i < timers; ++i)
+        ids.push_back(queue.emplace(1 + (i * 7919) % 100000, []() {}));
+    for (auto id : ids)
+        queue.erase(id);
+
+    // Update benchmark metrics
+    context.metrics().AddItems(timers);
+}
+
+BENCHMARK("TimerService.schedule-cancel")
+{
+    uint64_t clock = 0;
+    TimerService service(Timespan::milliseconds(1), [&clock]() { return clock; });
+    std::vector<TimerService::TimerId> ids;
+    ids.reserve(timers);
+
+    for (int i = 0; i < timers; ++i)
+        ids.push_back(service.Schedule(Timespan::milliseconds(1 + (i * 7919) % 100000), []() {}));
+    for (auto id : ids)
+        service.Cancel(id);
+
+    // Update benchmark metrics
+    context.metrics().AddItems(timers);
+}
+
+BENCHMARK_FIXTURE(TimerServiceFixture, "TimerService.reschedule")
+{
+    // Each session activity postpones its heartbeat
+    for (int i = 0; i < timers; ++i)
+        service.Reschedule(ids[i % heartbeats], Timespan::milliseconds(1 + (i % ticks)));
+
+    // Update benchmark metrics
+    context.metrics().AddItems(timers);
+}
+
+BENCHMARK_FIXTURE(TimerServiceFixture, "TimerService.poll")
+{
+    // Dispatch heartbeats over the simulated second
+    uint64_t dispatched = 0;
+    for (int i = 0; i < ticks; ++i)
+    {
+        clock += Timespan::milliseconds(1).total();
+        dispatched += service.Poll();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddItems(dispatched);
+    context.metrics().SetCustom("fired", fired);
+}
+
+BENCHMARK_MAIN()
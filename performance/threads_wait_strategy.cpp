@@ -0,0 +1,158 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/spsc_ring_queue.h"
+#include "threads/wait_strategy.h"
+
+#include <ctime>
+#include <thread>
+
+using namespace CppCommon;
+
+const uint64_t round_trips = 100000;
+const uint64_t bursts = 100;
+const uint64_t burst_items = 1000;
+const auto burst_pause = Timespan::microseconds(500);
+
+// Process CPU time in nanoseconds
+uint64_t ProcessTime()
+{
+    return (uint64_t)std::clock() * (1000000000 / CLOCKS_PER_SEC);
+}
+
+template <class TWaitStrategy>
+void ping_pong(CppBenchmark::Context& context, TWaitStrategy& strategy)
+{
+    uint64_t crc = 0;
+
+    SPSCRingQueue<uint64_t> ping(1024);
+    SPSCRingQueue<uint64_t> pong(1024);
+
+    uint64_t wall = Timestamp::nano();
+    uint64_t cpu = ProcessTime();
+
+    // Echo thread returns each received item back
+    auto echo = std::thread([&ping, &pong, &strategy]()
+    {
+        for (uint64_t i = 0; i < round_trips; ++i)
+        {
+            uint64_t item;
+            DequeueWait(ping, item, strategy);
+            EnqueueWait(pong, item, strategy);
+        }
+    });
+
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        uint64_t item;
+        EnqueueWait(ping, i, strategy);
+        DequeueWait(pong, item, strategy);
+        crc += item;
+    }
+
+    echo.join();
+
+    wall = Timestamp::nano() - wall;
+    cpu = ProcessTime() - cpu;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(round_trips);
+    context.metrics().AddItems(2 * round_trips);
+    context.metrics().SetCustom("latency.round_trip_ns", (uint64_t)(wall / round_trips));
+    context.metrics().SetCustom("cpu.utilization", (double)cpu / (double)wall);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+template <class TWaitStrategy>
+void bursty(CppBenchmark::Context& context, TWaitStrategy& strategy)
+{
+    uint64_t crc = 0;
+
+    SPSCRingQueue<uint64_t> queue(1024);
+
+    uint64_t wall = Timestamp::nano();
+    uint64_t cpu = ProcessTime();
+
+    // Consumer thread waits for items most of the time
+    auto consumer = std::thread([&queue, &strategy, &crc]()
+    {
+        for (uint64_t i = 0; i < (bursts * burst_items); ++i)
+        {
+            uint64_t item;
+            DequeueWait(queue, item, strategy);
+            crc += item;
+        }
+    });
+
+    // Producer sends bursts of items with pauses between them
+    for (uint64_t burst = 0; burst < bursts; ++burst)
+    {
+        for (uint64_t i = 0; i < burst_items; ++i)
+            EnqueueWait(queue, burst * burst_items + i, strategy);
+        Thread::SleepFor(burst_pause);
+    }
+
+    consumer.join();
+
+    wall = Timestamp::nano() - wall;
+    cpu = ProcessTime() - cpu;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(bursts * burst_items);
+    context.metrics().AddItems(bursts * burst_items);
+    context.metrics().SetCustom("cpu.utilization", (double)cpu / (double)wall);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("PingPong<BusySpinWait>")
+{
+    BusySpinWait strategy;
+    ping_pong(context, strategy);
+}
+
+BENCHMARK("PingPong<BackoffWait>")
+{
+    BackoffWait strategy;
+    ping_pong(context, strategy);
+}
+
+BENCHMARK("PingPong<YieldWait>")
+{
+    YieldWait strategy;
+    ping_pong(context, strategy);
+}
+
+BENCHMARK("PingPong<SpinParkWait>")
+{
+    SpinParkWait strategy;
+    ping_pong(context, strategy);
+}
+
+BENCHMARK("Bursty<BusySpinWait>")
+{
+    BusySpinWait strategy;
+    bursty(context, strategy);
+}
+
+BENCHMARK("Bursty<BackoffWait>")
+{
+    BackoffWait strategy;
+    bursty(context, strategy);
+}
+
+BENCHMARK("Bursty<YieldWait>")
+{
+    YieldWait strategy;
+    bursty(context, strategy);
+}
+
+BENCHMARK("Bursty<SpinParkWait>")
+{
+    SpinParkWait strategy;
+    bursty(context, strategy);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,257 @@
+/*!
+    \file allocator_page.cpp
+    \brief Page memory allocator implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_page.h"
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdio>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#undef max
+#undef min
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+// Prefault mapped pages by touching each of them
+void PrefaultPages(void* ptr, size_t length, size_t page)
+{
+    volatile uint8_t* buffer = (volatile uint8_t*)ptr;
+    for (size_t offset = 0; offset < length; offset += page)
+        buffer[offset] = 0;
+}
+
+#endif
+
+#if defined(__linux__) && defined(SYS_mbind)
+
+// Bind mapped pages to the given NUMA node with a preferred policy
+void BindPages(void* ptr, size_t length, int node)
+{
+    const int MPOL_PREFERRED_POLICY = 1;
+
+    unsigned long mask[1024 / (8 * sizeof(unsigned long))] = { 0 };
+    if ((node < 0) || ((size_t)node >= (8 * sizeof(mask))))
+        return;
+
+    mask[node / (8 * sizeof(unsigned long))] |= 1ul << (node % (8 * sizeof(unsigned long)));
+
+    // NUMA binding is an optimization hint, so ignore errors on non-NUMA systems
+    syscall(SYS_mbind, ptr, length, MPOL_PREFERRED_POLICY, mask, 8 * sizeof(mask), 0);
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+PageMemoryManager::PageMemoryManager(Flags<PageFlags> flags, int node)
+    : _allocated(0),
+      _allocations(0),
+      _fallbacks(0),
+      _flags(flags),
+      _node(node),
+      _granularity(PageSize())
+{
+    // Round blocks to the huge page size if huge pages are requested
+    if (_flags.isset(PageFlags::HUGEPAGES))
+    {
+        size_t huge = HugePageSize();
+        if (huge > _granularity)
+            _granularity = huge;
+    }
+}
+
+size_t PageMemoryManager::PageSize() noexcept
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return page;
+#elif defined(_WIN32) || defined(_WIN64)
+    static size_t page = []()
+    {
+        SYSTEM_INFO si;
+        GetSystemInfo(&si);
+        return (size_t)si.dwPageSize;
+    }();
+    return page;
+#endif
+}
+
+size_t PageMemoryManager::HugePageSize() noexcept
+{
+#if defined(__linux__)
+    static size_t huge = []()
+    {
+        size_t result = 0;
+
+        // Parse the default huge page size from '/proc/meminfo'
+        FILE* file = fopen("/proc/meminfo", "r");
+        if (file != nullptr)
+        {
+            char line[256];
+            while (fgets(line, sizeof(line), file) != nullptr)
+            {
+                unsigned long long value = 0;
+                if (sscanf(line, "Hugepagesize: %llu kB", &value) == 1)
+                {
+                    result = (size_t)value * 1024;
+                    break;
+                }
+            }
+            fclose(file);
+        }
+
+        return result;
+    }();
+    return huge;
+#elif defined(_WIN32) || defined(_WIN64)
+    static size_t huge = (size_t)GetLargePageMinimum();
+    return huge;
+#else
+    return 0;
+#endif
+}
+
+void* PageMemoryManager::MapPages(size_t length, size_t alignment)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    bool huge = false;
+    bool populate = _flags.isset(PageFlags::POPULATE);
+    bool transparent = _flags.isset(PageFlags::TRANSPARENT);
+
+    // Reserve extra space to align the block manually
+    size_t extra = (alignment > _granularity) ? alignment : 0;
+
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_POPULATE)
+    // Populate pages during the mapping only if there is nothing to apply before the first touch
+    int populate_flags = (populate && (_node < 0) && !transparent) ? MAP_POPULATE : 0;
+#else
+    int populate_flags = 0;
+#endif
+
+    void* ptr = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    // Try to map explicit huge pages
+    if (_flags.isset(PageFlags::HUGEPAGES) && (HugePageSize() > 0))
+    {
+        ptr = mmap(nullptr, length + extra, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB | populate_flags, -1, 0);
+        if (ptr != MAP_FAILED)
+            huge = true;
+        else
+            ++_fallbacks;
+    }
+#else
+    if (_flags.isset(PageFlags::HUGEPAGES))
+        ++_fallbacks;
+#endif
+
+    // Map regular pages
+    if (ptr == MAP_FAILED)
+    {
+        ptr = mmap(nullptr, length + extra, PROT_READ | PROT_WRITE, flags | populate_flags, -1, 0);
+        if (ptr == MAP_FAILED)
+            return nullptr;
+    }
+
+    // Trim the mapping to the required alignment
+    if (extra > 0)
+    {
+        uint8_t* buffer = (uint8_t*)ptr;
+        uint8_t* aligned = Memory::Align(buffer, alignment);
+        size_t head = aligned - buffer;
+        size_t tail = extra - head;
+        if (head > 0)
+            munmap(buffer, head);
+        if (tail > 0)
+            munmap(aligned + length, tail);
+        ptr = aligned;
+    }
+
+#if defined(MADV_HUGEPAGE)
+    // Advise transparent huge pages for regular pages (also fallback for explicit huge pages)
+    if (!huge && (transparent || _flags.isset(PageFlags::HUGEPAGES)))
+        madvise(ptr, length, MADV_HUGEPAGE);
+#endif
+
+#if defined(__linux__) && defined(SYS_mbind)
+    // Bind pages to the NUMA node before the first touch
+    if (_node >= 0)
+        Internals::BindPages(ptr, length, _node);
+#endif
+
+    // Prefault pages manually if they were not populated during the mapping
+    if (populate && (populate_flags == 0))
+        Internals::PrefaultPages(ptr, length, huge ? _granularity : PageSize());
+
+    return ptr;
+#elif defined(_WIN32) || defined(_WIN64)
+    assert((alignment <= 65536) && "Alignment of page memory blocks must not be greater than the allocation granularity!");
+
+    HANDLE process = GetCurrentProcess();
+    DWORD type = MEM_RESERVE | MEM_COMMIT;
+    void* ptr = nullptr;
+
+    // Try to allocate large pages
+    if (_flags.isset(PageFlags::HUGEPAGES))
+    {
+        if (HugePageSize() > 0)
+        {
+            if (_node >= 0)
+                ptr = VirtualAllocExNuma(process, nullptr, length, type | MEM_LARGE_PAGES, PAGE_READWRITE, (DWORD)_node);
+            else
+                ptr = VirtualAlloc(nullptr, length, type | MEM_LARGE_PAGES, PAGE_READWRITE);
+        }
+        if (ptr == nullptr)
+            ++_fallbacks;
+        else
+            return ptr;
+    }
+
+    // Allocate regular pages
+    if (_node >= 0)
+        ptr = VirtualAllocExNuma(process, nullptr, length, type, PAGE_READWRITE, (DWORD)_node);
+    else
+        ptr = VirtualAlloc(nullptr, length, type, PAGE_READWRITE);
+    if (ptr == nullptr)
+        return nullptr;
+
+    // Prefault pages
+    if (_flags.isset(PageFlags::POPULATE))
+    {
+        volatile uint8_t* buffer = (volatile uint8_t*)ptr;
+        for (size_t offset = 0; offset < length; offset += PageSize())
+            buffer[offset] = 0;
+    }
+
+    return ptr;
+#endif
+}
+
+void PageMemoryManager::UnmapPages(void* ptr, size_t length)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    munmap(ptr, length);
+#elif defined(_WIN32) || defined(_WIN64)
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#endif
+}
+
+} // namespace CppCommon
@@ -0,0 +1,397 @@
+/*!
+    \file heap_profiler.cpp
+    \brief Sampling heap profiler implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/heap_profiler.h"
+
+#include "threads/critical_section.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <optional>
+#include <unordered_map>
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#include <execinfo.h>
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+const int MaxFrames = 64;
+const size_t FilterSize = 16384;
+
+// Heap profiler flags are constant initialized, so they are safe to use from operator new during static initialization
+std::atomic<bool> profiler_running(false);
+std::atomic<size_t> profiler_rate(512 * 1024);
+std::atomic<uint64_t> profiler_sampled(0);
+// Counting filter of sampled blocks
+std::atomic<uint32_t> profiler_filter[FilterSize];
+
+// Thread sampler state
+struct ThreadSampler
+{
+    int64_t countdown;
+    uint64_t random;
+    bool initialized;
+    bool busy;
+};
+
+thread_local ThreadSampler sampler = { 0, 0, false, false };
+
+// Thread sampler busy guard prevents recursive profiling of profiler allocations
+class SamplerGuard
+{
+public:
+    SamplerGuard() noexcept : _busy(sampler.busy) { sampler.busy = true; }
+    ~SamplerGuard() noexcept { sampler.busy = _busy; }
+
+    bool busy() const noexcept { return _busy; }
+
+private:
+    bool _busy;
+};
+
+// Heap profiler allocation site
+struct Site
+{
+    StackTrace stack;
+    uint64_t samples;
+    uint64_t allocated;
+    uint64_t live;
+    uint64_t peak;
+};
+
+// Heap profiler sampled block
+struct Sample
+{
+    uint64_t site;
+    uint64_t weight;
+};
+
+// Heap profiler state
+struct ProfilerState
+{
+    CriticalSection lock;
+    std::unordered_map<uint64_t, Site> sites;
+    std::unordered_map<void*, Sample> samples;
+    uint64_t live;
+    uint64_t peak;
+
+    ProfilerState() : live(0), peak(0) {}
+};
+
+ProfilerState& GetProfilerState()
+{
+    // Profiler state is never destroyed, because deallocations could be recorded after static destructors
+    static ProfilerState* state = new ProfilerState();
+    return *state;
+}
+
+size_t FilterIndex(void* ptr) noexcept
+{
+    uint64_t hash = ((uint64_t)(uintptr_t)ptr >> 4) * 0x9E3779B97F4A7C15ull;
+    return (size_t)(hash >> 32) & (FilterSize - 1);
+}
+
+// Get the next sampling interval from the exponential distribution
+int64_t NextInterval(ThreadSampler& state) noexcept
+{
+    // Random generator (xorshift64*)
+    state.random ^= state.random >> 12;
+    state.random ^= state.random << 25;
+    state.random ^= state.random >> 27;
+    uint64_t random = state.random * 0x2545F4914F6CDD1Dull;
+
+    // Uniform random value in range (0, 1]
+    double uniform = ((random >> 11) + 1) * (1.0 / 9007199254740992.0);
+
+    int64_t interval = (int64_t)(-std::log(uniform) * (double)profiler_rate.load(std::memory_order_relaxed));
+    return (interval > 0) ? interval : 1;
+}
+
+// Calculate the estimated bytes represented by the sampled block
+uint64_t SampleWeight(size_t size) noexcept
+{
+    double rate = (double)profiler_rate.load(std::memory_order_relaxed);
+    if ((double)size >= (16 * rate))
+        return size;
+
+    // Sampling probability of the block is 1 - exp(-size / rate)
+    double probability = 1.0 - std::exp(-(double)size / rate);
+    return (uint64_t)((double)size / probability);
+}
+
+void SampleAllocation(void* ptr, size_t size)
+{
+    // Capture raw stack frames to identify the allocation site
+    void* frames[MaxFrames];
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    int captured = backtrace(frames, MaxFrames);
+#elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+    int captured = CaptureStackBackTrace(0, MaxFrames, frames, nullptr);
+#else
+    int captured = 0;
+#endif
+
+    // Calculate the allocation site hash (FNV-1a)
+    uint64_t hash = 14695981039346656037ull;
+    for (int i = 0; i < captured; ++i)
+    {
+        hash ^= (uint64_t)(uintptr_t)frames[i];
+        hash *= 1099511628211ull;
+    }
+
+    uint64_t weight = SampleWeight(size);
+
+    ProfilerState& state = GetProfilerState();
+
+    bool found;
+    {
+        Locker<CriticalSection> locker(state.lock);
+        found = (state.sites.find(hash) != state.sites.end());
+    }
+
+    // Capture the symbolized stack trace only once per allocation site and outside of the profiler lock
+    std::optional<StackTrace> stack;
+    if (!found)
+        stack.emplace(2);
+
+    Locker<CriticalSection> locker(state.lock);
+
+    auto it = state.sites.find(hash);
+    if (it == state.sites.end())
+    {
+        // Allocation site was cleared by the profiler restart
+        if (!stack)
+            return;
+
+        it = state.sites.emplace(hash, Site{ std::move(*stack), 0, 0, 0, 0 }).first;
+    }
+
+    // Update allocation site statistics
+    Site& current = it->second;
+    ++current.samples;
+    current.allocated += weight;
+    current.live += weight;
+    current.peak = std::max(current.peak, current.live);
+
+    // Update heap statistics
+    state.live += weight;
+    state.peak = std::max(state.peak, state.live);
+
+    // Register the sampled block
+    auto result = state.samples.emplace(ptr, Sample{ hash, weight });
+    if (result.second)
+    {
+        profiler_filter[FilterIndex(ptr)].fetch_add(1, std::memory_order_relaxed);
+        profiler_sampled.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+        result.first->second = Sample{ hash, weight };
+}
+
+void SampleDeallocation(void* ptr)
+{
+    ProfilerState& state = GetProfilerState();
+
+    Locker<CriticalSection> locker(state.lock);
+
+    auto it = state.samples.find(ptr);
+    if (it == state.samples.end())
+        return;
+
+    // Update allocation site statistics
+    auto site = state.sites.find(it->second.site);
+    if (site != state.sites.end())
+        site->second.live -= it->second.weight;
+
+    // Update heap statistics
+    state.live -= it->second.weight;
+
+    // Unregister the sampled block
+    state.samples.erase(it);
+    profiler_filter[FilterIndex(ptr)].fetch_sub(1, std::memory_order_relaxed);
+    profiler_sampled.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace Internals
+//! @endcond
+
+void HeapProfiler::Start(size_t rate)
+{
+    assert((rate > 0) && "Sampling rate must be greater than zero!");
+
+    Internals::SamplerGuard guard;
+
+    Internals::ProfilerState& state = Internals::GetProfilerState();
+
+    Locker<CriticalSection> locker(state.lock);
+
+    // Clear the previous heap profile
+    state.sites.clear();
+    state.samples.clear();
+    state.live = 0;
+    state.peak = 0;
+    for (auto& counter : Internals::profiler_filter)
+        counter.store(0, std::memory_order_relaxed);
+    Internals::profiler_sampled.store(0, std::memory_order_relaxed);
+
+    Internals::profiler_rate.store(rate, std::memory_order_relaxed);
+    Internals::profiler_running.store(true, std::memory_order_release);
+}
+
+void HeapProfiler::Stop()
+{
+    Internals::profiler_running.store(false, std::memory_order_release);
+}
+
+bool HeapProfiler::IsRunning() noexcept
+{
+    return Internals::profiler_running.load(std::memory_order_acquire);
+}
+
+size_t HeapProfiler::GetRate() noexcept
+{
+    return Internals::profiler_rate.load(std::memory_order_relaxed);
+}
+
+void HeapProfiler::RecordAllocation(void* ptr, size_t size) noexcept
+{
+    if ((ptr == nullptr) || !Internals::profiler_running.load(std::memory_order_relaxed))
+        return;
+
+    Internals::ThreadSampler& sampler = Internals::sampler;
+    if (sampler.busy)
+        return;
+
+    // Fast path: count allocated bytes until the next sample
+    sampler.countdown -= (int64_t)size;
+    if (sampler.countdown > 0)
+        return;
+
+    // Initialize the thread sampler with the first sampling interval
+    if (!sampler.initialized)
+    {
+        sampler.random = (uint64_t)(uintptr_t)&sampler ^ Timestamp::nano() ^ 0x9E3779B97F4A7C15ull;
+        if (sampler.random == 0)
+            sampler.random = 1;
+        sampler.initialized = true;
+        sampler.countdown += Internals::NextInterval(sampler);
+        if (sampler.countdown > 0)
+            return;
+    }
+
+    sampler.countdown = Internals::NextInterval(sampler);
+
+    Internals::SamplerGuard guard;
+
+    try
+    {
+        Internals::SampleAllocation(ptr, size);
+    }
+    catch (...)
+    {
+        // Profiler must not affect the profiled allocation
+    }
+}
+
+void HeapProfiler::RecordDeallocation(void* ptr) noexcept
+{
+    // Fast path: check the counting filter of sampled blocks
+    if ((ptr == nullptr) || (Internals::profiler_sampled.load(std::memory_order_relaxed) == 0))
+        return;
+    if (Internals::profiler_filter[Internals::FilterIndex(ptr)].load(std::memory_order_relaxed) == 0)
+        return;
+
+    Internals::SamplerGuard guard;
+    if (guard.busy())
+        return;
+
+    try
+    {
+        Internals::SampleDeallocation(ptr);
+    }
+    catch (...)
+    {
+        // Profiler must not affect the profiled deallocation
+    }
+}
+
+uint64_t HeapProfiler::GetLive()
+{
+    Internals::SamplerGuard guard;
+
+    Internals::ProfilerState& state = Internals::GetProfilerState();
+
+    Locker<CriticalSection> locker(state.lock);
+    return state.live;
+}
+
+uint64_t HeapProfiler::GetPeak()
+{
+    Internals::SamplerGuard guard;
+
+    Internals::ProfilerState& state = Internals::GetProfilerState();
+
+    Locker<CriticalSection> locker(state.lock);
+    return state.peak;
+}
+
+std::vector<HeapProfileSite> HeapProfiler::GetSites(size_t top)
+{
+    Internals::SamplerGuard guard;
+
+    std::vector<HeapProfileSite> result;
+
+    Internals::ProfilerState& state = Internals::GetProfilerState();
+
+    {
+        Locker<CriticalSection> locker(state.lock);
+
+        result.reserve(state.sites.size());
+        for (const auto& site : state.sites)
+            result.push_back(HeapProfileSite{ site.second.stack, site.second.samples, site.second.allocated, site.second.live, site.second.peak });
+    }
+
+    // Sort allocation sites by live bytes, then by total allocated bytes
+    std::sort(result.begin(), result.end(), [](const HeapProfileSite& site1, const HeapProfileSite& site2)
+    {
+        if (site1.live != site2.live)
+            return site1.live > site2.live;
+        return site1.allocated > site2.allocated;
+    });
+
+    if (result.size() > top)
+        result.resize(top);
+
+    return result;
+}
+
+void HeapProfiler::Dump(std::ostream& stream, size_t top)
+{
+    std::vector<HeapProfileSite> sites = GetSites(top);
+
+    Internals::SamplerGuard guard;
+
+    stream << "Heap profile (sampling rate " << GetRate() << " bytes): live " << GetLive() << " bytes, peak " << GetPeak() << " bytes" << std::endl;
+    for (size_t i = 0; i < sites.size(); ++i)
+    {
+        const HeapProfileSite& site = sites[i];
+        stream << "#" << i << " live " << site.live << " bytes, peak " << site.peak << " bytes, allocated " << site.allocated << " bytes, samples " << site.samples << std::endl;
+        for (const auto& frame : site.stack.frames())
+            stream << "    " << frame << std::endl;
+    }
+}
+
+} // namespace CppCommon
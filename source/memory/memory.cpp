@@ -26,34 +26,257 @@
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <wincrypt.h>
+#undef max
+#undef min
 #endif
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CPPCOMMON_MEMORY_SIMD 1
+#define CPPCOMMON_TARGET(features) __attribute__((target(features)))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+#include <immintrin.h>
+#include <intrin.h>
+#define CPPCOMMON_MEMORY_SIMD 1
+#define CPPCOMMON_TARGET(features)
+#endif
+
+#include <random>
+#include <vector>
+
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+// Check if the given memory buffer is filled with zeros (scalar implementation)
+bool IsZeroScalar(const uint8_t* ptr, size_t size) noexcept
+{
+    // Check unaligned head bytes
+    while ((size > 0) && (((uintptr_t)ptr & (sizeof(uint64_t) - 1)) != 0))
+    {
+        if (*ptr++ != 0)
+            return false;
+        --size;
+    }
+
+    // Check aligned words
+    const uint64_t* words = (const uint64_t*)ptr;
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t))
+        if (*words++ != 0)
+            return false;
+
+    // Check tail bytes
+    ptr = (const uint8_t*)words;
+    while (size-- > 0)
+        if (*ptr++ != 0)
+            return false;
+
+    return true;
+}
+
+#if defined(CPPCOMMON_MEMORY_SIMD)
+
+// CPU features required by SIMD implementations
+struct CpuFeatures
+{
+    bool sse2;
+    bool avx2;
+    bool avx512;
+
+    CpuFeatures() noexcept : sse2(false), avx2(false), avx512(false)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        int ids = info[0];
+        __cpuid(info, 1);
+        sse2 = (info[3] & (1 << 26)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        if (osxsave && (ids >= 7))
+        {
+            // Check if the operating system saves AVX and AVX-512 registers
+            unsigned long long xcr0 = _xgetbv(0);
+            bool ymm = (xcr0 & 0x06) == 0x06;
+            bool zmm = (xcr0 & 0xE6) == 0xE6;
+            __cpuidex(info, 7, 0);
+            avx2 = ymm && ((info[1] & (1 << 5)) != 0);
+            avx512 = zmm && ((info[1] & (1 << 16)) != 0) && ((info[1] & (1 << 30)) != 0);
+        }
+#else
+        __builtin_cpu_init();
+        sse2 = __builtin_cpu_supports("sse2");
+        avx2 = __builtin_cpu_supports("avx2");
+        avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#endif
+    }
+};
+
+const CpuFeatures& GetCpuFeatures() noexcept
+{
+    static CpuFeatures features;
+    return features;
+}
+
+// Check if the given memory buffer is filled with zeros (SSE2 implementation)
+CPPCOMMON_TARGET("sse2")
+bool IsZeroSSE2(const uint8_t* ptr, size_t size) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    for (; size >= 64; ptr += 64, size -= 64)
+    {
+        __m128i x0 = _mm_loadu_si128((const __m128i*)(ptr + 0));
+        __m128i x1 = _mm_loadu_si128((const __m128i*)(ptr + 16));
+        __m128i x2 = _mm_loadu_si128((const __m128i*)(ptr + 32));
+        __m128i x3 = _mm_loadu_si128((const __m128i*)(ptr + 48));
+        __m128i x = _mm_or_si128(_mm_or_si128(x0, x1), _mm_or_si128(x2, x3));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero)) != 0xFFFF)
+            return false;
+    }
+    return IsZeroScalar(ptr, size);
+}
+
+// Check if the given memory buffer is filled with zeros (AVX2 implementation)
+CPPCOMMON_TARGET("avx2")
+bool IsZeroAVX2(const uint8_t* ptr, size_t size) noexcept
+{
+    for (; size >= 128; ptr += 128, size -= 128)
+    {
+        __m256i x0 = _mm256_loadu_si256((const __m256i*)(ptr + 0));
+        __m256i x1 = _mm256_loadu_si256((const __m256i*)(ptr + 32));
+        __m256i x2 = _mm256_loadu_si256((const __m256i*)(ptr + 64));
+        __m256i x3 = _mm256_loadu_si256((const __m256i*)(ptr + 96));
+        __m256i x = _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3));
+        if (!_mm256_testz_si256(x, x))
+            return false;
+    }
+    return IsZeroScalar(ptr, size);
+}
+
+// Check if the given memory buffer is filled with zeros (AVX-512 implementation)
+CPPCOMMON_TARGET("avx512f,avx512bw")
+bool IsZeroAVX512(const uint8_t* ptr, size_t size) noexcept
+{
+    for (; size >= 256; ptr += 256, size -= 256)
+    {
+        __m512i x0 = _mm512_loadu_si512((const void*)(ptr + 0));
+        __m512i x1 = _mm512_loadu_si512((const void*)(ptr + 64));
+        __m512i x2 = _mm512_loadu_si512((const void*)(ptr + 128));
+        __m512i x3 = _mm512_loadu_si512((const void*)(ptr + 192));
+        __m512i x = _mm512_or_si512(_mm512_or_si512(x0, x1), _mm512_or_si512(x2, x3));
+        if (_mm512_test_epi64_mask(x, x) != 0)
+            return false;
+    }
+    return IsZeroScalar(ptr, size);
+}
+
+// Fill the given memory buffer with zeros using non-temporal stores (SSE2 implementation)
+CPPCOMMON_TARGET("sse2")
+void ZeroFillStreamSSE2(uint8_t* ptr, size_t size) noexcept
+{
+    // Fill unaligned head bytes
+    size_t head = (16 - ((uintptr_t)ptr & 15)) & 15;
+    if (head > size)
+        head = size;
+    memset(ptr, 0, head);
+    ptr += head;
+    size -= head;
+
+    // Stream aligned blocks bypassing the cache
+    const __m128i zero = _mm_setzero_si128();
+    for (; size >= 64; ptr += 64, size -= 64)
+    {
+        _mm_stream_si128((__m128i*)(ptr + 0), zero);
+        _mm_stream_si128((__m128i*)(ptr + 16), zero);
+        _mm_stream_si128((__m128i*)(ptr + 32), zero);
+        _mm_stream_si128((__m128i*)(ptr + 48), zero);
+    }
+    _mm_sfence();
+
+    // Fill tail bytes
+    memset(ptr, 0, size);
+}
+
+#endif
+
+// Fast non-cryptographic random generator (xoshiro256** with independent lanes)
+class RandomGenerator
+{
+public:
+    static const size_t Lanes = 4;
+
+    RandomGenerator()
+    {
+        std::random_device device;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            for (size_t j = 0; j < Lanes; ++j)
+            {
+                _state[i][j] = ((uint64_t)device() << 32) | device();
+                // State must not be all zeros
+                if (_state[i][j] == 0)
+                    _state[i][j] = 0x9E3779B97F4A7C15ull;
+            }
+        }
+    }
+
+    // Generate the next random words of all lanes
+    void Next(uint64_t (&result)[Lanes]) noexcept
+    {
+        // Independent lanes are processed in the same loop to allow the vectorization
+        for (size_t j = 0; j < Lanes; ++j)
+        {
+            uint64_t s1 = _state[1][j];
+            result[j] = Rotl(s1 * 5, 7) * 9;
+            uint64_t t = s1 << 17;
+            _state[2][j] ^= _state[0][j];
+            _state[3][j] ^= s1;
+            _state[1][j] ^= _state[2][j];
+            _state[0][j] ^= _state[3][j];
+            _state[2][j] ^= t;
+            _state[3][j] = Rotl(_state[3][j], 45);
+        }
+    }
+
+private:
+    uint64_t _state[4][Lanes];
+
+    static uint64_t Rotl(uint64_t x, int k) noexcept { return (x << k) | (x >> (64 - k)); }
+};
+
+} // namespace Internals
+//! @endcond
+
 int64_t Memory::RamTotal()
 {
+    // Total RAM does not change during the process lifetime
+    static int64_t total = []()
+    {
 #if defined(__APPLE__)
-    int64_t memsize = 0;
-    size_t size = sizeof(memsize);
-    if (sysctlbyname("hw.memsize", &memsize, &size, nullptr, 0) == 0)
-        return memsize;
+        int64_t memsize = 0;
+        size_t size = sizeof(memsize);
+        if (sysctlbyname("hw.memsize", &memsize, &size, nullptr, 0) == 0)
+            return memsize;
 
-    return -1;
+        return (int64_t)-1;
 #elif defined(unix) || defined(__unix) || defined(__unix__)
-    int64_t pages = sysconf(_SC_PHYS_PAGES);
-    int64_t page_size = sysconf(_SC_PAGESIZE);
-    if ((pages > 0) && (page_size > 0))
-        return pages * page_size;
+        int64_t pages = sysconf(_SC_PHYS_PAGES);
+        int64_t page_size = sysconf(_SC_PAGESIZE);
+        if ((pages > 0) && (page_size > 0))
+            return pages * page_size;
 
-    return -1;
+        return (int64_t)-1;
 #elif defined(_WIN32) || defined(_WIN64)
-    MEMORYSTATUSEX status;
-    status.dwLength = sizeof(status);
-    GlobalMemoryStatusEx(&status);
-    return status.ullTotalPhys;
+        MEMORYSTATUSEX status;
+        status.dwLength = sizeof(status);
+        GlobalMemoryStatusEx(&status);
+        return (int64_t)status.ullTotalPhys;
 #else
-    #error Unsupported platform
+        #error Unsupported platform
 #endif
+    }();
+
+    return total;
 }
 
 int64_t Memory::RamFree()
@@ -92,21 +315,88 @@ int64_t Memory::RamFree()
 #endif
 }
 
+size_t Memory::CacheSize()
+{
+    static size_t cache = []()
+    {
+        // Default last level cache size
+        size_t result = 8 * 1024 * 1024;
+
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+        long size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (size <= 0)
+            size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        if (size > 0)
+            result = (size_t)size;
+#elif defined(__APPLE__)
+        int64_t size = 0;
+        size_t length = sizeof(size);
+        if ((sysctlbyname("hw.l3cachesize", &size, &length, nullptr, 0) == 0) && (size > 0))
+            result = (size_t)size;
+        else if ((sysctlbyname("hw.l2cachesize", &size, &length, nullptr, 0) == 0) && (size > 0))
+            result = (size_t)size;
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD length = 0;
+        GetLogicalProcessorInformation(nullptr, &length);
+        if (length > 0)
+        {
+            std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> buffer(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+            if (GetLogicalProcessorInformation(buffer.data(), &length))
+            {
+                size_t level = 0;
+                for (const auto& info : buffer)
+                {
+                    if ((info.Relationship == RelationCache) && (info.Cache.Level >= level))
+                    {
+                        level = info.Cache.Level;
+                        result = (size_t)info.Cache.Size;
+                    }
+                }
+            }
+        }
+#endif
+
+        return result;
+    }();
+    return cache;
+}
+
 bool Memory::IsZero(const void* buffer, size_t size) noexcept
 {
-    const char* ptr = (const char*)buffer;
-    for (size_t i = 0; i < size; ++i)
-        if (ptr[i] != 0)
-            return false;
-    return true;
+    const uint8_t* ptr = (const uint8_t*)buffer;
+
+#if defined(CPPCOMMON_MEMORY_SIMD)
+    const Internals::CpuFeatures& features = Internals::GetCpuFeatures();
+    if (features.avx512)
+        return Internals::IsZeroAVX512(ptr, size);
+    if (features.avx2)
+        return Internals::IsZeroAVX2(ptr, size);
+    if (features.sse2)
+        return Internals::IsZeroSSE2(ptr, size);
+#endif
+
+    return Internals::IsZeroScalar(ptr, size);
 }
 
 void Memory::ZeroFill(void* buffer, size_t size)
 {
+#if defined(CPPCOMMON_MEMORY_SIMD)
+    // Stream huge buffers bypassing the cache
+    if ((size > CacheSize()) && Internals::GetCpuFeatures().sse2)
+    {
+        Internals::ZeroFillStreamSSE2((uint8_t*)buffer, size);
+        return;
+    }
+#endif
+
 #ifdef __STDC_LIB_EXT1__
     memset_s(buffer, size, 0, size);
 #elif defined(_WIN32) || defined(_WIN64)
     SecureZeroMemory(buffer, size);
+#elif defined(__GNUC__) || defined(__clang__)
+    memset(buffer, 0, size);
+    // Prevent the compiler from eliminating the fill of the dead buffer
+    __asm__ __volatile__("" : : "r"(buffer) : "memory");
 #else
     volatile char* ptr = (volatile char*)buffer;
     while (size--)
@@ -116,21 +406,26 @@ void Memory::ZeroFill(void* buffer, size_t size)
 
 void Memory::RandomFill(void* buffer, size_t size)
 {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    int fd = open("/dev/urandom", O_RDONLY);
-    if (fd < 0)
-        throwex SystemException("Cannot open '/dev/urandom' file for reading!");
-    ssize_t count = read(fd, buffer, size);
-    if (count < 0)
-        throwex SystemException("Cannot read from '/dev/urandom' file!");
-    int result = close(fd);
-    if (result != 0)
-        throwex SystemException("Cannot close '/dev/urandom' file!");
-#elif defined(_WIN32) || defined(_WIN64)
-    char* ptr = (char*)buffer;
-    for(size_t i = 0; i < size; ++i)
-        ptr[i] = rand() % 256;
-#endif
+    thread_local Internals::RandomGenerator generator;
+
+    uint8_t* ptr = (uint8_t*)buffer;
+    uint64_t words[Internals::RandomGenerator::Lanes];
+
+    // Fill the buffer with random words of all lanes
+    while (size >= sizeof(words))
+    {
+        generator.Next(words);
+        memcpy(ptr, words, sizeof(words));
+        ptr += sizeof(words);
+        size -= sizeof(words);
+    }
+
+    // Fill tail bytes
+    if (size > 0)
+    {
+        generator.Next(words);
+        memcpy(ptr, words, size);
+    }
 }
 
 void Memory::CryptoFill(void* buffer, size_t size)
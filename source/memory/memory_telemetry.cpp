@@ -0,0 +1,352 @@
+/*!
+    \file memory_telemetry.cpp
+    \brief Process memory telemetry implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/memory_telemetry.h"
+
+#include "memory/memory.h"
+#include "threads/critical_section.h"
+#include "time/timestamp.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+namespace CppCommon {
+
+MemoryUsage::MemoryUsage() noexcept
+    : timestamp(0), detailed(0),
+      ram_total(-1), ram_free(-1),
+      rss(-1), pss(-1), anonymous(-1), file(-1), shmem(-1), swap(-1), huge_pages(-1), hugetlb(-1),
+      cgroup_limit(-1), cgroup_usage(-1),
+      minor_faults(-1), major_faults(-1)
+{
+}
+
+//! @cond INTERNALS
+
+class MemoryTelemetry::Impl
+{
+public:
+    Impl(const Timespan& interval, const Timespan& detailed) : _interval(interval), _detailed(detailed)
+    {
+        _usage.ram_total = Memory::RamTotal();
+
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__)
+        _page_size = sysconf(_SC_PAGESIZE);
+
+        _statm = Open("/proc/self/statm");
+        _stat = Open("/proc/self/stat");
+        _status = Open("/proc/self/status");
+        _smaps = Open("/proc/self/smaps_rollup");
+
+        OpenControlGroup();
+#endif
+    }
+
+    ~Impl()
+    {
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__)
+        for (int fd : { _statm, _stat, _status, _smaps, _cgroup_current, _cgroup_max })
+            if (fd >= 0)
+                close(fd);
+#endif
+    }
+
+    const Timespan& interval() const noexcept { return _interval; }
+    const Timespan& detailed() const noexcept { return _detailed; }
+
+    MemoryUsage Usage(bool force)
+    {
+        Locker<CriticalSection> locker(_lock);
+
+        uint64_t timestamp = Timestamp::nano();
+
+        if (force || ((int64_t)(timestamp - _usage.timestamp) >= _interval.total()) || (_usage.timestamp == 0))
+        {
+            Update();
+            _usage.timestamp = timestamp;
+        }
+
+        if (force || ((int64_t)(timestamp - _usage.detailed) >= _detailed.total()) || (_usage.detailed == 0))
+        {
+            UpdateDetailed();
+            _usage.detailed = timestamp;
+        }
+
+        return _usage;
+    }
+
+private:
+    CriticalSection _lock;
+    Timespan _interval;
+    Timespan _detailed;
+    MemoryUsage _usage;
+
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__)
+    int64_t _page_size{4096};
+    int _statm{-1};
+    int _stat{-1};
+    int _status{-1};
+    int _smaps{-1};
+    int _cgroup_current{-1};
+    int _cgroup_max{-1};
+    char _buffer[8192];
+
+    static int Open(const std::string& path)
+    {
+        return open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+
+    // Re-read the whole file from the cached descriptor into the buffer
+    const char* Read(int fd)
+    {
+        if (fd < 0)
+            return nullptr;
+
+        ssize_t size = pread(fd, _buffer, sizeof(_buffer) - 1, 0);
+        if (size <= 0)
+            return nullptr;
+
+        _buffer[size] = 0;
+        return _buffer;
+    }
+
+    // Find the given "Key: value kB" entry and return its value in bytes
+    static int64_t FindValue(const char* buffer, const char* key)
+    {
+        size_t length = std::strlen(key);
+        for (const char* line = buffer; line != nullptr; line = std::strchr(line, '\n'))
+        {
+            if (*line == '\n')
+                ++line;
+            if ((std::strncmp(line, key, length) == 0) && (line[length] == ':'))
+                return std::strtoll(line + length + 1, nullptr, 10) * 1024;
+        }
+        return -1;
+    }
+
+    // Parse the control group value ("max" means unlimited)
+    static int64_t ControlGroupValue(const char* buffer)
+    {
+        if ((buffer == nullptr) || (std::strncmp(buffer, "max", 3) == 0))
+            return -1;
+
+        int64_t value = std::strtoll(buffer, nullptr, 10);
+
+        // Control groups v1 report unlimited memory as a huge page aligned value
+        return (value < (INT64_MAX / 2)) ? value : -1;
+    }
+
+    void OpenControlGroup()
+    {
+        int fd = Open("/proc/self/cgroup");
+        const char* buffer = Read(fd);
+        std::string cgroups = (buffer != nullptr) ? buffer : "";
+        if (fd >= 0)
+            close(fd);
+
+        std::string unified;
+        std::string memory;
+        size_t start = 0;
+        while (start < cgroups.size())
+        {
+            size_t end = cgroups.find('\n', start);
+            if (end == std::string::npos)
+                end = cgroups.size();
+
+            // Line format is "hierarchy-ID:controller-list:cgroup-path"
+            std::string line = cgroups.substr(start, end - start);
+            size_t first = line.find(':');
+            size_t second = (first != std::string::npos) ? line.find(':', first + 1) : std::string::npos;
+            if (second != std::string::npos)
+            {
+                std::string controllers = line.substr(first + 1, second - first - 1);
+                std::string path = line.substr(second + 1);
+                if (controllers.empty())
+                    unified = path;
+                else if ((controllers == "memory") || (controllers.find("memory,") == 0) || (controllers.find(",memory") != std::string::npos))
+                    memory = path;
+            }
+
+            start = end + 1;
+        }
+
+        // Control groups v1
+        if (!memory.empty())
+        {
+            _cgroup_current = Open("/sys/fs/cgroup/memory" + memory + "/memory.usage_in_bytes");
+            _cgroup_max = Open("/sys/fs/cgroup/memory" + memory + "/memory.limit_in_bytes");
+            if ((_cgroup_current < 0) || (_cgroup_max < 0))
+            {
+                // Control group namespace hides the cgroup path
+                CloseControlGroup();
+                _cgroup_current = Open("/sys/fs/cgroup/memory/memory.usage_in_bytes");
+                _cgroup_max = Open("/sys/fs/cgroup/memory/memory.limit_in_bytes");
+            }
+        }
+        // Control groups v2
+        else if (!unified.empty())
+        {
+            if (unified == "/")
+                unified.clear();
+            _cgroup_current = Open("/sys/fs/cgroup" + unified + "/memory.current");
+            _cgroup_max = Open("/sys/fs/cgroup" + unified + "/memory.max");
+            if ((_cgroup_current < 0) || (_cgroup_max < 0))
+            {
+                // Control group namespace hides the cgroup path
+                CloseControlGroup();
+                _cgroup_current = Open("/sys/fs/cgroup/memory.current");
+                _cgroup_max = Open("/sys/fs/cgroup/memory.max");
+            }
+        }
+    }
+
+    void CloseControlGroup()
+    {
+        if (_cgroup_current >= 0)
+            close(_cgroup_current);
+        if (_cgroup_max >= 0)
+            close(_cgroup_max);
+        _cgroup_current = -1;
+        _cgroup_max = -1;
+    }
+#endif
+
+    void Update()
+    {
+        _usage.ram_free = Memory::RamFree();
+
+#if defined(__APPLE__)
+        mach_task_basic_info basic;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&basic, &count) == KERN_SUCCESS)
+            _usage.rss = (int64_t)basic.resident_size;
+
+        task_events_info events;
+        count = TASK_EVENTS_INFO_COUNT;
+        if (task_info(mach_task_self(), TASK_EVENTS_INFO, (task_info_t)&events, &count) == KERN_SUCCESS)
+        {
+            _usage.major_faults = (int64_t)events.pageins;
+            _usage.minor_faults = (int64_t)events.faults - (int64_t)events.pageins;
+        }
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+        // Resident set size in pages is the second value
+        const char* statm = Read(_statm);
+        if (statm != nullptr)
+        {
+            char* next = nullptr;
+            std::strtoll(statm, &next, 10);
+            _usage.rss = std::strtoll(next, nullptr, 10) * _page_size;
+        }
+
+        // Page faults are the 10th and the 12th values, counting is started after the command name
+        const char* stat = Read(_stat);
+        const char* values = (stat != nullptr) ? std::strrchr(stat, ')') : nullptr;
+        if (values != nullptr)
+        {
+            char* next = (char*)values + 1;
+            for (int i = 3; i <= 12; ++i)
+            {
+                while (*next == ' ')
+                    ++next;
+                if (i == 10)
+                    _usage.minor_faults = std::strtoll(next, nullptr, 10);
+                else if (i == 12)
+                    _usage.major_faults = std::strtoll(next, nullptr, 10);
+                while ((*next != ' ') && (*next != 0))
+                    ++next;
+            }
+        }
+
+        const char* current = Read(_cgroup_current);
+        if (current != nullptr)
+            _usage.cgroup_usage = std::strtoll(current, nullptr, 10);
+#elif defined(_WIN32) || defined(_WIN64)
+        PROCESS_MEMORY_COUNTERS_EX counters;
+        if (K32GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&counters, sizeof(counters)))
+        {
+            _usage.rss = (int64_t)counters.WorkingSetSize;
+            _usage.anonymous = (int64_t)counters.PrivateUsage;
+            _usage.minor_faults = (int64_t)counters.PageFaultCount;
+        }
+#endif
+    }
+
+    void UpdateDetailed()
+    {
+#if defined(__APPLE__)
+        task_vm_info vm;
+        mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+        if (task_info(mach_task_self(), TASK_VM_INFO, (task_info_t)&vm, &count) == KERN_SUCCESS)
+        {
+            _usage.anonymous = (int64_t)vm.internal;
+            _usage.file = (int64_t)vm.external;
+            _usage.swap = (int64_t)vm.compressed;
+        }
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+        const char* status = Read(_status);
+        if (status != nullptr)
+        {
+            _usage.anonymous = FindValue(status, "RssAnon");
+            _usage.file = FindValue(status, "RssFile");
+            _usage.shmem = FindValue(status, "RssShmem");
+            _usage.swap = FindValue(status, "VmSwap");
+            _usage.hugetlb = FindValue(status, "HugetlbPages");
+        }
+
+        const char* smaps = Read(_smaps);
+        if (smaps != nullptr)
+        {
+            _usage.pss = FindValue(smaps, "Pss");
+            _usage.huge_pages = FindValue(smaps, "AnonHugePages");
+        }
+
+        _usage.cgroup_limit = ControlGroupValue(Read(_cgroup_max));
+#endif
+    }
+};
+
+//! @endcond
+
+MemoryTelemetry::MemoryTelemetry(const Timespan& interval, const Timespan& detailed) : _pimpl(std::make_unique<Impl>(interval, detailed))
+{
+}
+
+MemoryTelemetry::~MemoryTelemetry() = default;
+
+const Timespan& MemoryTelemetry::interval() const noexcept
+{
+    return _pimpl->interval();
+}
+
+const Timespan& MemoryTelemetry::detailed() const noexcept
+{
+    return _pimpl->detailed();
+}
+
+MemoryUsage MemoryTelemetry::Usage()
+{
+    return _pimpl->Usage(false);
+}
+
+MemoryUsage MemoryTelemetry::Refresh()
+{
+    return _pimpl->Usage(true);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,100 @@
+/*!
+    \file futex.cpp
+    \brief Futex synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/futex.h"
+
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#undef max
+#undef min
+#endif
+
+namespace CppCommon {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex value must have the same size as 32-bit integer!");
+
+void Futex::Wait(std::atomic<uint32_t>& value, uint32_t expected) noexcept
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (uint32_t*)&value, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    WaitOnAddress(&value, &expected, sizeof(uint32_t), INFINITE);
+#else
+    value.wait(expected, std::memory_order_acquire);
+#endif
+}
+
+bool Futex::WaitFor(std::atomic<uint32_t>& value, uint32_t expected, const Timespan& timespan) noexcept
+{
+    if (timespan.total() <= 0)
+        return (value.load(std::memory_order_acquire) != expected);
+
+#if defined(__linux__)
+    struct timespec timeout;
+    timeout.tv_sec = timespan.seconds();
+    timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
+    long result = syscall(SYS_futex, (uint32_t*)&value, FUTEX_WAIT_PRIVATE, expected, &timeout, nullptr, 0);
+    return !((result == -1) && (errno == ETIMEDOUT));
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!WaitOnAddress(&value, &expected, sizeof(uint32_t), (DWORD)std::max(timespan.milliseconds(), (int64_t)1)))
+        return (GetLastError() != ERROR_TIMEOUT);
+    return true;
+#else
+    // C++20 atomic waiting has no timeout, so poll the value
+    uint64_t finish = Timestamp::nano() + timespan.total();
+    while (value.load(std::memory_order_acquire) == expected)
+    {
+        if (Timestamp::nano() >= finish)
+            return false;
+        Thread::Yield();
+    }
+    return true;
+#endif
+}
+
+void Futex::WakeOne(std::atomic<uint32_t>& value) noexcept
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (uint32_t*)&value, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    WakeByAddressSingle(&value);
+#else
+    value.notify_one();
+#endif
+}
+
+void Futex::WakeAll(std::atomic<uint32_t>& value) noexcept
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (uint32_t*)&value, FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    WakeByAddressAll(&value);
+#else
+    value.notify_all();
+#endif
+}
+
+uint32_t Futex::SpinCount() noexcept
+{
+    static const uint32_t spin = (std::thread::hardware_concurrency() > 1) ? 100 : 0;
+    return spin;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,277 @@
+/*!
+    \file thread_pool.cpp
+    \brief Work-stealing thread pool implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/thread_pool.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Thread pool and its worker of the current thread
+thread_local ThreadPool* current_pool = nullptr;
+thread_local void* current_worker = nullptr;
+thread_local int current_index = -1;
+
+// Count of search attempts before the idle worker is parked
+const size_t spin_attempts = 64;
+
+// Fast xorshift random generator to select victims for stealing
+inline uint64_t NextRandom(uint64_t& state) noexcept
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+} // namespace Internals
+//! @endcond
+
+ThreadPool::ThreadPool(size_t threads, bool pinning)
+    : _pinning(pinning),
+      _stop(false),
+      _pending(0),
+      _injected(0),
+      _sleepers(0),
+      _wakeups(0)
+{
+    threads = std::max(threads, (size_t)1);
+
+    // All workers must be created before any worker starts stealing
+    _workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i)
+    {
+        auto worker = std::make_unique<Worker>();
+        worker->index = i;
+        worker->random = 0x9E3779B97F4A7C15ull * (i + 1);
+        _workers.emplace_back(std::move(worker));
+    }
+
+    for (size_t i = 0; i < threads; ++i)
+        _workers[i]->thread = Thread::Start([this, i]() { WorkerThread(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    Stop();
+}
+
+ThreadPool* ThreadPool::CurrentPool() noexcept
+{
+    return Internals::current_pool;
+}
+
+int ThreadPool::CurrentWorker() noexcept
+{
+    return Internals::current_index;
+}
+
+bool ThreadPool::RunOne()
+{
+    Worker* worker = (Internals::current_pool == this) ? (Worker*)Internals::current_worker : nullptr;
+
+    Internals::PoolTask* task = FindTask(worker);
+    if (task == nullptr)
+        return false;
+
+    Execute(task);
+    return true;
+}
+
+void ThreadPool::Wait()
+{
+    assert((Internals::current_pool != this) && "Thread pool must not be waited from its own worker!");
+
+    Locker<CriticalSection> locker(_idle_cs);
+    _idle_cv.Wait(_idle_cs, [this]() { return (_pending.load(std::memory_order_acquire) == 0); });
+}
+
+void ThreadPool::Stop()
+{
+    assert((Internals::current_pool != this) && "Thread pool must not be stopped from its own worker!");
+
+    if (_stop.exchange(true))
+        return;
+
+    {
+        Locker<CriticalSection> locker(_park_cs);
+        _park_cv.NotifyAll();
+    }
+
+    for (auto& worker : _workers)
+        if (worker->thread.joinable())
+            worker->thread.join();
+}
+
+void ThreadPool::Schedule(Internals::PoolTask* task)
+{
+    assert((task != nullptr) && "Task must be valid!");
+
+    _pending.fetch_add(1, std::memory_order_relaxed);
+
+    if (Internals::current_pool == this)
+    {
+        // Push the task into the current worker deque
+        ((Worker*)Internals::current_worker)->deque.Push(task);
+    }
+    else
+    {
+        // Push the task into the injection queue
+        Locker<CriticalSection> locker(_injection_cs);
+        _injection.push_back(task);
+        _injected.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Pairs with the fence in Park() so that either the parking worker sees
+    // the new task or the submitter sees the parking worker
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_sleepers.load(std::memory_order_relaxed) > 0)
+        Wake();
+}
+
+void ThreadPool::Execute(Internals::PoolTask* task)
+{
+    {
+        std::unique_ptr<Internals::PoolTask> guard(task);
+        task->Execute();
+    }
+
+    if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        Locker<CriticalSection> locker(_idle_cs);
+        _idle_cv.NotifyAll();
+    }
+}
+
+Internals::PoolTask* ThreadPool::FindTask(Worker* worker)
+{
+    Internals::PoolTask* task = nullptr;
+
+    // Pop the newest task from the own deque
+    if ((worker != nullptr) && worker->deque.Pop(task))
+        return task;
+
+    // Take the oldest task from the injection queue
+    if (_injected.load(std::memory_order_relaxed) > 0)
+    {
+        Locker<CriticalSection> locker(_injection_cs);
+        if (!_injection.empty())
+        {
+            task = _injection.front();
+            _injection.pop_front();
+            _injected.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+
+    // Steal the oldest task from the random victim
+    static thread_local uint64_t random = 0x2545F4914F6CDD1Dull ^ (uint64_t)(uintptr_t)&task;
+    uint64_t& state = (worker != nullptr) ? worker->random : random;
+    size_t count = _workers.size();
+    size_t start = (size_t)(Internals::NextRandom(state) % count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Worker* victim = _workers[(start + i) % count].get();
+        if ((victim != worker) && victim->deque.Steal(task))
+            return task;
+    }
+
+    return nullptr;
+}
+
+bool ThreadPool::HasTasks() const
+{
+    if (_injected.load(std::memory_order_relaxed) > 0)
+        return true;
+
+    for (const auto& worker : _workers)
+        if (!worker->deque.empty())
+            return true;
+
+    return false;
+}
+
+void ThreadPool::Wake()
+{
+    Locker<CriticalSection> locker(_park_cs);
+    if (_wakeups < _sleepers.load(std::memory_order_relaxed))
+    {
+        ++_wakeups;
+        _park_cv.NotifyOne();
+    }
+}
+
+void ThreadPool::Park()
+{
+    Locker<CriticalSection> locker(_park_cs);
+
+    _sleepers.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Re-check for tasks submitted concurrently with parking
+    if (!HasTasks() && !_stop.load(std::memory_order_acquire))
+    {
+        _park_cv.Wait(_park_cs, [this]() { return (_wakeups > 0) || _stop.load(std::memory_order_acquire); });
+        if (_wakeups > 0)
+            --_wakeups;
+    }
+
+    _sleepers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ThreadPool::WorkerThread(size_t index)
+{
+    Worker* worker = _workers[index].get();
+
+    Internals::current_pool = this;
+    Internals::current_worker = worker;
+    Internals::current_index = (int)index;
+
+    if (_pinning)
+    {
+        size_t cores = std::clamp((size_t)std::thread::hardware_concurrency(), (size_t)1, (size_t)64);
+        std::bitset<64> affinity;
+        affinity.set(index % cores);
+        Thread::SetAffinity(affinity);
+    }
+
+    size_t attempts = 0;
+    for (;;)
+    {
+        Internals::PoolTask* task = FindTask(worker);
+        if (task != nullptr)
+        {
+            Execute(task);
+            attempts = 0;
+            continue;
+        }
+
+        // All pending tasks are executed before the worker is stopped
+        if (_stop.load(std::memory_order_acquire) && !HasTasks())
+            break;
+
+        // Spin for a short time before parking
+        if (++attempts < Internals::spin_attempts)
+        {
+            Thread::Yield();
+            continue;
+        }
+
+        Park();
+        attempts = 0;
+    }
+
+    Internals::current_pool = nullptr;
+    Internals::current_worker = nullptr;
+    Internals::current_index = -1;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,342 @@
+/*!
+    \file timer_service.cpp
+    \brief Timer service implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/timer_service.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace CppCommon {
+
+const TimerService::TimerId TimerService::InvalidTimer;
+
+TimerService::TimerService(const Timespan& resolution, const Clock& clock)
+    : _resolution((uint64_t)std::max(resolution.total(), (int64_t)1)),
+      _clock(clock),
+      _size(0),
+      _free(None),
+      _wheel(Levels * LevelSlots, (uint32_t)None),
+      _stop(false)
+{
+    _current = NowTick();
+}
+
+TimerService::~TimerService()
+{
+    Stop();
+}
+
+uint64_t TimerService::tick() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _current;
+}
+
+size_t TimerService::size() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _size;
+}
+
+TimerService::TimerId TimerService::Schedule(const Timespan& timeout, Callback callback, const Timespan& period)
+{
+    assert(callback && "Timer callback must be valid!");
+
+    uint64_t expire = ExpireTick(timeout);
+
+    // Shared callback is batched for dispatch without copying the function object
+    auto shared = std::make_shared<Callback>(std::move(callback));
+
+    Locker<CriticalSection> locker(_cs);
+
+    // Empty wheel could jump straight to the current tick
+    if (_size == 0)
+        _current = std::max(_current, NowTick());
+
+    uint32_t index = Allocate();
+    Timer& timer = _timers[index];
+    timer.callback = std::move(shared);
+    timer.expire = std::max(expire, _current + 1);
+    timer.period = (period.total() > 0) ? std::max(((uint64_t)period.total() + _resolution - 1) / _resolution, (uint64_t)1) : 0;
+    Link(index);
+
+    // Wake up the idle dispatch thread
+    if (_size == 1)
+        _cv.NotifyOne();
+
+    return ((TimerId)timer.generation << 32) | index;
+}
+
+bool TimerService::Reschedule(TimerId id, const Timespan& timeout)
+{
+    uint64_t expire = ExpireTick(timeout);
+
+    Locker<CriticalSection> locker(_cs);
+
+    uint32_t index = Find(id);
+    if (index == None)
+        return false;
+
+    Unlink(index);
+    _timers[index].expire = std::max(expire, _current + 1);
+    Link(index);
+
+    return true;
+}
+
+bool TimerService::Cancel(TimerId id)
+{
+    Locker<CriticalSection> locker(_cs);
+
+    uint32_t index = Find(id);
+    if (index == None)
+        return false;
+
+    Unlink(index);
+    Release(index);
+
+    return true;
+}
+
+bool TimerService::IsScheduled(TimerId id) const
+{
+    Locker<CriticalSection> locker(_cs);
+    return (Find(id) != None);
+}
+
+size_t TimerService::Poll()
+{
+    // Serialize pollers to keep the dispatch order of callbacks
+    Locker<CriticalSection> poll_locker(_poll_cs);
+
+    {
+        Locker<CriticalSection> locker(_cs);
+        Advance();
+    }
+
+    // Dispatch the batch of expired timers without holding the service lock
+    size_t count = _batch.size();
+    for (auto& callback : _batch)
+        (*callback)();
+    _batch.clear();
+
+    return count;
+}
+
+void TimerService::Start()
+{
+    assert(!running() && "Dispatch thread is already running!");
+
+    _stop.store(false, std::memory_order_release);
+    _thread = Thread::Start([this]() { DispatchThread(); });
+}
+
+void TimerService::Stop()
+{
+    if (!running())
+        return;
+
+    {
+        Locker<CriticalSection> locker(_cs);
+        _stop.store(true, std::memory_order_release);
+        _cv.NotifyAll();
+    }
+
+    _thread.join();
+}
+
+uint64_t TimerService::ExpireTick(const Timespan& timeout) const
+{
+    // Round the expiration time up, so timers never expire earlier than requested
+    uint64_t expire = now() + (uint64_t)std::max(timeout.total(), (int64_t)0);
+    return (expire + _resolution - 1) / _resolution;
+}
+
+uint32_t TimerService::Find(TimerId id) const noexcept
+{
+    uint32_t index = (uint32_t)id;
+    uint32_t generation = (uint32_t)(id >> 32);
+
+    if ((index >= _timers.size()) || (_timers[index].generation != generation) || (_timers[index].slot == None))
+        return None;
+
+    return index;
+}
+
+uint32_t TimerService::Allocate()
+{
+    ++_size;
+
+    // Reuse the released timer node
+    if (_free != None)
+    {
+        uint32_t index = _free;
+        _free = _timers[index].next;
+        return index;
+    }
+
+    assert((_timers.size() < None) && "Too many timers!");
+
+    Timer timer;
+    timer.expire = 0;
+    timer.period = 0;
+    timer.generation = 1;
+    timer.slot = None;
+    timer.prev = None;
+    timer.next = None;
+    _timers.emplace_back(std::move(timer));
+
+    return (uint32_t)(_timers.size() - 1);
+}
+
+void TimerService::Release(uint32_t index)
+{
+    --_size;
+
+    Timer& timer = _timers[index];
+    timer.callback.reset();
+
+    // Invalidate all identifiers of the released timer node
+    if (++timer.generation == 0)
+        timer.generation = 1;
+
+    timer.next = _free;
+    _free = index;
+}
+
+void TimerService::Link(uint32_t index)
+{
+    Timer& timer = _timers[index];
+
+    // Select the lowest level which covers the remaining time. Timers which
+    // are too far in the future are parked in the highest level and will be
+    // cascaded again.
+    uint64_t delta = timer.expire - _current;
+    uint64_t expire = timer.expire;
+    size_t level = 0;
+    while ((level < (Levels - 1)) && (delta >= ((uint64_t)1 << (LevelBits * (level + 1)))))
+        ++level;
+    if (delta >= ((uint64_t)1 << (LevelBits * Levels)))
+        expire = _current + ((uint64_t)1 << (LevelBits * Levels)) - 1;
+
+    size_t slot = level * LevelSlots + ((expire >> (LevelBits * level)) & (LevelSlots - 1));
+
+    // Push the timer at the head of the slot list
+    timer.slot = (uint32_t)slot;
+    timer.prev = None;
+    timer.next = _wheel[slot];
+    if (timer.next != None)
+        _timers[timer.next].prev = index;
+    _wheel[slot] = index;
+}
+
+void TimerService::Unlink(uint32_t index)
+{
+    Timer& timer = _timers[index];
+
+    if (timer.prev != None)
+        _timers[timer.prev].next = timer.next;
+    else
+        _wheel[timer.slot] = timer.next;
+    if (timer.next != None)
+        _timers[timer.next].prev = timer.prev;
+
+    timer.slot = None;
+    timer.prev = None;
+    timer.next = None;
+}
+
+void TimerService::Cascade(size_t slot)
+{
+    uint32_t index = _wheel[slot];
+    _wheel[slot] = None;
+
+    while (index != None)
+    {
+        uint32_t next = _timers[index].next;
+        Link(index);
+        index = next;
+    }
+}
+
+void TimerService::Advance()
+{
+    const uint64_t target = NowTick();
+
+    // Empty wheel could jump straight to the target tick
+    if (_size == 0)
+    {
+        _current = std::max(_current, target);
+        return;
+    }
+
+    while (_current < target)
+    {
+        ++_current;
+
+        // Cascade timers from higher levels when lower levels wrap around
+        for (size_t level = 1; level < Levels; ++level)
+        {
+            if ((_current & (((uint64_t)1 << (LevelBits * level)) - 1)) != 0)
+                break;
+            Cascade(level * LevelSlots + ((_current >> (LevelBits * level)) & (LevelSlots - 1)));
+        }
+
+        // Collect expired timers of the current tick
+        size_t slot = _current & (LevelSlots - 1);
+        uint32_t index = _wheel[slot];
+        _wheel[slot] = None;
+
+        while (index != None)
+        {
+            Timer& timer = _timers[index];
+            uint32_t next = timer.next;
+            timer.slot = None;
+
+            if (timer.period > 0)
+            {
+                // Repeat the periodic timer
+                _batch.push_back(timer.callback);
+                timer.expire = _current + timer.period;
+                Link(index);
+            }
+            else
+            {
+                _batch.emplace_back(std::move(timer.callback));
+                Release(index);
+            }
+
+            index = next;
+        }
+    }
+}
+
+void TimerService::DispatchThread()
+{
+    while (!_stop.load(std::memory_order_acquire))
+    {
+        Poll();
+
+        Locker<CriticalSection> locker(_cs);
+        if (_stop.load(std::memory_order_acquire))
+            break;
+
+        if (_size == 0)
+        {
+            // Sleep until a new timer is scheduled or the stop request
+            _cv.Wait(_cs, [this]() { return (_size > 0) || _stop.load(std::memory_order_acquire); });
+        }
+        else
+        {
+            // Sleep until the next tick or the stop request
+            _cv.TryWaitFor(_cs, resolution());
+        }
+    }
+}
+
+} // namespace CppCommon
@@ -6,13 +6,20 @@
 
 #include "memory/allocator.h"
 #include "memory/allocator_arena.h"
+#include "memory/allocator_concurrent_arena.h"
 #include "memory/allocator_heap.h"
 #include "memory/allocator_null.h"
+#include "memory/allocator_page.h"
+#include "memory/allocator_pmr.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_slab.h"
 #include "memory/allocator_stack.h"
+#include "memory/allocator_stats.h"
+#include "memory/allocator_thread_cache.h"
 
 #include <list>
 #include <map>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
@@ -248,6 +255,116 @@ TEST_CASE("Arena memory manager with a dynamic buffer", "[CppCommon][Memory]")
     REQUIRE(manger.allocations() == 0);
 }
 
+TEST_CASE("Arena memory manager with checkpoints", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, 64);
+
+    void* ptr = manger.malloc(10, 1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 10);
+    REQUIRE(manger.allocations() == 1);
+
+    auto mark = manger.mark();
+
+    // Allocate enough blocks to grow the arena with new pages
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(manger.malloc(32) != nullptr);
+    REQUIRE(manger.allocated() == 3210);
+    REQUIRE(manger.allocations() == 101);
+    size_t allocated = auxiliary.allocated();
+
+    manger.rewind(mark);
+    REQUIRE(manger.allocated() == 10);
+    REQUIRE(manger.allocations() == 1);
+    REQUIRE(manger.retained() > 0);
+    REQUIRE(auxiliary.allocated() == allocated);
+
+    // Retained pages are reused without the auxiliary memory manager
+    {
+        ArenaMemoryScope<DefaultMemoryManager> scope(manger);
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(manger.malloc(32) != nullptr);
+        REQUIRE(manger.allocated() == 3210);
+        REQUIRE(manger.allocations() == 101);
+        REQUIRE(auxiliary.allocated() == allocated);
+    }
+    REQUIRE(manger.allocated() == 10);
+    REQUIRE(manger.allocations() == 1);
+
+    // Nested scopes
+    {
+        ArenaMemoryScope<DefaultMemoryManager> scope1(manger);
+        REQUIRE(manger.malloc(100) != nullptr);
+        {
+            ArenaMemoryScope<DefaultMemoryManager> scope2(manger);
+            REQUIRE(manger.malloc(1000) != nullptr);
+            REQUIRE(manger.allocated() == 1110);
+        }
+        REQUIRE(manger.allocated() == 110);
+    }
+    REQUIRE(manger.allocated() == 10);
+
+    manger.free(ptr, 10);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    manger.reset();
+    REQUIRE(manger.retained() == 0);
+
+    // Checkpoints with an external buffer
+    uint8_t buffer[64];
+    manger.reset(buffer, 64);
+
+    mark = manger.mark();
+    REQUIRE(manger.malloc(16, 1) != nullptr);
+    REQUIRE(manger.size() == 16);
+    manger.rewind(mark);
+    REQUIRE(manger.size() == 0);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Arena memory manager with containers in scope", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, 64);
+    ArenaAllocator<int, DefaultMemoryManager> alloc(manger);
+
+    {
+        ArenaMemoryScope<DefaultMemoryManager> scope(manger);
+
+        // Growing vector frees its previous storage individually
+        std::vector<int, decltype(alloc)> v(alloc);
+        for (int i = 0; i < 100; ++i)
+            v.push_back(i);
+        REQUIRE(v.size() == 100);
+        REQUIRE(manger.allocations() == 1);
+    }
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    {
+        ArenaMemoryScope<DefaultMemoryManager> scope(manger);
+
+        // Blocks not freed individually are released by the scope rewind
+        REQUIRE(manger.malloc(32) != nullptr);
+        std::vector<int, decltype(alloc)> v(alloc);
+        for (int i = 0; i < 100; ++i)
+            v.push_back(i);
+        v.clear();
+        v.shrink_to_fit();
+        REQUIRE(manger.malloc(32) != nullptr);
+        REQUIRE(manger.allocated() == 64);
+        REQUIRE(manger.allocations() == 2);
+    }
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    manger.reset();
+    REQUIRE(manger.retained() == 0);
+}
+
 TEST_CASE("Arena allocator with stl direct access containers", "[CppCommon][Memory]")
 {
     DefaultMemoryManager auxiliary;
@@ -286,6 +403,137 @@ TEST_CASE("Arena allocator with stl associative containers", "[CppCommon][Memory
     u.clear();
 }
 
+TEST_CASE("Concurrent arena memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, 1024);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.pages() == 0);
+
+    void* ptr1 = manger.malloc(10);
+    REQUIRE(ptr1 != nullptr);
+    REQUIRE(manger.allocated() == 10);
+    REQUIRE(manger.allocations() == 1);
+    REQUIRE(manger.pages() == 1);
+
+    void* ptr2 = manger.malloc(100, 64);
+    REQUIRE(ptr2 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr2, 64));
+
+    void* ptr3 = manger.malloc(10000);
+    REQUIRE(ptr3 != nullptr);
+    REQUIRE(manger.pages() == 2);
+
+    manger.free(ptr3, 10000);
+    manger.free(ptr2, 100);
+    manger.free(ptr1, 10);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    REQUIRE(manger.reset());
+    REQUIRE(manger.epoch() == 1);
+    REQUIRE(manger.pages() == 1);
+
+    // Deferred reset
+    {
+        ConcurrentArenaScope<DefaultMemoryManager> scope(manger);
+        REQUIRE(manger.users() == 1);
+        void* ptr = manger.malloc(10);
+        manger.free(ptr, 10);
+        REQUIRE(!manger.reset());
+        REQUIRE(manger.epoch() == 1);
+    }
+    REQUIRE(manger.users() == 0);
+    REQUIRE(manger.epoch() == 2);
+}
+
+TEST_CASE("Concurrent arena memory manager with mixed alignments", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+
+    // Arena capacity is not a multiple of the fundamental alignment
+    ConcurrentArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, 100);
+
+    void* ptr1 = manger.malloc(2, 32);
+    REQUIRE(ptr1 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr1, 32));
+    memset(ptr1, 0xFF, 2);
+
+    // Fundamental block after the extended alignment block must be aligned and fit into the page
+    void* ptr2 = manger.malloc(64);
+    REQUIRE(ptr2 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr2, alignof(std::max_align_t)));
+    REQUIRE(manger.pages() == 2);
+    memset(ptr2, 0xFF, 64);
+
+    void* ptr3 = manger.malloc(3, 64);
+    REQUIRE(ptr3 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr3, 64));
+    memset(ptr3, 0xFF, 3);
+
+    void* ptr4 = manger.malloc(20);
+    REQUIRE(ptr4 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr4, alignof(std::max_align_t)));
+    memset(ptr4, 0xFF, 20);
+
+    manger.free(ptr4, 20);
+    manger.free(ptr3, 3);
+    manger.free(ptr2, 64);
+    manger.free(ptr1, 2);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Concurrent arena memory manager with multiple threads", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ConcurrentArenaMemoryManager<DefaultMemoryManager> manger(auxiliary, 4096);
+
+    const int threads_count = 4;
+    const int items = 10000;
+
+    for (int epoch = 0; epoch < 3; ++epoch)
+    {
+        std::vector<std::vector<uint8_t*>> pointers(threads_count);
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threads_count; ++thread)
+        {
+            threads.emplace_back([&manger, &pointers, thread]()
+            {
+                ConcurrentArenaScope<DefaultMemoryManager> scope(manger);
+                for (int i = 0; i < items; ++i)
+                {
+                    uint8_t* ptr = (uint8_t*)manger.malloc(24);
+                    for (size_t j = 0; j < 24; ++j)
+                        ptr[j] = (uint8_t)thread;
+                    pointers[thread].push_back(ptr);
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        // Check that allocated blocks do not overlap
+        bool valid = true;
+        for (int thread = 0; thread < threads_count; ++thread)
+        {
+            for (auto ptr : pointers[thread])
+            {
+                for (size_t j = 0; j < 24; ++j)
+                    valid = valid && (ptr[j] == (uint8_t)thread);
+                manger.free(ptr, 24);
+            }
+        }
+        REQUIRE(valid);
+
+        REQUIRE(manger.allocated() == 0);
+        REQUIRE(manger.allocations() == 0);
+        REQUIRE(manger.reset());
+        REQUIRE(manger.pages() == 1);
+    }
+}
+
 TEST_CASE("Pool memory manager with a fixed buffer", "[CppCommon][Memory]")
 {
     DefaultMemoryManager auxiliary;
@@ -442,3 +690,498 @@ TEST_CASE("Pool allocator with stl associative containers", "[CppCommon][Memory]
     u[2] = 20;
     u.clear();
 }
+
+TEST_CASE("Page memory manager", "[CppCommon][Memory]")
+{
+    PageMemoryManager manger;
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.granularity() == PageMemoryManager::PageSize());
+
+    uint8_t* ptr = (uint8_t*)manger.malloc(1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(Memory::IsAligned(ptr, PageMemoryManager::PageSize()));
+    REQUIRE(manger.allocated() == 1);
+    REQUIRE(manger.allocations() == 1);
+    ptr[0] = 0xFF;
+    manger.free(ptr, 1);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    size_t alignment = 16 * PageMemoryManager::PageSize();
+    ptr = (uint8_t*)manger.malloc(100000, alignment);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(Memory::IsAligned(ptr, alignment));
+    REQUIRE(manger.allocated() == 100000);
+    REQUIRE(manger.allocations() == 1);
+    memset(ptr, 0xFF, 100000);
+    manger.free(ptr, 100000);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Page memory manager with huge pages", "[CppCommon][Memory]")
+{
+    // Huge pages might be unavailable, so the memory manager should gracefully fall back to regular pages
+    PageMemoryManager manger(PageFlags::HUGEPAGES | PageFlags::POPULATE, 0);
+    REQUIRE(manger.granularity() >= PageMemoryManager::PageSize());
+
+    uint8_t* ptr = (uint8_t*)manger.malloc(1000);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 1000);
+    REQUIRE(manger.allocations() == 1);
+    REQUIRE(Memory::IsZero(ptr, 1000));
+    manger.free(ptr, 1000);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Page memory manager as an auxiliary memory manager", "[CppCommon][Memory]")
+{
+    PageMemoryManager auxiliary(PageFlags::TRANSPARENT);
+
+    ArenaMemoryManager<PageMemoryManager> arena(auxiliary, 1024 * 1024);
+    ArenaAllocator<int, PageMemoryManager> arena_alloc(arena);
+    std::vector<int, decltype(arena_alloc)> v(arena_alloc);
+    for (int i = 0; i < 10000; ++i)
+        v.push_back(i);
+    v.clear();
+    v.shrink_to_fit();
+
+    PoolMemoryManager<PageMemoryManager> pool(auxiliary, 1024 * 1024);
+    PoolAllocator<int, PageMemoryManager> pool_alloc(pool);
+    std::list<int, decltype(pool_alloc)> l(pool_alloc);
+    for (int i = 0; i < 10000; ++i)
+        l.push_back(i);
+    l.clear();
+}
+
+TEST_CASE("Slab memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manger(auxiliary, 8192, 4);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.slab() == 8192);
+    REQUIRE(manger.slabs() == 4);
+    REQUIRE(manger.regions() == 0);
+
+    void* ptr = manger.malloc(1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(Memory::IsAligned((uint8_t*)ptr, alignof(std::max_align_t)));
+    REQUIRE(manger.allocated() == 1);
+    REQUIRE(manger.allocations() == 1);
+    REQUIRE(manger.regions() == 1);
+    manger.free(ptr, 1);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.regions() == 1);
+
+    // Freed block should be reused from the same size class
+    void* reused = manger.malloc(10);
+    REQUIRE(reused == ptr);
+    manger.free(reused, 10);
+
+    // Blocks with custom alignment
+    ptr = manger.malloc(24, 64);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(Memory::IsAligned((uint8_t*)ptr, 64));
+    manger.free(ptr, 24);
+
+    // Huge block should be allocated from the auxiliary memory manager
+    ptr = manger.malloc(10000);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 10000);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 10000);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Fill several regions with blocks of different size classes
+    std::vector<std::pair<void*, size_t>> pointers;
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        size_t size = 1 + (i * 37) % 4096;
+        void* block = manger.malloc(size);
+        REQUIRE(block != nullptr);
+        memset(block, 0xFF, size);
+        pointers.emplace_back(block, size);
+    }
+    REQUIRE(manger.allocations() == 10000);
+    size_t regions = manger.regions();
+    REQUIRE(regions > 1);
+
+    // Empty slabs and regions should be returned back to the auxiliary memory manager
+    for (auto& pointer : pointers)
+        manger.free(pointer.first, pointer.second);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.regions() < regions);
+
+    manger.reset();
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    ptr = manger.malloc(1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 1);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 1);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    manger.clear();
+    REQUIRE(manger.regions() == 0);
+    REQUIRE(auxiliary.allocated() == 0);
+    REQUIRE(auxiliary.allocations() == 0);
+}
+
+TEST_CASE("Slab allocator with stl containers", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    SlabMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    SlabAllocator<int, DefaultMemoryManager> alloc(manger);
+
+    std::vector<int, decltype(alloc)> v(alloc);
+    for (int i = 0; i < 10000; ++i)
+        v.push_back(i);
+    v.clear();
+    v.shrink_to_fit();
+
+    std::list<int, decltype(alloc)> l(alloc);
+    for (int i = 0; i < 10000; ++i)
+        l.push_back(i);
+    l.clear();
+
+    SlabAllocator<std::pair<const int, int>, DefaultMemoryManager> pair_alloc(alloc);
+    std::map<int, int, std::less<>, decltype(pair_alloc)> m(pair_alloc);
+    for (int i = 0; i < 10000; ++i)
+        m[i] = i * 10;
+    m.clear();
+}
+
+TEST_CASE("Memory manager resource", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    MemoryManagerResource<ArenaMemoryManager<DefaultMemoryManager>> resource(manger);
+
+    {
+        std::pmr::vector<int> v(&resource);
+        v.push_back(0);
+        v.push_back(1);
+        v.push_back(2);
+        REQUIRE(manger.allocations() > 0);
+
+        std::pmr::unordered_map<int, int> m(&resource);
+        m[0] = 0;
+        m[1] = 10;
+        m[2] = 20;
+        REQUIRE(m[1] == 10);
+    }
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    MemoryManagerResource<ArenaMemoryManager<DefaultMemoryManager>> other(manger);
+    REQUIRE(resource.is_equal(resource));
+    REQUIRE(resource.is_equal(other));
+    REQUIRE(!resource.is_equal(*std::pmr::new_delete_resource()));
+
+    NullMemoryManager null;
+    MemoryManagerResource<NullMemoryManager> null_resource(null);
+    REQUIRE_THROWS_AS(null_resource.allocate(16), std::bad_alloc);
+}
+
+TEST_CASE("Memory resource manager", "[CppCommon][Memory]")
+{
+    std::pmr::unsynchronized_pool_resource pool;
+    MemoryResourceManager manger(&pool);
+    REQUIRE(manger.resource() == &pool);
+
+    void* ptr = manger.malloc(100);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 100);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 100);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Memory resource as an auxiliary memory manager
+    PoolMemoryManager<MemoryResourceManager> pool_manger(manger);
+    ptr = pool_manger.malloc(100);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocations() > 0);
+    pool_manger.free(ptr, 100);
+    pool_manger.clear();
+    REQUIRE(manger.allocations() == 0);
+
+    MemoryResourceAllocator<int> alloc(manger);
+    std::vector<int, decltype(alloc)> v(alloc);
+    v.push_back(0);
+    v.push_back(1);
+    v.push_back(2);
+    v.clear();
+    v.shrink_to_fit();
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Stats memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    StatsMemoryManager<DefaultMemoryManager> manger(auxiliary);
+
+    void* ptr1 = manger.malloc(10);
+    void* ptr2 = manger.malloc(100);
+    void* ptr3 = manger.malloc(1000);
+
+    MemoryStats stats = manger.stats();
+    REQUIRE(stats.allocated == 1110);
+    REQUIRE(stats.peak == 1110);
+    REQUIRE(stats.allocations == 3);
+    REQUIRE(stats.total_allocations == 3);
+    REQUIRE(stats.histogram[MemoryStats::Bucket(10)] == 1);
+    REQUIRE(stats.histogram[MemoryStats::Bucket(100)] == 1);
+    REQUIRE(stats.histogram[MemoryStats::Bucket(1000)] == 1);
+
+    manger.free(ptr3, 1000);
+    manger.free(ptr2, 100);
+
+    stats = manger.stats();
+    REQUIRE(stats.allocated == 10);
+    REQUIRE(stats.peak == 1110);
+    REQUIRE(stats.allocations == 1);
+    REQUIRE(stats.total_allocated == 1110);
+    REQUIRE(stats.total_freed == 1100);
+    REQUIRE(stats.total_frees == 2);
+
+    manger.clear_stats();
+
+    stats = manger.stats();
+    REQUIRE(stats.allocated == 10);
+    REQUIRE(stats.peak == 10);
+    REQUIRE(stats.allocations == 1);
+    REQUIRE(stats.total_allocations == 0);
+
+    manger.free(ptr1, 10);
+
+    stats = manger.stats();
+    REQUIRE(stats.allocated == 0);
+    REQUIRE(stats.allocations == 0);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    REQUIRE(MemoryStats::Bucket(1) == 0);
+    REQUIRE(MemoryStats::Bucket(2) == 1);
+    REQUIRE(MemoryStats::Bucket(3) == 2);
+    REQUIRE(MemoryStats::Bucket(4) == 2);
+    REQUIRE(MemoryStats::Bucket(5) == 3);
+    REQUIRE(MemoryStats::Bucket(std::numeric_limits<size_t>::max()) == (MemoryStats::Buckets - 1));
+
+    // Disabled statistics
+    StatsMemoryManager<DefaultMemoryManager, false> disabled(auxiliary);
+    void* ptr = disabled.malloc(10);
+    REQUIRE(disabled.allocated() == 10);
+    REQUIRE(disabled.stats().total_allocations == 0);
+    REQUIRE(!disabled.is_threads());
+    disabled.free(ptr, 10);
+
+    // Disabled statistics holds no counters
+    REQUIRE(sizeof(disabled) <= 2 * sizeof(void*));
+}
+
+TEST_CASE("Stats memory manager with threads attribution", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    StatsMemoryManager<DefaultMemoryManager> manger(auxiliary, true);
+
+    const int threads_count = 4;
+    const int items = 1000;
+
+    // Each thread allocates blocks and the next thread frees them
+    std::vector<std::vector<void*>> pointers(threads_count);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manger, &pointers, thread]()
+        {
+            for (int i = 0; i < items; ++i)
+                pointers[thread].push_back(manger.malloc(thread + 1));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    threads.clear();
+
+    REQUIRE(manger.stats().allocations == threads_count * items);
+
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manger, &pointers, thread]()
+        {
+            int source = (thread + 1) % threads_count;
+            for (int i = 0; i < items; ++i)
+                manger.free(pointers[source][i], source + 1);
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    MemoryStats stats = manger.stats();
+    REQUIRE(stats.allocated == 0);
+    REQUIRE(stats.allocations == 0);
+    REQUIRE(stats.total_allocations == threads_count * items);
+    REQUIRE(stats.total_frees == threads_count * items);
+
+    // Counters of exited threads are folded into the single aggregated entry
+    std::vector<ThreadMemoryStats> threads_stats = manger.threads_stats();
+    REQUIRE(threads_stats.size() == 1);
+    REQUIRE(threads_stats[0].thread == 0);
+    REQUIRE(threads_stats[0].allocated == 0);
+    REQUIRE(threads_stats[0].total_allocations == threads_count * items);
+    REQUIRE(threads_stats[0].total_frees == threads_count * items);
+
+    // Live threads have their own entries
+    void* ptr = manger.malloc(10);
+    threads_stats = manger.threads_stats();
+    REQUIRE(threads_stats.size() == 2);
+    manger.free(ptr, 10);
+
+    threads_stats = manger.threads_stats();
+    int64_t allocated = 0;
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    for (auto& thread_stats : threads_stats)
+    {
+        allocated += thread_stats.allocated;
+        allocations += thread_stats.total_allocations;
+        frees += thread_stats.total_frees;
+    }
+    REQUIRE(allocated == 0);
+    REQUIRE(allocations == threads_count * items + 1);
+    REQUIRE(frees == threads_count * items + 1);
+}
+
+TEST_CASE("Thread cache memory manager", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.page() == 65536);
+
+    void* ptr = manger.malloc(1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 1);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 1);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Freed block should be reused from the thread magazine
+    void* cached = manger.malloc(10);
+    REQUIRE(cached == ptr);
+    REQUIRE(manger.allocated() == 10);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(cached, 10);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Huge block should be allocated from the memory pool
+    ptr = manger.malloc(100000);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 100000);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 100000);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Overflow thread magazines and the depot
+    std::vector<void*> pointers;
+    for (int i = 0; i < 10000; ++i)
+        pointers.push_back(manger.malloc(16));
+    REQUIRE(manger.allocated() == 160000);
+    REQUIRE(manger.allocations() == 10000);
+    for (auto pointer : pointers)
+        manger.free(pointer, 16);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    manger.reset();
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    ptr = manger.malloc(1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(manger.allocated() == 1);
+    REQUIRE(manger.allocations() == 1);
+    manger.free(ptr, 1);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Thread cache memory manager with cross-thread frees", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manger(auxiliary);
+
+    const int threads_count = 4;
+    const int items = 10000;
+
+    // Each thread allocates blocks and the next thread frees them
+    std::vector<std::vector<void*>> pointers(threads_count);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manger, &pointers, thread]()
+        {
+            for (int i = 0; i < items; ++i)
+            {
+                size_t size = 1 + ((thread * items + i) % 1000);
+                pointers[thread].push_back(manger.malloc(size));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    threads.clear();
+
+    REQUIRE(manger.allocations() == threads_count * items);
+
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&manger, &pointers, thread]()
+        {
+            int source = (thread + 1) % threads_count;
+            for (int i = 0; i < items; ++i)
+            {
+                size_t size = 1 + ((source * items + i) % 1000);
+                manger.free(pointers[source][i], size);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Thread cache allocator with stl containers", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ThreadCacheMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    ThreadCacheAllocator<int, DefaultMemoryManager> alloc(manger);
+
+    std::vector<int, decltype(alloc)> v(alloc);
+    v.push_back(0);
+    v.push_back(1);
+    v.push_back(2);
+    v.clear();
+
+    ThreadCacheAllocator<std::pair<const int, int>, DefaultMemoryManager> pair_alloc(alloc);
+    std::map<int, int, std::less<>, decltype(pair_alloc)> m(pair_alloc);
+    m[0] = 0;
+    m[1] = 10;
+    m[2] = 20;
+    m.clear();
+}
@@ -0,0 +1,59 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "memory/heap_profiler.h"
+
+#include <sstream>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Sampling heap profiler", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    ProfilerMemoryManager<DefaultMemoryManager> manger(auxiliary);
+
+    // Sample about one allocation per 1 kilobyte
+    HeapProfiler::Start(1024);
+    REQUIRE(HeapProfiler::IsRunning());
+    REQUIRE(HeapProfiler::GetRate() == 1024);
+
+    const size_t items = 10000;
+    const size_t size = 1024;
+
+    std::vector<void*> pointers;
+    for (size_t i = 0; i < items; ++i)
+        pointers.push_back(manger.malloc(size));
+
+    // Estimated live bytes should be close to the really allocated bytes
+    uint64_t live = HeapProfiler::GetLive();
+    REQUIRE(live > (items * size / 2));
+    REQUIRE(live < (items * size * 2));
+    REQUIRE(HeapProfiler::GetPeak() >= live);
+
+    std::vector<HeapProfileSite> sites = HeapProfiler::GetSites(1);
+    REQUIRE(sites.size() == 1);
+    REQUIRE(sites[0].samples > 0);
+    REQUIRE(sites[0].live > 0);
+
+    std::stringstream dump;
+    HeapProfiler::Dump(dump);
+    REQUIRE(!dump.str().empty());
+
+    for (auto ptr : pointers)
+        manger.free(ptr, size);
+
+    REQUIRE(HeapProfiler::GetLive() == 0);
+    REQUIRE(HeapProfiler::GetPeak() >= live);
+
+    HeapProfiler::Stop();
+    REQUIRE(!HeapProfiler::IsRunning());
+
+    // Stopped profiler does not sample allocations
+    void* ptr = manger.malloc(size);
+    REQUIRE(HeapProfiler::GetLive() == 0);
+    manger.free(ptr, size);
+}
@@ -5,6 +5,9 @@
 #include "test.h"
 
 #include "memory/memory.h"
+#include "memory/memory_telemetry.h"
+
+#include <vector>
 
 using namespace CppCommon;
 
@@ -14,6 +17,36 @@ TEST_CASE("Memory management", "[CppCommon][Memory]")
     REQUIRE(Memory::RamFree() > 0);
 }
 
+TEST_CASE("Memory telemetry", "[CppCommon][Memory]")
+{
+    MemoryTelemetry telemetry(Timespan::hours(1), Timespan::hours(1));
+
+    MemoryUsage usage1 = telemetry.Usage();
+    REQUIRE(usage1.timestamp > 0);
+    REQUIRE(usage1.ram_total > 0);
+    REQUIRE(usage1.ram_free > 0);
+    REQUIRE(usage1.rss > 0);
+    REQUIRE(usage1.minor_faults >= 0);
+
+    // Touch new memory pages
+    std::vector<uint8_t> buffer(16 * 1024 * 1024, 1);
+
+    // Cached snapshot is returned within the update interval
+    MemoryUsage usage2 = telemetry.Usage();
+    REQUIRE(usage2.timestamp == usage1.timestamp);
+    REQUIRE(usage2.rss == usage1.rss);
+
+    MemoryUsage usage3 = telemetry.Refresh();
+    REQUIRE(usage3.timestamp > usage1.timestamp);
+    REQUIRE(usage3.rss > usage1.rss);
+    REQUIRE(usage3.minor_faults > usage1.minor_faults);
+#if defined(__linux__)
+    REQUIRE(usage3.pss > 0);
+    REQUIRE(usage3.anonymous > 0);
+    REQUIRE(usage3.file >= 0);
+#endif
+}
+
 TEST_CASE("Memory align", "[CppCommon][Memory]")
 {
     REQUIRE(Memory::IsAligned((void*)0x7fff5ebcf4af, 1));
@@ -46,3 +79,47 @@ TEST_CASE("Memory align", "[CppCommon][Memory]")
     REQUIRE(Memory::Align((void*)0x7fff5ebcf47e, 32, false) == (void*)0x7fff5ebcf460);
     REQUIRE(Memory::Align((void*)0x7fff5ebcf4af, 64, false) == (void*)0x7fff5ebcf480);
 }
+
+TEST_CASE("Memory fill", "[CppCommon][Memory]")
+{
+    REQUIRE(Memory::CacheSize() > 0);
+
+    // Check all SIMD block boundaries with unaligned buffers
+    std::vector<uint8_t> buffer(1024 + 64, 0);
+    for (size_t offset = 0; offset < 64; offset += 7)
+    {
+        for (size_t size = 0; size <= 1024; size += 31)
+        {
+            uint8_t* ptr = buffer.data() + offset;
+            REQUIRE(Memory::IsZero(ptr, size));
+            for (size_t i = 0; i < size; i += 13)
+            {
+                ptr[i] = 1;
+                REQUIRE(!Memory::IsZero(ptr, size));
+                ptr[i] = 0;
+            }
+            if (size > 0)
+            {
+                ptr[size - 1] = 1;
+                REQUIRE(!Memory::IsZero(ptr, size));
+                REQUIRE(Memory::IsZero(ptr, size - 1));
+                ptr[size - 1] = 0;
+            }
+        }
+    }
+
+    // Random fill
+    Memory::RandomFill(buffer.data(), buffer.size());
+    REQUIRE(!Memory::IsZero(buffer.data(), buffer.size()));
+
+    // Zero fill
+    Memory::ZeroFill(buffer.data() + 3, buffer.size() - 3);
+    REQUIRE(Memory::IsZero(buffer.data() + 3, buffer.size() - 3));
+
+    // Zero fill of the buffer larger than the last level cache
+    std::vector<uint8_t> huge(Memory::CacheSize() + 123);
+    Memory::RandomFill(huge.data(), huge.size());
+    REQUIRE(!Memory::IsZero(huge.data(), huge.size()));
+    Memory::ZeroFill(huge.data() + 1, huge.size() - 1);
+    REQUIRE(Memory::IsZero(huge.data() + 1, huge.size() - 1));
+}
@@ -0,0 +1,144 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "memory/object_pool.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Object pool", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    ObjectPool<std::string> pool(manger, 16);
+    REQUIRE(pool.empty());
+    REQUIRE(pool.size() == 0);
+    REQUIRE(pool.capacity() == 0);
+    REQUIRE(!pool.valid(ObjectPool<std::string>::Invalid));
+
+    auto handle1 = pool.create("first");
+    auto handle2 = pool.create("second");
+    auto handle3 = pool.create(5, 'x');
+    REQUIRE(pool.size() == 3);
+    REQUIRE(pool.capacity() == 16);
+    REQUIRE(pool.chunks() == 1);
+    REQUIRE(*pool.get(handle1) == "first");
+    REQUIRE(*pool.get(handle2) == "second");
+    REQUIRE(*pool.get(handle3) == "xxxxx");
+
+    // Stale handles are detected
+    std::string* second = pool.get(handle2);
+    REQUIRE(pool.destroy(handle2));
+    REQUIRE(!pool.destroy(handle2));
+    REQUIRE(!pool.valid(handle2));
+    REQUIRE(pool.get(handle2) == nullptr);
+    REQUIRE(pool.size() == 2);
+
+    // Released slot is reused with a new generation
+    auto handle4 = pool.create("fourth");
+    REQUIRE(handle4 != handle2);
+    REQUIRE(pool.get(handle4) == second);
+    REQUIRE(pool.get(handle2) == nullptr);
+    REQUIRE(*pool.get(handle4) == "fourth");
+
+    // Iterate through live objects
+    std::set<std::string> values;
+    for (auto it = pool.begin(); it != pool.end(); ++it)
+    {
+        REQUIRE(pool.get(it.handle()) == &(*it));
+        values.insert(*it);
+    }
+    REQUIRE(values == std::set<std::string>({ "first", "xxxxx", "fourth" }));
+
+    pool.clear();
+    REQUIRE(pool.empty());
+    REQUIRE(pool.capacity() == 0);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+}
+
+TEST_CASE("Object pool with many chunks", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    ObjectPool<int, PoolMemoryManager<DefaultMemoryManager>, uint32_t> pool(manger, 64);
+
+    const int items = 10000;
+
+    std::vector<uint32_t> handles;
+    std::vector<int*> pointers;
+    for (int i = 0; i < items; ++i)
+    {
+        handles.push_back(pool.create(i));
+        pointers.push_back(pool.get(handles.back()));
+    }
+    REQUIRE(pool.size() == items);
+
+    // Objects are never moved
+    bool stable = true;
+    for (int i = 0; i < items; ++i)
+        stable &= (pool.get(handles[i]) == pointers[i]) && (*pointers[i] == i);
+    REQUIRE(stable);
+
+    // Destroy odd objects and check dense iteration
+    for (int i = 1; i < items; i += 2)
+        REQUIRE(pool.destroy(handles[i]));
+    REQUIRE(pool.size() == (items / 2));
+
+    int sum = 0;
+    for (const auto& item : pool)
+    {
+        REQUIRE((item % 2) == 0);
+        ++sum;
+    }
+    REQUIRE(sum == (items / 2));
+
+    // Destroy objects during iteration
+    for (auto it = pool.begin(); it != pool.end();)
+        pool.destroy(it.handle());
+    REQUIRE(pool.empty());
+
+    // Stale handles never resolve to new objects
+    for (int i = 0; i < items; ++i)
+        pool.create(-1);
+    bool stale = true;
+    for (int i = 0; i < items; ++i)
+        stale &= !pool.valid(handles[i]);
+    REQUIRE(stale);
+}
+
+TEST_CASE("Object pool with exhausted generations", "[CppCommon][Memory]")
+{
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manger(auxiliary);
+    ObjectPool<int, PoolMemoryManager<DefaultMemoryManager>, uint32_t> pool(manger, 1);
+
+    // Reuse the single slot until its generation is exhausted
+    uint32_t first = pool.create(0);
+    uint32_t last = first;
+    REQUIRE(pool.destroy(last));
+    for (size_t i = 2; i < ((size_t)1 << decltype(pool)::GenerationBits); ++i)
+    {
+        last = pool.create((int)i);
+        REQUIRE(pool.destroy(last));
+    }
+    REQUIRE(pool.chunks() == 1);
+    REQUIRE(pool.retired() == 1);
+
+    // Retired slot is never reused, so stale handles never resolve
+    uint32_t handle = pool.create(-1);
+    REQUIRE(pool.chunks() == 2);
+    REQUIRE(handle != first);
+    REQUIRE(!pool.valid(first));
+    REQUIRE(!pool.valid(last));
+    REQUIRE(*pool.get(handle) == -1);
+
+    pool.clear();
+    REQUIRE(pool.retired() == 0);
+}
@@ -0,0 +1,54 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_event_auto_reset.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<> Waiter(AsyncEventAutoReset& event, std::vector<int>& order, int index)
+{
+    co_await event;
+    order.push_back(index);
+}
+
+} // namespace
+
+TEST_CASE("Coroutine auto-reset event", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::vector<int> order;
+
+    AsyncEventAutoReset event;
+
+    // Start some coroutines suspended on the event
+    std::vector<Task<>> tasks;
+    for (int i = 0; i < concurrency; ++i)
+    {
+        tasks.emplace_back(Waiter(event, order, i));
+        tasks.back().Start();
+    }
+    REQUIRE(order.empty());
+
+    // Each signal resumes exactly one coroutine in FIFO order
+    for (int i = 0; i < concurrency; ++i)
+    {
+        event.Signal();
+        REQUIRE(order.size() == (size_t)(i + 1));
+        REQUIRE(order.back() == i);
+    }
+
+    // Signal without waiters is kept until the next await
+    event.Signal();
+    REQUIRE(event.TryWait());
+    REQUIRE(!event.TryWait());
+    event.Signal();
+    SyncWait(Waiter(event, order, concurrency));
+    REQUIRE(order.back() == concurrency);
+}
@@ -0,0 +1,74 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_event_manual_reset.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<> Waiter(AsyncEventManualReset& event, std::atomic<int>& count)
+{
+    co_await event;
+    ++count;
+}
+
+Task<> PoolWaiter(AsyncEventManualReset& event, Executor& executor, std::atomic<int>& count)
+{
+    co_await event.Wait(executor);
+    if (ThreadPool::CurrentWorker() >= 0)
+        ++count;
+}
+
+} // namespace
+
+TEST_CASE("Coroutine manual-reset event", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::atomic<int> count(0);
+
+    AsyncEventManualReset event;
+
+    // Start some coroutines suspended on the event
+    std::vector<Task<>> tasks;
+    for (int i = 0; i < concurrency; ++i)
+    {
+        tasks.emplace_back(Waiter(event, count));
+        tasks.back().Start();
+    }
+    REQUIRE(count == 0);
+
+    // Signal the event
+    event.Signal();
+    REQUIRE(event.signaled());
+    REQUIRE(count == concurrency);
+    for (auto& task : tasks)
+        REQUIRE(task.done());
+
+    // Signaled event does not suspend
+    SyncWait(Waiter(event, count));
+    REQUIRE(count == (concurrency + 1));
+    event.Reset();
+    REQUIRE(!event.signaled());
+
+    // Coroutines resumed in the thread pool
+    ThreadPool pool(2);
+    PoolExecutor<ThreadPool> executor(pool);
+    std::atomic<int> resumed(0);
+    std::vector<Task<>> pooled;
+    for (int i = 0; i < concurrency; ++i)
+    {
+        pooled.emplace_back(PoolWaiter(event, executor, resumed));
+        pooled.back().Start();
+    }
+    event.Signal();
+    pool.Wait();
+    REQUIRE(resumed == concurrency);
+}
@@ -0,0 +1,64 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_latch.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<> Waiter(AsyncLatch& latch, std::atomic<int>& count)
+{
+    co_await latch;
+    ++count;
+}
+
+} // namespace
+
+TEST_CASE("Coroutine latch", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::atomic<int> count(0);
+
+    AsyncLatch latch(concurrency);
+    REQUIRE(latch.counter() == (size_t)concurrency);
+
+    // Start the coroutine suspended on the latch
+    Task<> task = Waiter(latch, count);
+    task.Start();
+
+    // Count down the latch from some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&latch, thread]()
+        {
+            // Sleep for a while...
+            Thread::Sleep(thread * 10);
+
+            // Count down the latch
+            latch.CountDown();
+        });
+    }
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    REQUIRE(latch.ready());
+    REQUIRE(task.done());
+    REQUIRE(count == 1);
+
+    // Ready latch does not suspend
+    SyncWait(Waiter(latch, count));
+    REQUIRE(count == 2);
+}
@@ -0,0 +1,74 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_task.h"
+#include "threads/thread_pool.h"
+
+#include <stdexcept>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<int> Value(int value)
+{
+    co_return value;
+}
+
+Task<int> Sum(int count)
+{
+    int sum = 0;
+    for (int i = 1; i <= count; ++i)
+        sum += co_await Value(i);
+    co_return sum;
+}
+
+Task<> Throw()
+{
+    throw std::runtime_error("Coroutine exception");
+    co_return;
+}
+
+Task<int> Switch(ThreadPool& pool)
+{
+    // Continue the coroutine in the thread pool worker
+    struct Awaiter
+    {
+        PoolExecutor<ThreadPool> executor;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) { executor.Execute(handle); }
+        void await_resume() const noexcept {}
+    };
+
+    co_await Awaiter{ PoolExecutor<ThreadPool>(pool) };
+    co_return ThreadPool::CurrentWorker();
+}
+
+} // namespace
+
+TEST_CASE("Coroutine task", "[CppCommon][Threads]")
+{
+    // Lazy task is started by the awaiter
+    Task<int> task = Sum(100);
+    REQUIRE(task.valid());
+    REQUIRE(!task.done());
+    REQUIRE(SyncWait(std::move(task)) == 5050);
+
+    // Explicitly started task
+    Task<int> started = Value(42);
+    started.Start();
+    REQUIRE(started.done());
+    REQUIRE(started.Get() == 42);
+
+    // Exceptions are propagated to the awaiter
+    REQUIRE_THROWS_AS(SyncWait(Throw()), std::runtime_error);
+
+    // Task resumed in the thread pool
+    ThreadPool pool(2);
+    int worker = SyncWait(Switch(pool));
+    REQUIRE(worker >= 0);
+    REQUIRE(worker < 2);
+}
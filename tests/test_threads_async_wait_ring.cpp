@@ -0,0 +1,137 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_wait_ring.h"
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<> Producer(AsyncWaitRing<int>& ring, int from, int to, Executor& executor)
+{
+    for (int i = from; i < to; ++i)
+        if (!co_await ring.Enqueue(i, executor))
+            co_return;
+}
+
+Task<uint64_t> Consumer(AsyncWaitRing<int>& ring, Executor& executor)
+{
+    uint64_t crc = 0;
+    int item;
+    while (co_await ring.Dequeue(item, executor))
+        crc += item;
+    co_return crc;
+}
+
+} // namespace
+
+TEST_CASE("Multiple producers / multiple consumers coroutine wait ring", "[CppCommon][Threads]")
+{
+    AsyncWaitRing<int> ring(2);
+
+    REQUIRE(ring.capacity() == 2);
+    REQUIRE(ring.empty());
+
+    // Consumer is suspended on the empty ring
+    Task<uint64_t> consumer = Consumer(ring, Executor::Inline());
+    consumer.Start();
+    REQUIRE(!consumer.done());
+
+    // Items are handed over to the suspended consumer
+    Task<> producer = Producer(ring, 0, 10, Executor::Inline());
+    producer.Start();
+    REQUIRE(producer.done());
+    REQUIRE(ring.empty());
+
+    // Close resumes the suspended consumer
+    ring.Close();
+    REQUIRE(ring.closed());
+    REQUIRE(consumer.done());
+    REQUIRE(consumer.Get() == 45);
+
+    // Closed ring does not accept new items
+    int item = -1;
+    REQUIRE(!SyncWait([](AsyncWaitRing<int>& q) -> Task<bool> { co_return co_await q.Enqueue(0); }(ring)));
+    REQUIRE(!SyncWait([](AsyncWaitRing<int>& q, int& v) -> Task<bool> { co_return co_await q.Dequeue(v); }(ring, item)));
+}
+
+TEST_CASE("Multiple producers / multiple consumers coroutine wait ring when full", "[CppCommon][Threads]")
+{
+    AsyncWaitRing<int> ring(2);
+
+    // Producer is suspended while the ring is full
+    Task<> producer = Producer(ring, 0, 10, Executor::Inline());
+    producer.Start();
+    REQUIRE(!producer.done());
+    REQUIRE(ring.size() == 2);
+
+    // Consumer resumes the producer
+    std::vector<int> items;
+    for (int i = 0; i < 10; ++i)
+    {
+        int item = -1;
+        auto task = [](AsyncWaitRing<int>& q, int& v) -> Task<bool> { co_return co_await q.Dequeue(v); }(ring, item);
+        task.Start();
+        REQUIRE(task.done());
+        REQUIRE(task.Get());
+        items.push_back(item);
+    }
+    REQUIRE(producer.done());
+    REQUIRE(items == std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+}
+
+TEST_CASE("Multiple producers / multiple consumers coroutine wait ring threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 100000;
+    int producers_count = 4;
+    int consumers_count = 4;
+
+    AsyncWaitRing<int> ring(1024);
+
+    ThreadPool pool(4);
+    PoolExecutor<ThreadPool> executor(pool);
+
+    // Start consumer coroutines which are resumed in the thread pool
+    std::vector<Task<uint64_t>> consumers;
+    for (int i = 0; i < consumers_count; ++i)
+    {
+        consumers.emplace_back(Consumer(ring, executor));
+        consumers.back().Start();
+    }
+
+    // Start producer coroutines which are resumed in the thread pool
+    std::vector<Task<>> producers;
+    for (int i = 0; i < producers_count; ++i)
+    {
+        producers.emplace_back(Producer(ring, i * (items_to_produce / producers_count), (i + 1) * (items_to_produce / producers_count), executor));
+        producers.back().Start();
+    }
+
+    // Wait for all producers
+    for (auto& producer : producers)
+        while (!producer.done())
+            Thread::Yield();
+
+    // Close the ring and wait for all consumers
+    ring.Close();
+    uint64_t crc = 0;
+    for (auto& consumer : consumers)
+    {
+        while (!consumer.done())
+            Thread::Yield();
+        crc += consumer.Get();
+    }
+
+    uint64_t expected = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        expected += i;
+
+    REQUIRE(crc == expected);
+}
@@ -0,0 +1,130 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/epoch_manager.h"
+#include "threads/event_manual_reset.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+std::atomic<int> destroyed(0);
+
+struct Item
+{
+    int value;
+    std::atomic<Item*> next;
+
+    explicit Item(int v) : value(v), next(nullptr) {}
+    ~Item() { ++destroyed; }
+};
+
+} // namespace
+
+TEST_CASE("Epoch manager", "[CppCommon][Threads]")
+{
+    destroyed = 0;
+
+    {
+        EpochManager manager;
+
+        // Retired objects are freed after the grace period
+        for (int i = 0; i < 10; ++i)
+            manager.Retire(new Item(i));
+        REQUIRE(destroyed == 0);
+        manager.Synchronize();
+        REQUIRE(destroyed == 10);
+
+        // Reader inside the critical section blocks the reclamation
+        EventManualReset entered;
+        EventManualReset leave;
+        std::thread reader([&manager, &entered, &leave]()
+        {
+            EpochManager::Guard guard(manager);
+            entered.Signal();
+            leave.Wait();
+        });
+        entered.Wait();
+
+        manager.Retire(new Item(0));
+        for (int i = 0; i < 10; ++i)
+            manager.Reclaim();
+        REQUIRE(destroyed == 10);
+
+        leave.Signal();
+        reader.join();
+        manager.Synchronize();
+        REQUIRE(destroyed == 11);
+
+        // Pending objects are freed with the manager
+        manager.Retire(new Item(0));
+    }
+
+    REQUIRE(destroyed == 12);
+}
+
+TEST_CASE("Epoch manager lock-free stack", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int threads_count = 4;
+
+    destroyed = 0;
+
+    {
+        EpochManager manager;
+        std::atomic<Item*> top(nullptr);
+        std::atomic<int> popped(0);
+
+        // Start threads which push and pop items of the shared stack
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threads_count; ++thread)
+        {
+            threads.emplace_back([&manager, &top, &popped, items_to_produce, threads_count]()
+            {
+                for (int i = 0; i < (items_to_produce / threads_count); ++i)
+                {
+                    // Push the item
+                    Item* item = new Item(i);
+                    Item* head = top.load();
+                    do
+                    {
+                        item->next.store(head);
+                    } while (!top.compare_exchange_weak(head, item));
+
+                    // Pop the item and access it inside the critical section
+                    Item* pop = nullptr;
+                    {
+                        EpochManager::Guard guard(manager);
+                        pop = top.load();
+                        while ((pop != nullptr) && !top.compare_exchange_weak(pop, pop->next.load()));
+                    }
+
+                    if (pop != nullptr)
+                    {
+                        ++popped;
+                        manager.Retire(pop);
+                    }
+                }
+
+                manager.UnregisterThread();
+            });
+        }
+
+        // Wait for all threads
+        for (auto& thread : threads)
+            thread.join();
+
+        // Check results
+        REQUIRE(popped == items_to_produce);
+        REQUIRE(top.load() == nullptr);
+    }
+
+    REQUIRE(destroyed == items_to_produce);
+}
@@ -0,0 +1,57 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/futex_event_manual_reset.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Futex manual-reset event", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::atomic<int> count(0);
+
+    FutexEventManualReset event;
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&event, &count, thread]()
+        {
+            // Sleep for a while...
+            Thread::Sleep(thread * 10);
+
+            // Wait for the event
+            event.Wait();
+
+            // Increment threads counter
+            ++count;
+        });
+    }
+
+    // Allow threads to start
+    Thread::Sleep(100);
+
+    // Signal the event
+    event.Signal();
+
+    // Wait for all threads to complete
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    REQUIRE(count == concurrency);
+
+    // Test TryWaitFor() method
+    REQUIRE(event.TryWaitFor(Timespan::milliseconds(10)));
+    event.Reset();
+    REQUIRE(!event.TryWait());
+    REQUIRE(!event.TryWaitFor(Timespan::milliseconds(10)));
+}
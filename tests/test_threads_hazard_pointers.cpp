@@ -0,0 +1,152 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/hazard_pointers.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+std::atomic<int> destroyed(0);
+
+struct Item
+{
+    int value;
+    std::atomic<Item*> next;
+
+    explicit Item(int v) : value(v), next(nullptr) {}
+    ~Item() { ++destroyed; }
+};
+
+} // namespace
+
+TEST_CASE("Hazard pointers", "[CppCommon][Threads]")
+{
+    destroyed = 0;
+
+    {
+        HazardPointers hazards(2, 4);
+        REQUIRE(hazards.hazards() == 2);
+        REQUIRE(hazards.threshold() == 4);
+
+        // Protected object is not freed
+        std::atomic<Item*> shared(new Item(0));
+        Item* item = hazards.Protect(0, shared);
+        REQUIRE(item == shared.load());
+        shared.store(nullptr);
+        hazards.Retire(item);
+        hazards.Reclaim();
+        REQUIRE(destroyed == 0);
+
+        // Released object is freed
+        hazards.Clear(0);
+        hazards.Reclaim();
+        REQUIRE(destroyed == 1);
+
+        // Retired objects are freed in batches
+        for (int i = 0; i < 4; ++i)
+            hazards.Retire(new Item(i));
+        REQUIRE(destroyed == 5);
+
+        // Pending objects are freed with the manager
+        hazards.Set(1, item = new Item(0));
+        hazards.Retire(item);
+        hazards.Reclaim();
+        REQUIRE(destroyed == 5);
+        hazards.ClearAll();
+    }
+
+    REQUIRE(destroyed == 6);
+}
+
+TEST_CASE("Hazard pointers of exited threads", "[CppCommon][Threads]")
+{
+    destroyed = 0;
+
+    {
+        HazardPointers hazards(2, 4);
+
+        // Thread exits without clearing its hazard pointer
+        std::atomic<Item*> shared(new Item(0));
+        Item* item = nullptr;
+        std::thread reader([&hazards, &shared, &item]() { item = hazards.Protect(0, shared); });
+        reader.join();
+        REQUIRE(item == shared.load());
+
+        // Object protected by the exited thread is freed
+        shared.store(nullptr);
+        hazards.Retire(item);
+        hazards.Reclaim();
+        REQUIRE(destroyed == 1);
+    }
+
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("Hazard pointers lock-free stack", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int threads_count = 4;
+
+    destroyed = 0;
+
+    {
+        HazardPointers hazards(1);
+        std::atomic<Item*> top(nullptr);
+        std::atomic<int> popped(0);
+
+        // Start threads which push and pop items of the shared stack
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threads_count; ++thread)
+        {
+            threads.emplace_back([&hazards, &top, &popped, items_to_produce, threads_count]()
+            {
+                for (int i = 0; i < (items_to_produce / threads_count); ++i)
+                {
+                    // Push the item
+                    Item* item = new Item(i);
+                    Item* head = top.load();
+                    do
+                    {
+                        item->next.store(head);
+                    } while (!top.compare_exchange_weak(head, item));
+
+                    // Pop the item protected by the hazard pointer
+                    Item* pop = nullptr;
+                    for (;;)
+                    {
+                        pop = hazards.Protect(0, top);
+                        if ((pop == nullptr) || top.compare_exchange_strong(pop, pop->next.load()))
+                            break;
+                    }
+                    hazards.Clear(0);
+
+                    if (pop != nullptr)
+                    {
+                        ++popped;
+                        hazards.Retire(pop);
+                    }
+                }
+
+                hazards.UnregisterThread();
+            });
+        }
+
+        // Wait for all threads
+        for (auto& thread : threads)
+            thread.join();
+
+        // Check results
+        REQUIRE(popped == items_to_produce);
+        REQUIRE(top.load() == nullptr);
+    }
+
+    REQUIRE(destroyed == items_to_produce);
+}
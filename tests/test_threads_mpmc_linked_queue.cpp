@@ -0,0 +1,159 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/mpmc_linked_queue.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Multiple producers / multiple consumers lock-free segmented linked queue", "[CppCommon][Threads]")
+{
+    MPMCLinkedQueue<int> queue(4);
+
+    REQUIRE(queue.segment() == 4);
+
+    int v = -1;
+
+    REQUIRE(!queue.Dequeue(v));
+
+    // Enqueue items into several segments
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(queue.Enqueue(i));
+
+    for (int i = 0; i < 5; ++i)
+        REQUIRE((queue.Dequeue(v) && (v == i)));
+
+    for (int i = 10; i < 20; ++i)
+        REQUIRE(queue.Enqueue(i));
+
+    for (int i = 5; i < 20; ++i)
+        REQUIRE((queue.Dequeue(v) && (v == i)));
+
+    REQUIRE(!queue.Dequeue(v));
+
+    REQUIRE(queue.Enqueue(20));
+    REQUIRE((queue.Dequeue(v) && (v == 20)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+namespace {
+
+struct Throwing
+{
+    static bool fail;
+
+    int value;
+
+    Throwing(int v = 0) : value(v) {}
+    Throwing(Throwing&& other) = default;
+    Throwing& operator=(Throwing&& other)
+    {
+        if (fail)
+            throw std::runtime_error("Move failed!");
+        value = other.value;
+        return *this;
+    }
+};
+
+bool Throwing::fail = false;
+
+} // namespace
+
+TEST_CASE("Multiple producers / multiple consumers lock-free segmented linked queue with throwing items", "[CppCommon][Threads]")
+{
+    MPMCLinkedQueue<Throwing> queue(2);
+
+    Throwing v;
+
+    // Failed enqueue does not break the linked queue
+    for (int i = 0; i < 4; ++i)
+    {
+        Throwing::fail = true;
+        REQUIRE_THROWS(queue.Enqueue(Throwing(i)));
+        Throwing::fail = false;
+        REQUIRE(queue.Enqueue(Throwing(i)));
+    }
+
+    for (int i = 0; i < 4; ++i)
+        REQUIRE((queue.Dequeue(v) && (v.value == i)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free segmented linked queue threads", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+    const int producers_count = 4;
+    const int consumers_count = 4;
+
+    MPMCLinkedQueue<int> queue(64);
+
+    std::atomic<int> consumed(0);
+    std::atomic<int64_t> crc(0);
+    std::atomic<int> errors(0);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &consumed, &crc, &errors, items_to_produce, producers_count]()
+        {
+            // Items of the same producer must be consumed in FIFO order
+            std::vector<int> last(producers_count, -1);
+            int64_t sum = 0;
+            while (consumed < items_to_produce)
+            {
+                int item;
+                if (!queue.Dequeue(item))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                int producer = item / (items_to_produce / producers_count);
+                if (item <= last[producer])
+                    ++errors;
+                last[producer] = item;
+
+                sum += item;
+                ++consumed;
+            }
+            crc += sum;
+        });
+    }
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &errors, producer, items_to_produce, producers_count]()
+        {
+            int items = items_to_produce / producers_count;
+            for (int i = 0; i < items; ++i)
+                if (!queue.Enqueue(items * producer + i))
+                    ++errors;
+        });
+    }
+
+    // Wait for all threads
+    for (auto& producer : producers)
+        producer.join();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Check result
+    REQUIRE(errors == 0);
+    REQUIRE(consumed == items_to_produce);
+    REQUIRE(crc == result);
+}
@@ -6,6 +6,11 @@
 
 #include "threads/mpmc_ring_queue.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / multiple consumers wait-free ring queue", "[CppCommon][Threads]")
@@ -48,3 +53,99 @@ TEST_CASE("Multiple producers / multiple consumers wait-free ring queue", "[CppC
     REQUIRE(queue.capacity() == 4);
     REQUIRE(queue.size() == 0);
 }
+
+TEST_CASE("Multiple producers / multiple consumers wait-free ring queue bulk", "[CppCommon][Threads]")
+{
+    MPMCRingQueue<int> queue(8);
+
+    int items[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    int output[10] = { 0 };
+
+    REQUIRE(queue.DequeueBulk(output, 10) == 0);
+    REQUIRE(queue.EnqueueBulk(items, items) == 0);
+
+    REQUIRE(((queue.EnqueueBulk(items, items + 3) == 3) && (queue.size() == 3)));
+    REQUIRE(((queue.EnqueueBulk(items + 3, items + 10) == 5) && (queue.size() == 8)));
+    REQUIRE(queue.EnqueueBulk(items + 8, items + 10) == 0);
+
+    REQUIRE(((queue.DequeueBulk(output, 2) == 2) && (queue.size() == 6)));
+    REQUIRE(((output[0] == 0) && (output[1] == 1)));
+
+    REQUIRE(((queue.EnqueueBulk(items + 8, items + 10) == 2) && (queue.size() == 8)));
+
+    REQUIRE(((queue.DequeueBulk(output, 10) == 8) && (queue.size() == 0)));
+    for (int i = 0; i < 8; ++i)
+        REQUIRE(output[i] == (i + 2));
+
+    int v = -1;
+    REQUIRE(queue.Enqueue(10));
+    REQUIRE(((queue.DequeueBulk(&v, 1) == 1) && (v == 10)));
+    REQUIRE(queue.size() == 0);
+}
+
+TEST_CASE("Multiple producers / multiple consumers wait-free ring queue bulk threads", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+    const int producers_count = 4;
+    const int consumers_count = 2;
+    const int batch = 16;
+
+    MPMCRingQueue<int> queue(1024);
+
+    std::atomic<int> consumed(0);
+    std::atomic<int64_t> crc(0);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &consumed, &crc, items_to_produce, batch]()
+        {
+            int items[batch];
+            int64_t sum = 0;
+            while (consumed < items_to_produce)
+            {
+                size_t count = queue.DequeueBulk(items, batch);
+                for (size_t i = 0; i < count; ++i)
+                    sum += items[i];
+                consumed += (int)count;
+            }
+            crc += sum;
+        });
+    }
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, items_to_produce, producers_count, batch]()
+        {
+            int items = items_to_produce / producers_count;
+            int buffer[batch];
+            for (int i = 0; i < items; i += batch)
+            {
+                int count = std::min(batch, items - i);
+                for (int j = 0; j < count; ++j)
+                    buffer[j] = items * producer + i + j;
+
+                int enqueued = 0;
+                while (enqueued < count)
+                    enqueued += (int)queue.EnqueueBulk(buffer + enqueued, buffer + count);
+            }
+        });
+    }
+
+    // Wait for all threads
+    for (auto& producer : producers)
+        producer.join();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Check result
+    REQUIRE(crc == result);
+}
@@ -6,6 +6,9 @@
 
 #include "threads/mpsc_ring_buffer.h"
 
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / single consumer wait-free ring buffer", "[CppCommon][Threads]")
@@ -43,3 +46,122 @@ TEST_CASE("Multiple producers / single consumer wait-free ring buffer", "[CppCom
     REQUIRE(buffer.capacity() == 3);
     REQUIRE(buffer.size() == 0);
 }
+
+TEST_CASE("Multiple producers / single consumer wait-free ring buffer threads", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+    const int producers_count = 8;
+
+    // More producers than dedicated ring buffers to use the shared one
+    MPSCRingBuffer buffer(1024, 4);
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&buffer, producer, items_to_produce, producers_count]()
+        {
+            int items = items_to_produce / producers_count;
+            for (int i = 0; i < items; ++i)
+            {
+                int item = producer * items + i;
+                while (!buffer.Enqueue(&item, sizeof(item)))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Consume items
+    int64_t crc = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        int item;
+        size_t size = sizeof(item);
+        while (!buffer.Dequeue(&item, size))
+        {
+            size = sizeof(item);
+            std::this_thread::yield();
+        }
+
+        crc += item;
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Check result
+    REQUIRE(crc == result);
+    REQUIRE(buffer.size() == 0);
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free ring buffer zero-copy", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+    const int producers_count = 8;
+
+    // More producers than dedicated ring buffers to use the shared one
+    MPSCRingBuffer buffer(1024, 4);
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&buffer, producer, items_to_produce, producers_count]()
+        {
+            int items = items_to_produce / producers_count;
+            for (int i = 0; i < items; ++i)
+            {
+                void* data;
+                while ((data = buffer.Reserve(sizeof(int))) == nullptr)
+                    std::this_thread::yield();
+
+                int item = producer * items + i;
+                memcpy(data, &item, sizeof(int));
+                buffer.Commit(sizeof(int));
+            }
+        });
+    }
+
+    // Consume items
+    int64_t crc = 0;
+    int count = 0;
+    while (count < items_to_produce)
+    {
+        size_t size;
+        const uint8_t* data = (const uint8_t*)buffer.Peek(size);
+        if (data == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        REQUIRE((size % sizeof(int)) == 0);
+        for (size_t i = 0; i < size; i += sizeof(int))
+        {
+            int item;
+            memcpy(&item, data + i, sizeof(int));
+            crc += item;
+            ++count;
+        }
+        buffer.Release(size);
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Check result
+    REQUIRE(crc == result);
+    REQUIRE(buffer.size() == 0);
+}
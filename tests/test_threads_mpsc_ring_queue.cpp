@@ -6,6 +6,10 @@
 
 #include "threads/mpsc_ring_queue.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / single consumer wait-free ring queue", "[CppCommon][Threads]")
@@ -71,3 +75,93 @@ TEST_CASE("Multiple producers / single consumer wait-free ring queue (batch mode
     REQUIRE(batcher.capacity() == 3);
     REQUIRE(batcher.size() == 0);
 }
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue threads", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+    const int producers_count = 8;
+
+    // More producers than dedicated ring queues to use the shared one
+    MPSCRingQueue<int> queue(1024, 4);
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, items_to_produce, producers_count]()
+        {
+            int items = items_to_produce / producers_count;
+            for (int i = 0; i < items; ++i)
+                while (!queue.Enqueue(producer * items + i))
+                    std::this_thread::yield();
+        });
+    }
+
+    // Consume items and check FIFO order of each producer
+    std::vector<int> last(producers_count, -1);
+    int64_t crc = 0;
+    bool ordered = true;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        int item;
+        while (!queue.Dequeue(item))
+            std::this_thread::yield();
+
+        int producer = item / (items_to_produce / producers_count);
+        ordered = ordered && (item > last[producer]);
+        last[producer] = item;
+        crc += item;
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Check result
+    REQUIRE(ordered);
+    REQUIRE(crc == result);
+    REQUIRE(queue.size() == 0);
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue producer promotion", "[CppCommon][Threads]")
+{
+    Internals::ProducerLanes<SPSCRingQueue<int>> lanes(16, 1);
+
+    // Another thread owns the single dedicated lane
+    std::atomic<int> state(0);
+    std::thread owner([&lanes, &state]()
+    {
+        bool shared = lanes.Current().shared;
+        state = shared ? -1 : 1;
+        while (state != 2)
+            std::this_thread::yield();
+    });
+    while (state == 0)
+        std::this_thread::yield();
+    REQUIRE(state == 1);
+
+    // The current thread uses the shared lane
+    auto& shared = lanes.Current();
+    REQUIRE(shared.shared);
+    REQUIRE(shared.data.Enqueue(1));
+
+    // Release the dedicated lane
+    state = 2;
+    owner.join();
+
+    // Promotion is not possible until previous items are consumed
+    REQUIRE(lanes.Promote().shared);
+    int item;
+    REQUIRE(shared.data.Dequeue(item));
+    REQUIRE(item == 1);
+
+    // Promote the current thread to the released dedicated lane
+    auto& dedicated = lanes.Promote();
+    REQUIRE(!dedicated.shared);
+    REQUIRE(&lanes.Current() == &dedicated);
+}
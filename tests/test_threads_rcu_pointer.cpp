@@ -0,0 +1,93 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/rcu_pointer.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Config
+{
+    int version;
+    std::string name;
+    int checksum;
+};
+
+} // namespace
+
+TEST_CASE("RCU pointer", "[CppCommon][Threads]")
+{
+    EpochManager manager;
+    RCUPointer<Config> config(manager);
+
+    // Test empty value
+    REQUIRE(!config.Read());
+
+    // Test Update() method
+    config.Update(std::make_unique<Config>(Config{ 1, "first", 1 }));
+    {
+        auto reader = config.Read();
+        REQUIRE(reader);
+        REQUIRE(reader->version == 1);
+        REQUIRE((*reader).name == "first");
+    }
+
+    // Test Modify() method
+    config.Modify([](Config& value) { value.version = 2; value.name = "second"; });
+    REQUIRE(config.Read()->version == 2);
+    REQUIRE(config.Read()->name == "second");
+    config.Synchronize();
+}
+
+TEST_CASE("RCU pointer readers and writer", "[CppCommon][Threads]")
+{
+    int updates = 1000;
+    int readers_count = 4;
+
+    EpochManager manager(16);
+    RCUPointer<Config> config(manager, std::make_unique<Config>(Config{ 0, "0", 0 }));
+
+    std::atomic<bool> stop(false);
+    std::atomic<int> errors(0);
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&config, &stop, &errors]()
+        {
+            int version = 0;
+            while (!stop)
+            {
+                auto current = config.Read();
+
+                // Values are always consistent and never go back
+                if ((current->checksum != current->version) || (current->name != std::to_string(current->version)) || (current->version < version))
+                    ++errors;
+                version = current->version;
+            }
+        });
+    }
+
+    // Update the value
+    for (int i = 1; i <= updates; ++i)
+        config.Modify([i](Config& value) { value.version = i; value.name = std::to_string(i); value.checksum = i; });
+
+    // Wait for all readers threads
+    stop = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    // Check results
+    REQUIRE(errors == 0);
+    REQUIRE(config.Read()->version == updates);
+}
@@ -0,0 +1,183 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/scalable_rw_lock.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Scalable read/write lock", "[CppCommon][Threads]")
+{
+    ScalableRWLock lock;
+
+    // Test TryLockRead() method
+    REQUIRE(lock.TryLockRead());
+    REQUIRE(!lock.TryLockWrite());
+    lock.UnlockRead();
+
+    // Test TryLockWrite() method
+    REQUIRE(lock.TryLockWrite());
+    REQUIRE(!lock.TryLockRead());
+    lock.UnlockWrite();
+
+    // Test LockRead()/UnlockRead() methods
+    lock.LockRead();
+    REQUIRE(!lock.TryLockWrite());
+    lock.UnlockRead();
+
+    // Test LockWrite()/UnlockWrite() methods
+    lock.LockWrite();
+    REQUIRE(!lock.TryLockRead());
+    lock.UnlockWrite();
+
+    // Test TryLockReadFor()/TryLockWriteFor() methods
+    lock.LockWrite();
+    REQUIRE(!lock.TryLockReadFor(Timespan::milliseconds(10)));
+    lock.UnlockWrite();
+    REQUIRE(lock.TryLockReadFor(Timespan::milliseconds(10)));
+    REQUIRE(!lock.TryLockWriteFor(Timespan::milliseconds(10)));
+    lock.UnlockRead();
+    REQUIRE(lock.TryLockWriteFor(Timespan::milliseconds(10)));
+    lock.UnlockWrite();
+}
+
+TEST_CASE("Scalable read/write lock readers and writers", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int readers_count = 8;
+    int writers_count = 2;
+
+    // Two values are always updated together under the write lock
+    int first = 0;
+    int second = 0;
+    std::atomic<int> errors(0);
+
+    ScalableRWLock lock(4);
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&lock, &first, &second, &errors, items_to_produce]()
+        {
+            for (int i = 0; i < items_to_produce; ++i)
+            {
+                ReadLocker<ScalableRWLock> locker(lock);
+                if (first != second)
+                    ++errors;
+            }
+        });
+    }
+
+    // Start writers threads
+    std::vector<std::thread> writers;
+    for (int writer = 0; writer < writers_count; ++writer)
+    {
+        writers.emplace_back([&lock, &first, &second, items_to_produce, writers_count]()
+        {
+            for (int i = 0; i < (items_to_produce / 100 / writers_count); ++i)
+            {
+                WriteLocker<ScalableRWLock> locker(lock);
+                ++first;
+                ++second;
+            }
+        });
+    }
+
+    // Wait for all readers and writers threads
+    for (auto& reader : readers)
+        reader.join();
+    for (auto& writer : writers)
+        writer.join();
+
+    // Check result
+    REQUIRE(errors == 0);
+    REQUIRE(first == (items_to_produce / 100));
+    REQUIRE(second == (items_to_produce / 100));
+}
+
+TEST_CASE("Scalable read/write locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10;
+    int consumers_count = 4;
+    int crc = 0;
+    std::vector<int> crcs;
+    int current = 0;
+
+    ScalableRWLock lock;
+
+    // Reset consumers' results
+    for (int i = 0; i < consumers_count; ++i)
+        crcs.push_back(0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start producer thread
+    std::thread producer = std::thread([&lock, &crc, &current, items_to_produce]()
+    {
+        for (int i = 0; i < items_to_produce; ++i)
+        {
+            // Use a write locker to produce the item
+            {
+                WriteLocker<ScalableRWLock> locker(lock);
+
+                // Update the current produced item and produced crc
+                current = i;
+                crc += current;
+            }
+
+            // Sleep for a while...
+            Thread::Sleep(10);
+        }
+    });
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&lock, &crcs, &current, consumer, items_to_produce]()
+        {
+            int item = 0;
+            while (item < (items_to_produce - 1))
+            {
+                // Use a read locker to consume the item
+                {
+                    ReadLocker<ScalableRWLock> locker(lock);
+
+                    // Check for the current item changed
+                    if (item != current)
+                    {
+                        // Update consumed crc
+                        item = current;
+                        crcs[consumer] += item;
+                    }
+                }
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Wait for producer thread
+    producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+    for (int i = 0; i < consumers_count; ++i)
+        REQUIRE(crcs[i] > 0);
+}
@@ -0,0 +1,174 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/spmc_multicast_ring.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Single producer / multiple consumers wait-free multicast ring", "[CppCommon][Threads]")
+{
+    SPMCMulticastRing<int> ring(4);
+
+    size_t a = ring.AddConsumer();
+    size_t b = ring.AddConsumer();
+
+    REQUIRE(ring.capacity() == 4);
+    REQUIRE(ring.consumers() == 2);
+    REQUIRE(ring.empty(a));
+    REQUIRE(ring.empty(b));
+
+    int v = -1;
+
+    REQUIRE(!ring.Dequeue(a, v));
+
+    REQUIRE(ring.Enqueue(0));
+    REQUIRE(ring.Enqueue(1));
+    REQUIRE(ring.Enqueue(2));
+    REQUIRE(ring.Enqueue(3));
+    REQUIRE(!ring.Enqueue(4));
+    REQUIRE(ring.size(a) == 4);
+    REQUIRE(ring.size(b) == 4);
+
+    // Every consumer sees every item
+    REQUIRE(((ring.Dequeue(a, v) && (v == 0)) && (ring.size(a) == 3)));
+    REQUIRE(((ring.Dequeue(a, v) && (v == 1)) && (ring.size(a) == 2)));
+
+    // The slowest consumer gates the producer
+    REQUIRE(!ring.Enqueue(4));
+    REQUIRE(((ring.Dequeue(b, v) && (v == 0)) && (ring.size(b) == 3)));
+    REQUIRE(ring.Enqueue(4));
+    REQUIRE(!ring.Enqueue(5));
+
+    REQUIRE(((ring.Dequeue(b, v) && (v == 1)) && (ring.size(b) == 3)));
+    REQUIRE(ring.Enqueue(5));
+
+    std::vector<int> items;
+    REQUIRE(ring.DequeueBulk(a, std::back_inserter(items), 100) == 4);
+    REQUIRE(items == std::vector<int>({ 2, 3, 4, 5 }));
+    items.clear();
+    REQUIRE(ring.DequeueBulk(b, std::back_inserter(items), 3) == 3);
+    REQUIRE(items == std::vector<int>({ 2, 3, 4 }));
+    REQUIRE(((ring.Dequeue(b, v) && (v == 5)) && ring.empty(b)));
+    REQUIRE(ring.empty(a));
+    REQUIRE(ring.cursor() == 6);
+}
+
+TEST_CASE("Single producer / multiple consumers wait-free multicast ring dependencies", "[CppCommon][Threads]")
+{
+    SPMCMulticastRing<int> ring(8);
+
+    size_t a = ring.AddConsumer();
+    size_t b = ring.AddConsumer({ a });
+
+    int v = -1;
+
+    REQUIRE(ring.Enqueue(1));
+    REQUIRE(ring.Enqueue(2));
+
+    // Stage B does not see items before stage A processes them
+    REQUIRE(!ring.Dequeue(b, v));
+    REQUIRE(ring.Consume(a, [](int& item) { item *= 10; }, 1) == 1);
+    REQUIRE(((ring.Dequeue(b, v) && (v == 10))));
+    REQUIRE(!ring.Dequeue(b, v));
+    REQUIRE(ring.Consume(a, [](int& item) { item *= 10; }) == 1);
+    REQUIRE(((ring.Dequeue(b, v) && (v == 20))));
+    REQUIRE(ring.empty(a));
+    REQUIRE(ring.empty(b));
+
+    // Batch enqueue
+    std::vector<int> input = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    REQUIRE(ring.EnqueueBulk(input.begin(), input.end()) == 8);
+    REQUIRE(ring.EnqueueBulk(input.begin(), input.end()) == 0);
+    REQUIRE(ring.Consume(a, [](int&) {}, 5) == 5);
+    REQUIRE(ring.Consume(b, [](int&) {}) == 5);
+
+    // Reserve and commit contiguous slots
+    size_t count = 8;
+    int* slots = ring.Reserve(count);
+    REQUIRE(slots != nullptr);
+    REQUIRE(count == 5);
+    slots[0] = 100;
+    slots[1] = 200;
+    ring.Commit(2);
+    REQUIRE(ring.size(a) == 5);
+
+    int sum = 0;
+    REQUIRE(ring.Consume(a, [&sum](int& item) { sum += item; }) == 5);
+    REQUIRE(sum == (6 + 7 + 8 + 100 + 200));
+    REQUIRE(ring.Consume(b, [](int&) {}) == 5);
+    REQUIRE(ring.empty(b));
+}
+
+TEST_CASE("Single producer / multiple consumers wait-free multicast ring threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 100000;
+    int consumers_count = 3;
+
+    SPMCMulticastRing<int> ring(1024);
+
+    // Independent consumers and the pipeline stage which depends on all of them
+    std::vector<size_t> indexes;
+    for (int i = 0; i < consumers_count; ++i)
+        indexes.push_back(ring.AddConsumer());
+    size_t stage = ring.AddConsumer({ indexes[0], indexes[1], indexes[2] });
+    indexes.push_back(stage);
+
+    std::atomic<int> errors(0);
+    std::vector<uint64_t> crcs(indexes.size(), 0);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (size_t index : indexes)
+    {
+        consumers.emplace_back([&ring, &errors, &crcs, index, items_to_produce]()
+        {
+            int expected = 0;
+            uint64_t crc = 0;
+            while (expected < items_to_produce)
+            {
+                // Consume available items in a batch
+                size_t count = ring.Consume(index, [&errors, &expected, &crc](int& item)
+                {
+                    if (item != expected++)
+                        ++errors;
+                    crc += item;
+                });
+                if (count == 0)
+                    std::this_thread::yield();
+            }
+            crcs[index] = crc;
+        });
+    }
+
+    // Start producer thread
+    auto producer = std::thread([&ring, items_to_produce]()
+    {
+        for (int i = 0; i < items_to_produce; ++i)
+        {
+            // Enqueue using yield waiting strategy
+            while (!ring.Enqueue(i))
+                std::this_thread::yield();
+        }
+    });
+
+    // Wait for all threads
+    producer.join();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check results
+    uint64_t crc = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        crc += i;
+
+    REQUIRE(errors == 0);
+    for (auto consumer_crc : crcs)
+        REQUIRE(consumer_crc == crc);
+}
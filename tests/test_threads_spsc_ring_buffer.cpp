@@ -6,6 +6,8 @@
 
 #include "threads/spsc_ring_buffer.h"
 
+#include <thread>
+
 using namespace CppCommon;
 
 TEST_CASE("Single producer / single consumer wait-free ring buffer", "[CppCommon][Threads]")
@@ -59,3 +61,122 @@ TEST_CASE("Single producer / single consumer wait-free ring buffer", "[CppCommon
     REQUIRE(buffer.capacity() == 4);
     REQUIRE(buffer.size() == 0);
 }
+
+TEST_CASE("Single producer / single consumer wait-free ring buffer zero-copy", "[CppCommon][Threads]")
+{
+    SPSCRingBuffer buffer(8);
+
+    size_t size;
+
+    REQUIRE(buffer.Peek(size) == nullptr);
+    REQUIRE(size == 0);
+
+    // Reserve and commit the data
+    uint8_t* data = (uint8_t*)buffer.Reserve(5);
+    REQUIRE(data != nullptr);
+    memcpy(data, "abcde", 5);
+    buffer.Commit(5);
+    REQUIRE(buffer.size() == 5);
+
+    // The ring buffer is full for the reservation
+    REQUIRE(buffer.Reserve(4) == nullptr);
+
+    // Peek and release the part of the data
+    const uint8_t* peek = (const uint8_t*)buffer.Peek(size);
+    REQUIRE(((peek != nullptr) && (size == 5)));
+    REQUIRE(memcmp(peek, "abcde", 5) == 0);
+    buffer.Release(4);
+    REQUIRE(buffer.size() == 1);
+
+    // Reservation does not fit into the tail, so the tail is skipped
+    data = (uint8_t*)buffer.Reserve(4);
+    REQUIRE(data != nullptr);
+    memcpy(data, "fghi", 4);
+    buffer.Commit(3);
+    REQUIRE(buffer.size() == 4);
+
+    // Skipped tail is never returned to the consumer
+    peek = (const uint8_t*)buffer.Peek(size);
+    REQUIRE(((peek != nullptr) && (size == 1) && (*peek == 'e')));
+    buffer.Release(1);
+    peek = (const uint8_t*)buffer.Peek(size);
+    REQUIRE(((peek != nullptr) && (size == 3)));
+    REQUIRE(memcmp(peek, "fgh", 3) == 0);
+    buffer.Release(3);
+    REQUIRE(buffer.Peek(size) == nullptr);
+    REQUIRE(buffer.size() == 0);
+
+    // Copy dequeue skips the tail as well
+    REQUIRE(buffer.Enqueue("jklmn", 5));
+    uint8_t output[8];
+    REQUIRE((buffer.Dequeue(output, size = 3) && (size == 3)));
+    data = (uint8_t*)buffer.Reserve(3);
+    REQUIRE(data != nullptr);
+    memcpy(data, "opq", 3);
+    buffer.Commit(3);
+    REQUIRE(buffer.size() == 5);
+    REQUIRE((buffer.Dequeue(output, size = 8) && (size == 5)));
+    REQUIRE(memcmp(output, "mnopq", 5) == 0);
+    REQUIRE(buffer.size() == 0);
+}
+
+TEST_CASE("Single producer / single consumer wait-free ring buffer zero-copy threads", "[CppCommon][Threads]")
+{
+    const int records_to_produce = 100000;
+
+    SPSCRingBuffer buffer(1024);
+
+    // Start producer thread writing variable size records directly into the ring buffer
+    auto producer = std::thread([&buffer, records_to_produce]()
+    {
+        for (int i = 0; i < records_to_produce; ++i)
+        {
+            size_t size = sizeof(int) * (1 + (i % 7));
+
+            uint8_t* data;
+            while ((data = (uint8_t*)buffer.Reserve(size)) == nullptr)
+                std::this_thread::yield();
+
+            for (size_t j = 0; j < size; j += sizeof(int))
+                memcpy(data + j, &i, sizeof(int));
+
+            buffer.Commit(size);
+        }
+    });
+
+    // Read records directly from the ring buffer
+    int64_t crc = 0;
+    int64_t count = 0;
+    while (count < records_to_produce)
+    {
+        size_t size;
+        const uint8_t* data = (const uint8_t*)buffer.Peek(size);
+        if (data == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Records are never split by the skipped tail
+        int record;
+        memcpy(&record, data, sizeof(int));
+        size_t record_size = sizeof(int) * (1 + (record % 7));
+        REQUIRE(size >= record_size);
+
+        crc += record;
+        ++count;
+        buffer.Release(record_size);
+    }
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < records_to_produce; ++i)
+        result += i;
+
+    // Check result
+    REQUIRE(crc == result);
+    REQUIRE(buffer.size() == 0);
+}
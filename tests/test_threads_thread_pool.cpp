@@ -0,0 +1,155 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/thread_pool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+uint64_t Fibonacci(ThreadPool& pool, int n)
+{
+    if (n < 12)
+        return (n < 2) ? n : Fibonacci(pool, n - 1) + Fibonacci(pool, n - 2);
+
+    auto child = pool.Submit([&pool, n]() { return Fibonacci(pool, n - 1); });
+    uint64_t result = Fibonacci(pool, n - 2);
+    return child.Get() + result;
+}
+
+} // namespace
+
+TEST_CASE("Work-stealing deque", "[CppCommon][Threads]")
+{
+    WorkStealingDeque<int> deque(2);
+
+    REQUIRE(deque.empty());
+    REQUIRE(deque.capacity() == 2);
+
+    int v = -1;
+
+    REQUIRE(!deque.Pop(v));
+    REQUIRE(!deque.Steal(v));
+
+    for (int i = 0; i < 10; ++i)
+        deque.Push(i);
+
+    REQUIRE(deque.size() == 10);
+    REQUIRE(deque.capacity() == 16);
+
+    REQUIRE((deque.Pop(v) && (v == 9)));
+    REQUIRE((deque.Steal(v) && (v == 0)));
+    REQUIRE((deque.Steal(v) && (v == 1)));
+    REQUIRE((deque.Pop(v) && (v == 8)));
+    REQUIRE(deque.size() == 6);
+
+    while (deque.Pop(v)) {}
+
+    REQUIRE(deque.empty());
+}
+
+TEST_CASE("Work-stealing deque threads", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+    const int thieves_count = 4;
+
+    WorkStealingDeque<int> deque(64);
+
+    std::atomic<bool> done(false);
+    std::atomic<int64_t> crc(0);
+
+    // Start thief threads
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < thieves_count; ++i)
+    {
+        thieves.emplace_back([&deque, &done, &crc]()
+        {
+            int64_t sum = 0;
+            int item;
+            while (!done || !deque.empty())
+                if (deque.Steal(item))
+                    sum += item;
+            crc += sum;
+        });
+    }
+
+    // Push and pop items in the owner thread
+    int64_t sum = 0;
+    int item;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        deque.Push(i);
+        if (((i % 3) == 0) && deque.Pop(item))
+            sum += item;
+    }
+    while (deque.Pop(item))
+        sum += item;
+    done = true;
+
+    for (auto& thief : thieves)
+        thief.join();
+
+    crc += sum;
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Check result
+    REQUIRE(crc == result);
+}
+
+TEST_CASE("Work-stealing thread pool", "[CppCommon][Threads]")
+{
+    ThreadPool pool(4);
+
+    REQUIRE(pool.threads() == 4);
+    REQUIRE(!pool.pinning());
+    REQUIRE(ThreadPool::CurrentPool() == nullptr);
+    REQUIRE(ThreadPool::CurrentWorker() == -1);
+
+    // Submit tasks with arguments
+    auto sum = pool.Submit([](int a, int b) { return a + b; }, 2, 3);
+    REQUIRE(sum.valid());
+    REQUIRE(sum.Get() == 5);
+    REQUIRE(!sum.valid());
+
+    // Submit the task from the worker thread
+    auto worker = pool.Submit([&pool]() { return (ThreadPool::CurrentPool() == &pool) && (ThreadPool::CurrentWorker() >= 0); });
+    REQUIRE(worker.Get());
+
+    // Fork-join tasks
+    REQUIRE(pool.Submit([&pool]() { return Fibonacci(pool, 20); }).Get() == 6765);
+
+    // Continuations
+    auto chain = pool.Submit([]() { return 10; }).Then([](int x) { return x * 2; }).Then([](int x) { return std::to_string(x); });
+    REQUIRE(chain.Get() == "20");
+
+    // Exceptions propagation
+    auto failed = pool.Submit([]() -> int { throw std::runtime_error("failed"); }).Then([](int x) { return x + 1; });
+    REQUIRE_THROWS_AS(failed.Get(), std::runtime_error);
+
+    // Posted tasks
+    std::atomic<int> counter(0);
+    for (int i = 0; i < 10000; ++i)
+        pool.Post([&pool, &counter]() { pool.Post([&counter]() { ++counter; }); });
+    pool.Wait();
+    REQUIRE(counter == 10000);
+    REQUIRE(pool.pending() == 0);
+
+    // Stopped thread pool executes all pending tasks
+    for (int i = 0; i < 1000; ++i)
+        pool.Post([&counter]() { ++counter; });
+    pool.Stop();
+    REQUIRE(counter == 11000);
+}
@@ -0,0 +1,138 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/timer_service.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Timer service", "[CppCommon][Threads]")
+{
+    uint64_t clock = 0;
+    TimerService service(Timespan::milliseconds(1), [&clock]() { return clock; });
+
+    std::vector<int> fired;
+
+    auto t1 = service.Schedule(Timespan::milliseconds(10), [&fired]() { fired.push_back(1); });
+    auto t2 = service.Schedule(Timespan::milliseconds(5), [&fired]() { fired.push_back(2); });
+    auto t3 = service.Schedule(Timespan::milliseconds(20), [&fired]() { fired.push_back(3); });
+    REQUIRE(service.size() == 3);
+    REQUIRE(service.IsScheduled(t1));
+
+    // Nothing is expired yet
+    clock = Timespan::milliseconds(4).total();
+    REQUIRE(service.Poll() == 0);
+
+    // Timers never expire earlier than requested
+    clock = Timespan::milliseconds(5).total();
+    REQUIRE(service.Poll() == 1);
+    REQUIRE(fired == std::vector<int>({ 2 }));
+    REQUIRE(!service.IsScheduled(t2));
+    REQUIRE(!service.Cancel(t2));
+
+    // Cancel and reschedule
+    REQUIRE(service.Cancel(t3));
+    REQUIRE(!service.IsScheduled(t3));
+    REQUIRE(service.Reschedule(t1, Timespan::milliseconds(100)));
+    clock = Timespan::milliseconds(50).total();
+    REQUIRE(service.Poll() == 0);
+    clock = Timespan::milliseconds(105).total();
+    REQUIRE(service.Poll() == 1);
+    REQUIRE(fired == std::vector<int>({ 2, 1 }));
+    REQUIRE(service.size() == 0);
+
+    // Stale identifiers of reused timer nodes are rejected
+    auto t4 = service.Schedule(Timespan::milliseconds(1), []() {});
+    REQUIRE(t4 != t1);
+    REQUIRE(!service.Cancel(t1));
+    REQUIRE(service.Cancel(t4));
+    REQUIRE(service.Schedule(Timespan::zero(), []() {}) != TimerService::InvalidTimer);
+    clock += Timespan::milliseconds(1).total();
+    REQUIRE(service.Poll() == 1);
+}
+
+TEST_CASE("Timer service periodic timers", "[CppCommon][Threads]")
+{
+    uint64_t clock = 0;
+    TimerService service(Timespan::milliseconds(1), [&clock]() { return clock; });
+
+    int count = 0;
+    TimerService::TimerId id = TimerService::InvalidTimer;
+    id = service.Schedule(Timespan::milliseconds(10), [&service, &count, &id]()
+    {
+        // Cancel the periodic timer from its own callback
+        if (++count == 5)
+            service.Cancel(id);
+    }, Timespan::milliseconds(10));
+
+    for (int i = 0; i < 100; ++i)
+    {
+        clock += Timespan::milliseconds(1).total();
+        service.Poll();
+        REQUIRE(count == std::min((i + 1) / 10, 5));
+    }
+
+    REQUIRE(count == 5);
+    REQUIRE(service.size() == 0);
+}
+
+TEST_CASE("Timer service cascading", "[CppCommon][Threads]")
+{
+    uint64_t clock = 0;
+    TimerService service(Timespan::milliseconds(1), [&clock]() { return clock; });
+
+    // Timers on all levels of the timing wheel
+    std::vector<uint64_t> timeouts = { 1, 255, 256, 257, 1000, 65535, 65536, 70000, 1000000, 16777216, 20000000 };
+    std::vector<uint64_t> expired;
+    for (auto timeout : timeouts)
+        service.Schedule(Timespan::milliseconds(timeout), [&clock, &expired]() { expired.push_back(clock / 1000000); });
+
+    // Advance the clock with uneven steps
+    uint64_t step = 1;
+    while ((expired.size() < timeouts.size()) && (clock < 20000010 * (uint64_t)1000000))
+    {
+        clock += step * 1000000;
+        service.Poll();
+        step = (step % 7) + 1;
+    }
+
+    // Each timer expires at the first poll after its timeout
+    REQUIRE(expired.size() == timeouts.size());
+    for (size_t i = 0; i < timeouts.size(); ++i)
+    {
+        REQUIRE(expired[i] >= timeouts[i]);
+        REQUIRE(expired[i] < timeouts[i] + 8);
+    }
+}
+
+TEST_CASE("Timer service dispatch thread", "[CppCommon][Threads]")
+{
+    TimerService service(Timespan::milliseconds(1));
+
+    std::atomic<int> count(0);
+    for (int i = 0; i < 100; ++i)
+        service.Schedule(Timespan::milliseconds(i % 10), [&count]() { ++count; });
+
+    service.Start();
+    REQUIRE(service.running());
+
+    while (count < 100)
+        Thread::Yield();
+
+    // Idle dispatch thread is woken up by a new timer
+    REQUIRE(service.size() == 0);
+    Thread::Sleep(10);
+    service.Schedule(Timespan::milliseconds(1), [&count]() { ++count; });
+    while (count < 101)
+        Thread::Yield();
+
+    service.Stop();
+    REQUIRE(!service.running());
+    REQUIRE(count == 101);
+    REQUIRE(service.size() == 0);
+}
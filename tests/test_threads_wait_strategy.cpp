@@ -0,0 +1,137 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "threads/mpmc_ring_queue.h"
+#include "threads/spsc_ring_buffer.h"
+#include "threads/wait_strategy.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+template <class TWaitStrategy>
+int64_t ProduceConsume(TWaitStrategy& strategy, int items_to_produce, int producers_count)
+{
+    MPMCRingQueue<int> queue(1024);
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &strategy, producer, items_to_produce, producers_count]()
+        {
+            int items = items_to_produce / producers_count;
+            for (int i = 0; i < items; ++i)
+                EnqueueWait(queue, producer * items + i, strategy);
+        });
+    }
+
+    // Consume all items
+    int64_t crc = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        int item;
+        DequeueWait(queue, item, strategy);
+        crc += item;
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    return crc;
+}
+
+} // namespace
+
+TEST_CASE("Futex", "[CppCommon][Threads]")
+{
+    std::atomic<uint32_t> value(0);
+
+    // Value is not equal to the expected one
+    Futex::Wait(value, 1);
+    REQUIRE(Futex::WaitFor(value, 1, Timespan::milliseconds(10)));
+
+    // Timeout
+    REQUIRE(!Futex::WaitFor(value, 0, Timespan::milliseconds(10)));
+
+    // Wake up the waiting thread
+    auto waiter = std::thread([&value]()
+    {
+        while (value.load() == 0)
+            Futex::Wait(value, 0);
+    });
+    Thread::Sleep(10);
+    value = 1;
+    Futex::WakeAll(value);
+    waiter.join();
+
+    REQUIRE(value == 1);
+}
+
+TEST_CASE("Wait strategies", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+    const int producers_count = 4;
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    BusySpinWait spin;
+    REQUIRE(ProduceConsume(spin, items_to_produce, producers_count) == result);
+
+    BackoffWait backoff;
+    REQUIRE(ProduceConsume(backoff, items_to_produce, producers_count) == result);
+
+    YieldWait yield;
+    REQUIRE(ProduceConsume(yield, items_to_produce, producers_count) == result);
+
+    SpinParkWait park(10);
+    REQUIRE(ProduceConsume(park, items_to_produce, producers_count) == result);
+    REQUIRE(park.waiters() == 0);
+}
+
+TEST_CASE("Wait strategies for ring buffers", "[CppCommon][Threads]")
+{
+    const int items_to_produce = 100000;
+
+    SPSCRingBuffer buffer(64);
+    SpinParkWait strategy(10);
+
+    // Start producer thread
+    auto producer = std::thread([&buffer, &strategy, items_to_produce]()
+    {
+        for (int i = 0; i < items_to_produce; ++i)
+            EnqueueWait(buffer, &i, sizeof(i), strategy);
+    });
+
+    // Consume all items
+    int64_t crc = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        int item;
+        size_t size = sizeof(item);
+        DequeueWait(buffer, &item, size, strategy);
+        REQUIRE(size == sizeof(item));
+        crc += item;
+    }
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Check result
+    REQUIRE(crc == result);
+}